@@ -0,0 +1,454 @@
+/*
+The distributed list (dlist) library provides very light-weight real-time
+capable list classes with can optionally be ordered or circular.
+Copyright (C) 2017..2017  Thomas Schöpping
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef _ASYNCQUEUE_HPP_
+#define _ASYNCQUEUE_HPP_
+
+#include <dlist.hpp>
+
+#include <coroutine>
+
+namespace dlist {
+
+////////////////////////////////////////////////////////////////////////////////
+// FORWARD DECLARATIONS                                                       //
+////////////////////////////////////////////////////////////////////////////////
+
+class waitlist;
+template<typename T> class asyncqueue;
+
+////////////////////////////////////////////////////////////////////////////////
+// WAITER                                                                     //
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief   Base class of all awaiters that suspend on a waitlist.
+ *
+ * @details The waiter embeds the dlitem that links it into the waitlist.
+ *          Since awaiters live in the frame of the suspended coroutine, suspending never allocates.
+ *
+ * @note    A coroutine must not be destroyed while it is suspended on a waitlist, unless it has been cancelled and dispatched before.
+ */
+class waiter
+{
+friend class waitlist;
+template<typename T> friend class asyncqueue;
+
+protected:
+  /**
+   * @brief   Handle of the suspended coroutine.
+   */
+  std::coroutine_handle<> m_handle;
+
+  /**
+   * @brief   Item to link the waiter into a waitlist.
+   */
+  dlitem<waiter> m_item;
+
+  /**
+   * @brief   Flag whether the waiter is linked in the list of waiting coroutines.
+   *
+   * @details A notified waiter stays attached in the list of ready coroutines until it is dispatched.
+   *          The flag tells both lists apart, so cancel() does not unlink a ready waiter.
+   */
+  bool m_waiting;
+
+  /**
+   * @brief   Flag whether the waiter has been cancelled.
+   */
+  bool m_cancelled;
+
+  /**
+   * @brief   Default constructor.
+   */
+  waiter();
+
+  /**
+   * @brief   Destructor.
+   */
+  ~waiter();
+
+private:
+  /**
+   * @brief   The copy constructor is prohibited and must not be implemented.
+   */
+  waiter(const waiter&);
+
+  /**
+   * @brief   The copy operator is prohibited and must not be implemented.
+   */
+  waiter& operator=(const waiter&);
+
+public:
+  /**
+   * @brief   Checks whether the waiter has been cancelled.
+   *
+   * @return  true, if the waiter has been cancelled.
+   */
+  bool cancelled() const;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// WAIT LIST                                                                  //
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief   List of suspended coroutines, which are resumed in FIFO order.
+ *
+ * @details Coroutines suspend with co_await wait() and are linked into the list of waiting coroutines.
+ *          Notifications only move waiters to the list of ready coroutines in constant time.
+ *          All ready coroutines are resumed in a single pass by dispatch(), so several wakeups are batched.
+ *          Cancelling a waiter unlinks it in constant time.
+ *
+ * @note    The waitlist is not thread-safe and is meant to be used by a single scheduler thread.
+ */
+class waitlist
+{
+template<typename T> friend class asyncqueue;
+
+public:
+  /**
+   * @brief   Awaiter returned by wait().
+   *
+   * @details co_await yields true if the coroutine has been notified and false if it has been cancelled.
+   */
+  class awaiter : public waiter
+  {
+  friend class waitlist;
+
+  private:
+    /**
+     * @brief   Reference to the associated waitlist.
+     */
+    waitlist& m_list;
+
+    /**
+     * @brief   Constructor.
+     *
+     * @param[in] list  The waitlist to suspend on.
+     */
+    awaiter(waitlist& list);
+
+  public:
+    /**
+     * @brief   Never completes synchronously.
+     *
+     * @return  false.
+     */
+    bool await_ready() const;
+
+    /**
+     * @brief   Links the awaiter into the list of waiting coroutines.
+     *
+     * @param[in] h   Handle of the suspending coroutine.
+     */
+    void await_suspend(std::coroutine_handle<> h);
+
+    /**
+     * @brief   Retrieves the result of the wait.
+     *
+     * @return  true, if the coroutine has been notified, false if it has been cancelled.
+     */
+    bool await_resume() const;
+  };
+
+private:
+  /**
+   * @brief   List of waiting coroutines.
+   */
+  dldlist<waiter> m_waiting;
+
+  /**
+   * @brief   List of notified or cancelled coroutines, which will be resumed by the next dispatch().
+   */
+  dldlist<waiter> m_ready;
+
+  /**
+   * @brief   The copy constructor is prohibited and must not be implemented.
+   */
+  waitlist(const waitlist&);
+
+  /**
+   * @brief   The copy operator is prohibited and must not be implemented.
+   */
+  waitlist& operator=(const waitlist&);
+
+  /**
+   * @brief   Links a waiter into the list of waiting coroutines.
+   *
+   * @param[in] w   The waiter to link.
+   * @param[in] h   Handle of the suspending coroutine.
+   */
+  void _suspend(waiter& w, std::coroutine_handle<> h);
+
+  /**
+   * @brief   Moves the eldest waiter to the list of ready coroutines.
+   *
+   * @return  Pointer to the notified waiter, or a nullpointer if no coroutine was waiting.
+   */
+  waiter* _notify();
+
+public:
+  /**
+   * @brief   Default constructor.
+   */
+  waitlist();
+
+  /**
+   * @brief   Destructor.
+   *
+   * @note    No coroutines must be waiting or ready.
+   */
+  ~waitlist();
+
+  /**
+   * @brief   Checks whether any coroutine is waiting.
+   *
+   * @return  true, if no coroutine is waiting.
+   */
+  bool empty() const;
+
+  /**
+   * @brief   Retrieves the number of waiting coroutines.
+   *
+   * @return  Number of waiting coroutines.
+   */
+  size_t size() const;
+
+  /**
+   * @brief   Retrieves the number of coroutines that will be resumed by the next dispatch().
+   *
+   * @return  Number of ready coroutines.
+   */
+  size_t ready() const;
+
+  /**
+   * @brief   Creates an awaiter to suspend the calling coroutine on the waitlist.
+   *
+   * @return  The awaiter, which must be awaited exactly once.
+   */
+  awaiter wait();
+
+  /**
+   * @brief   Marks the eldest waiting coroutine as ready.
+   *
+   * @return  true, if a coroutine was waiting.
+   */
+  bool notify_one();
+
+  /**
+   * @brief   Marks all waiting coroutines as ready.
+   *
+   * @return  The number of notified coroutines.
+   */
+  size_t notify_all();
+
+  /**
+   * @brief   Cancels the wait of a suspended coroutine in constant time.
+   *
+   * @details The coroutine is marked ready and its co_await yields the cancellation on the next dispatch().
+   *
+   * @param[in] w   The awaiter of the coroutine to cancel.
+   *
+   * @return  true, if the coroutine was still waiting and has been cancelled.
+   */
+  bool cancel(waiter& w);
+
+  /**
+   * @brief   Cancels the waits of all suspended coroutines, e.g. on shutdown.
+   *
+   * @return  The number of cancelled coroutines.
+   */
+  size_t cancel_all();
+
+  /**
+   * @brief   Resumes all ready coroutines in FIFO order.
+   *
+   * @details Coroutines that become ready while dispatching are resumed by the next call.
+   *
+   * @return  The number of resumed coroutines.
+   */
+  size_t dispatch();
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// ASYNC QUEUE                                                                //
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief   FIFO queue of dldlist items, whose consumers are coroutines.
+ *
+ * @details co_await pop() completes immediately if an item is available.
+ *          Otherwise the coroutine suspends on a waitlist until an item is pushed, which is handed directly to the eldest consumer.
+ *          Neither the items nor the suspension require any allocation.
+ *
+ * @note    The asyncqueue is not thread-safe and is meant to be used by a single scheduler thread.
+ *
+ * @tparam T  Type of the data stored in the asyncqueue.
+ */
+template<typename T>
+class asyncqueue
+{
+public:
+  /**
+   * @brief   Alias for doubly linked dlist item type with according payload type.
+   */
+  typedef typename dldlist<T>::item item;
+
+  /**
+   * @brief   Awaiter returned by pop().
+   *
+   * @details co_await yields the popped item, or a nullpointer if the consumer has been cancelled.
+   */
+  class awaiter : public waiter
+  {
+  friend class asyncqueue;
+
+  private:
+    /**
+     * @brief   Reference to the associated asyncqueue.
+     */
+    asyncqueue& m_queue;
+
+    /**
+     * @brief   The popped item or a nullpointer.
+     */
+    item* m_result;
+
+    /**
+     * @brief   Constructor.
+     *
+     * @param[in] queue   The asyncqueue to pop from.
+     */
+    awaiter(asyncqueue& queue);
+
+  public:
+    /**
+     * @brief   Pops an item without suspending if one is available.
+     *
+     * @return  true, if an item has been popped.
+     */
+    bool await_ready();
+
+    /**
+     * @brief   Links the awaiter into the waitlist of the asyncqueue.
+     *
+     * @param[in] h   Handle of the suspending coroutine.
+     */
+    void await_suspend(std::coroutine_handle<> h);
+
+    /**
+     * @brief   Retrieves the popped item.
+     *
+     * @return  Pointer to the popped item, or a nullpointer if the consumer has been cancelled.
+     */
+    item* await_resume() const;
+  };
+
+private:
+  /**
+   * @brief   The queued items.
+   */
+  dldlist<T> m_list;
+
+  /**
+   * @brief   The waiting consumers.
+   */
+  waitlist m_consumers;
+
+  /**
+   * @brief   The copy constructor is prohibited and must not be implemented.
+   */
+  asyncqueue(const asyncqueue&);
+
+  /**
+   * @brief   The copy operator is prohibited and must not be implemented.
+   */
+  asyncqueue& operator=(const asyncqueue&);
+
+public:
+  /**
+   * @brief   Default constructor.
+   */
+  asyncqueue();
+
+  /**
+   * @brief   Checks whether the asyncqueue contains any items.
+   *
+   * @return  true, if the asyncqueue contains no items.
+   */
+  bool empty() const;
+
+  /**
+   * @brief   Retrieves the number of queued items.
+   *
+   * @return  Number of items in the asyncqueue.
+   */
+  size_t size() const;
+
+  /**
+   * @brief   Retrieves the number of consumers waiting for an item.
+   *
+   * @return  Number of waiting consumers.
+   */
+  size_t waiting() const;
+
+  /**
+   * @brief   Appends an item to the asyncqueue or hands it to the eldest waiting consumer.
+   *
+   * @param[in] i   The item to append.
+   */
+  void push_back(item& i);
+
+  /**
+   * @brief   Creates an awaiter to pop the first item.
+   *
+   * @return  The awaiter, which must be awaited exactly once.
+   */
+  awaiter pop();
+
+  /**
+   * @brief   Cancels a waiting consumer in constant time.
+   *
+   * @param[in] w   The awaiter of the consumer to cancel.
+   *
+   * @return  true, if the consumer was still waiting and has been cancelled.
+   */
+  bool cancel(awaiter& w);
+
+  /**
+   * @brief   Cancels all waiting consumers, e.g. on shutdown.
+   *
+   * @return  The number of cancelled consumers.
+   */
+  size_t cancel_all();
+
+  /**
+   * @brief   Resumes all consumers that received an item or have been cancelled.
+   *
+   * @return  The number of resumed consumers.
+   */
+  size_t dispatch();
+};
+
+} /* namespace dlist */
+
+#include "asyncqueue.tpp"
+
+#endif /* _ASYNCQUEUE_HPP_ */
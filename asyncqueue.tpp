@@ -0,0 +1,286 @@
+/*
+The distributed list (dlist) library provides very light-weight real-time
+capable list classes with can optionally be ordered or circular.
+Copyright (C) 2017..2017  Thomas Schöpping
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef _ASYNCQUEUE_TPP_
+#define _ASYNCQUEUE_TPP_
+
+#include <asyncqueue.hpp>
+
+#include <cassert>
+
+namespace dlist
+{
+
+////////////////////////////////////////////////////////////////////////////////
+// WAITER                                                                     //
+////////////////////////////////////////////////////////////////////////////////
+
+inline waiter::waiter() :
+  m_handle(), m_item(*this), m_waiting(false), m_cancelled(false)
+{}
+
+inline waiter::~waiter()
+{
+  assert(!this->m_item.attached());
+}
+
+inline bool waiter::cancelled() const
+{
+  return this->m_cancelled;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// WAIT LIST                                                                  //
+////////////////////////////////////////////////////////////////////////////////
+
+// AWAITER /////////////////////////////////////////////////////////////////////
+
+inline waitlist::awaiter::awaiter(waitlist& list) :
+  waiter(), m_list(list)
+{}
+
+inline bool waitlist::awaiter::await_ready() const
+{
+  return false;
+}
+
+inline void waitlist::awaiter::await_suspend(std::coroutine_handle<> h)
+{
+  this->m_list._suspend(*this, h);
+  return;
+}
+
+inline bool waitlist::awaiter::await_resume() const
+{
+  return !this->m_cancelled;
+}
+
+// WAITLIST ////////////////////////////////////////////////////////////////////
+
+inline waitlist::waitlist() :
+  m_waiting(), m_ready()
+{}
+
+inline waitlist::~waitlist()
+{
+  assert(this->m_waiting.empty());
+  assert(this->m_ready.empty());
+}
+
+inline void waitlist::_suspend(waiter& w, std::coroutine_handle<> h)
+{
+  w.m_handle = h;
+  w.m_waiting = true;
+  this->m_waiting.push_back(w.m_item);
+  return;
+}
+
+inline waiter* waitlist::_notify()
+{
+  dldlist<waiter>::item* i(this->m_waiting.pop_front());
+  // if no coroutine is waiting, return immediately
+  if (i == nullptr) {
+    return nullptr;
+  }
+  // mark the waiter ready
+  else {
+    (**i).m_waiting = false;
+    this->m_ready.push_back(*i);
+    return &(**i);
+  }
+}
+
+inline bool waitlist::empty() const
+{
+  return this->m_waiting.empty();
+}
+
+inline size_t waitlist::size() const
+{
+  return this->m_waiting.size();
+}
+
+inline size_t waitlist::ready() const
+{
+  return this->m_ready.size();
+}
+
+inline waitlist::awaiter waitlist::wait()
+{
+  return awaiter(*this);
+}
+
+inline bool waitlist::notify_one()
+{
+  return (this->_notify() != nullptr);
+}
+
+inline size_t waitlist::notify_all()
+{
+  size_t cnt(0);
+  // mark all waiters ready
+  for (dldlist<waiter>::iterator it = this->m_waiting.front(); it.valid(); ++it) {
+    it->m_waiting = false;
+    ++cnt;
+  }
+  this->m_ready.splice_back(this->m_waiting);
+  return cnt;
+}
+
+inline bool waitlist::cancel(waiter& w)
+{
+  // if the waiter is not suspended or already ready, it can not be cancelled anymore
+  if (!w.m_waiting) {
+    return false;
+  }
+  // move the waiter to the ready coroutines
+  else {
+    this->m_waiting.unlink(w.m_item);
+    w.m_waiting = false;
+    w.m_cancelled = true;
+    this->m_ready.push_back(w.m_item);
+    return true;
+  }
+}
+
+inline size_t waitlist::cancel_all()
+{
+  size_t cnt(0);
+  // mark all waiters cancelled
+  for (dldlist<waiter>::iterator it = this->m_waiting.front(); it.valid(); ++it) {
+    it->m_waiting = false;
+    it->m_cancelled = true;
+    ++cnt;
+  }
+  this->m_ready.splice_back(this->m_waiting);
+  return cnt;
+}
+
+inline size_t waitlist::dispatch()
+{
+  // take all ready coroutines, so coroutines becoming ready meanwhile are left for the next pass
+  dldlist<waiter> batch;
+  batch.splice_back(this->m_ready);
+
+  size_t cnt(0);
+  while (dldlist<waiter>::item* i = batch.pop_front()) {
+    (**i).m_handle.resume();
+    ++cnt;
+  }
+  return cnt;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// ASYNC QUEUE                                                                //
+////////////////////////////////////////////////////////////////////////////////
+
+// AWAITER /////////////////////////////////////////////////////////////////////
+
+template<typename T>
+asyncqueue<T>::awaiter::awaiter(asyncqueue& queue) :
+  waiter(), m_queue(queue), m_result(nullptr)
+{}
+
+template<typename T>
+inline bool asyncqueue<T>::awaiter::await_ready()
+{
+  this->m_result = this->m_queue.m_list.pop_front();
+  return (this->m_result != nullptr);
+}
+
+template<typename T>
+inline void asyncqueue<T>::awaiter::await_suspend(std::coroutine_handle<> h)
+{
+  this->m_queue.m_consumers._suspend(*this, h);
+  return;
+}
+
+template<typename T>
+inline typename asyncqueue<T>::item* asyncqueue<T>::awaiter::await_resume() const
+{
+  return this->m_result;
+}
+
+// ASYNCQUEUE //////////////////////////////////////////////////////////////////
+
+template<typename T>
+asyncqueue<T>::asyncqueue() :
+  m_list(), m_consumers()
+{}
+
+template<typename T>
+inline bool asyncqueue<T>::empty() const
+{
+  return this->m_list.empty();
+}
+
+template<typename T>
+inline size_t asyncqueue<T>::size() const
+{
+  return this->m_list.size();
+}
+
+template<typename T>
+inline size_t asyncqueue<T>::waiting() const
+{
+  return this->m_consumers.size();
+}
+
+template<typename T>
+void asyncqueue<T>::push_back(item& i)
+{
+  assert(!i.attached());
+
+  // hand the item to the eldest waiting consumer, or queue it
+  awaiter* w(static_cast<awaiter*>(this->m_consumers._notify()));
+  if (w != nullptr) {
+    w->m_result = &i;
+  } else {
+    this->m_list.push_back(i);
+  }
+  return;
+}
+
+template<typename T>
+inline typename asyncqueue<T>::awaiter asyncqueue<T>::pop()
+{
+  return awaiter(*this);
+}
+
+template<typename T>
+inline bool asyncqueue<T>::cancel(awaiter& w)
+{
+  return this->m_consumers.cancel(w);
+}
+
+template<typename T>
+inline size_t asyncqueue<T>::cancel_all()
+{
+  return this->m_consumers.cancel_all();
+}
+
+template<typename T>
+inline size_t asyncqueue<T>::dispatch()
+{
+  return this->m_consumers.dispatch();
+}
+
+} /* namespace dlist */
+
+#endif /* _ASYNCQUEUE_TPP_ */
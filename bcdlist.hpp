@@ -0,0 +1,238 @@
+/*
+The distributed list (dlist) library provides very light-weight real-time
+capable list classes with can optionally be ordered or circular.
+Copyright (C) 2017..2017  Thomas Schöpping
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef _BCDLIST_HPP_
+#define _BCDLIST_HPP_
+
+#include <dlist.hpp>
+
+namespace dlist {
+
+////////////////////////////////////////////////////////////////////////////////
+// BOUNDED CIRCULAR DLIST BASE CLASS                                          //
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief   Capacity bounded circular dlist, which recycles its eldest item when full.
+ *
+ * @details The items are kept in a counted circular dlist, so only contains() and remove() traverse the ring.
+ *          Once the capacity is reached, each insertion removes the eldest item in constant time and returns it for reuse.
+ *
+ * @tparam LIST   Type of the underlying counted circular dlist.
+ * @tparam T      Type of the data stored in the list.
+ */
+template<typename LIST, typename T>
+class _bcdlist
+{
+public:
+  /**
+   * @brief   Alias for item type of the underlying circular dlist.
+   */
+  typedef typename LIST::item item;
+
+  /**
+   * @brief   Alias for iterator type of the underlying circular dlist.
+   */
+  typedef typename LIST::iterator iterator;
+
+protected:
+  /**
+   * @brief   The underlying circular dlist.
+   */
+  LIST m_list;
+
+  /**
+   * @brief   Maximum number of items.
+   */
+  const size_t m_capacity;
+
+  /**
+   * @brief   Standard constructor.
+   *
+   * @param[in] capacity  Maximum number of items.
+   */
+  _bcdlist(const size_t capacity);
+
+private:
+  /**
+   * @brief   The copy constructor is prohibited and must not be implemented.
+   */
+  _bcdlist(const _bcdlist&);
+
+  /**
+   * @brief   The copy operator is prohibited and must not be implemented.
+   */
+  _bcdlist& operator=(const _bcdlist&);
+
+public:
+  /**
+   * @brief   Checks whether the list is empty.
+   *
+   * @return  true, if the list contains no items.
+   */
+  bool empty() const;
+
+  /**
+   * @brief   Checks whether the list is full.
+   *
+   * @return  true, if the next insertion recycles the eldest item.
+   */
+  bool full() const;
+
+  /**
+   * @brief   Retrieves the size of the list in constant time.
+   *
+   * @return  Number of items in the list.
+   */
+  size_t size() const;
+
+  /**
+   * @brief   Retrieves the maximum number of items.
+   *
+   * @return  The capacity of the list.
+   */
+  size_t capacity() const;
+
+  /**
+   * @brief   Checks whether the list contains the specified item.
+   *
+   * @return  true, if the specified item is part of the list.
+   */
+  bool contains(const T& d) const;
+
+  /**
+   * @brief   Removes all items from the list.
+   *
+   * @return  The number of removed items.
+   */
+  size_t clear();
+
+  /**
+   * @brief   Removes a specific object from the list.
+   *
+   * @param[in] rm  The payload object to remove.
+   *
+   * @return  Pointer to the removed item or a nullpointer if the list does not contain the specified object.
+   */
+  item* remove(const T& rm);
+
+  /**
+   * @brief   Retrieves an iterator to the latest element in the list.
+   *
+   * @return  Iterator pointing to the most recently added element in the list.
+   */
+  iterator latest() const;
+
+  /**
+   * @brief   Retrieves an iterator to the eldest element in the list.
+   *
+   * @return  Iterator pointing to the oldest element in the list.
+   */
+  iterator eldest() const;
+
+  /**
+   * @brief   Inserts the specified item as latest in constant time.
+   *
+   * @details If the list is full, the eldest item is removed first.
+   *
+   * @param[in] i   The item to be insterted.
+   *
+   * @return  Pointer to the recycled eldest item, or a nullpointer if the list was not full.
+   */
+  item* insert(item& i);
+
+  /**
+   * @brief   Removes the latest item from the list.
+   *
+   * @return  Pointer to the removed item, or a nullpointer if the list was empty.
+   */
+  item* removeLatest();
+
+  /**
+   * @brief   Removes the oldest item from the list in constant time.
+   *
+   * @return  Pointer to the removed item, or a nullpointer if the list was empty.
+   */
+  item* remove_eldest();
+
+  /**
+   * @brief   Moves the eldest item to the latest position in constant time.
+   */
+  void rotate();
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// BOUNDED CIRCULAR DLIST CLASSES                                             //
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief   Singly linked capacity bounded circular dlist class.
+ *
+ * @note    removeLatest() takes linear time as for the slcdlist.
+ *
+ * @tparam T  Type of the data stored in the slbcdlist.
+ */
+template<typename T>
+class slbcdlist : public _bcdlist<basic_dlist<SINGLY_LINKED, UNORDERED, CIRCULAR, T, counted>, T>
+{
+public:
+  /**
+   * @brief   Standard constructor.
+   *
+   * @param[in] capacity  Maximum number of items.
+   */
+  slbcdlist(const size_t capacity);
+};
+
+/**
+ * @brief   Doubly linked capacity bounded circular dlist class.
+ *
+ * @tparam T  Type of the data stored in the dlbcdlist.
+ */
+template<typename T>
+class dlbcdlist : public _bcdlist<basic_dlist<DOUBLY_LINKED, UNORDERED, CIRCULAR, T, counted>, T>
+{
+public:
+  /**
+   * @brief   Alias for doubly linked dlist item type with according payload type.
+   */
+  typedef typename _bcdlist<basic_dlist<DOUBLY_LINKED, UNORDERED, CIRCULAR, T, counted>, T>::item item;
+
+  /**
+   * @brief   Standard constructor.
+   *
+   * @param[in] capacity  Maximum number of items.
+   */
+  dlbcdlist(const size_t capacity);
+
+  /**
+   * @brief   Removes a specific item without searching it in constant time.
+   *
+   * @param[in] i   The item to remove, which must be part of the dlbcdlist.
+   *
+   * @return  Pointer to the removed item.
+   */
+  item* unlink(item& i);
+};
+
+} /* namespace dlist */
+
+#include "bcdlist.tpp"
+
+#endif /* _BCDLIST_HPP_ */
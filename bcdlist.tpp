@@ -0,0 +1,152 @@
+/*
+The distributed list (dlist) library provides very light-weight real-time
+capable list classes with can optionally be ordered or circular.
+Copyright (C) 2017..2017  Thomas Schöpping
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef _BCDLIST_TPP_
+#define _BCDLIST_TPP_
+
+#include <bcdlist.hpp>
+
+#include <cassert>
+
+namespace dlist
+{
+
+////////////////////////////////////////////////////////////////////////////////
+// BOUNDED CIRCULAR DLIST BASE CLASS                                          //
+////////////////////////////////////////////////////////////////////////////////
+
+template<typename LIST, typename T>
+_bcdlist<LIST, T>::_bcdlist(const size_t capacity) :
+  m_list(), m_capacity(capacity)
+{
+  assert(capacity > 0);
+}
+
+template<typename LIST, typename T>
+inline bool _bcdlist<LIST, T>::empty() const
+{
+  return this->m_list.empty();
+}
+
+template<typename LIST, typename T>
+inline bool _bcdlist<LIST, T>::full() const
+{
+  return (this->m_list.size() >= this->m_capacity);
+}
+
+template<typename LIST, typename T>
+inline size_t _bcdlist<LIST, T>::size() const
+{
+  return this->m_list.size();
+}
+
+template<typename LIST, typename T>
+inline size_t _bcdlist<LIST, T>::capacity() const
+{
+  return this->m_capacity;
+}
+
+template<typename LIST, typename T>
+inline bool _bcdlist<LIST, T>::contains(const T& d) const
+{
+  return this->m_list.contains(d);
+}
+
+template<typename LIST, typename T>
+size_t _bcdlist<LIST, T>::clear()
+{
+  return this->m_list.clear();
+}
+
+template<typename LIST, typename T>
+typename _bcdlist<LIST, T>::item* _bcdlist<LIST, T>::remove(const T& rm)
+{
+  return this->m_list.remove(rm);
+}
+
+template<typename LIST, typename T>
+inline typename _bcdlist<LIST, T>::iterator _bcdlist<LIST, T>::latest() const
+{
+  return this->m_list.latest();
+}
+
+template<typename LIST, typename T>
+inline typename _bcdlist<LIST, T>::iterator _bcdlist<LIST, T>::eldest() const
+{
+  return this->m_list.eldest();
+}
+
+template<typename LIST, typename T>
+typename _bcdlist<LIST, T>::item* _bcdlist<LIST, T>::insert(item& i)
+{
+  // if the list is full, recycle the eldest item
+  item* recycled(nullptr);
+  if (this->full()) {
+    recycled = this->m_list.remove_eldest();
+  }
+  this->m_list.insert(i);
+  return recycled;
+}
+
+template<typename LIST, typename T>
+typename _bcdlist<LIST, T>::item* _bcdlist<LIST, T>::removeLatest()
+{
+  return this->m_list.removeLatest();
+}
+
+template<typename LIST, typename T>
+typename _bcdlist<LIST, T>::item* _bcdlist<LIST, T>::remove_eldest()
+{
+  return this->m_list.remove_eldest();
+}
+
+template<typename LIST, typename T>
+inline void _bcdlist<LIST, T>::rotate()
+{
+  this->m_list.rotate();
+  return;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// BOUNDED CIRCULAR DLIST CLASSES                                             //
+////////////////////////////////////////////////////////////////////////////////
+
+// SINGLY LINKED BOUNDED CIRCULAR DLIST ////////////////////////////////////////
+
+template<typename T>
+slbcdlist<T>::slbcdlist(const size_t capacity) :
+  _bcdlist<basic_dlist<SINGLY_LINKED, UNORDERED, CIRCULAR, T, counted>, T>(capacity)
+{}
+
+// DOUBLY LINKED BOUNDED CIRCULAR DLIST ////////////////////////////////////////
+
+template<typename T>
+dlbcdlist<T>::dlbcdlist(const size_t capacity) :
+  _bcdlist<basic_dlist<DOUBLY_LINKED, UNORDERED, CIRCULAR, T, counted>, T>(capacity)
+{}
+
+template<typename T>
+typename dlbcdlist<T>::item* dlbcdlist<T>::unlink(item& i)
+{
+  return this->m_list.unlink(i);
+}
+
+} /* namespace dlist */
+
+#endif /* _BCDLIST_TPP_ */
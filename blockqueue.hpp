@@ -0,0 +1,174 @@
+/*
+The distributed list (dlist) library provides very light-weight real-time
+capable list classes with can optionally be ordered or circular.
+Copyright (C) 2017..2017  Thomas Schöpping
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef _BLOCKQUEUE_HPP_
+#define _BLOCKQUEUE_HPP_
+
+#include <dlist.hpp>
+#include <futex.hpp>
+#include <spinlock.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+namespace dlist {
+
+////////////////////////////////////////////////////////////////////////////////
+// BLOCKING QUEUE                                                             //
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief   Blocking FIFO queue adaptor over a sldlist or dldlist.
+ *
+ * @details The list is protected by a spinlock, which is only held for the constant time list operations.
+ *          Consumers that find the queue empty register as waiters and park on a futex.
+ *          Producers only issue a wake syscall if a waiter is registered, so neither side enters the kernel while items are available.
+ *
+ * @note    All functions are thread-safe.
+ *
+ * @tparam LIST   Type of the underlying list, either sldlist<T> or dldlist<T>.
+ */
+template<typename LIST>
+class blockqueue
+{
+public:
+  /**
+   * @brief   Alias for the item type of the underlying list.
+   */
+  typedef typename LIST::item item;
+
+private:
+  /**
+   * @brief   Lock protecting the list.
+   */
+  spinlock m_lock;
+
+  /**
+   * @brief   The underlying list.
+   */
+  LIST m_list;
+
+  /**
+   * @brief   Number of consumers that are about to park or parked.
+   */
+  alignas(64) std::atomic<uint32_t> m_waiters;
+
+  /**
+   * @brief   Futex the consumers park on.
+   */
+  futex m_futex;
+
+  /**
+   * @brief   The copy constructor is prohibited and must not be implemented.
+   */
+  blockqueue(const blockqueue&);
+
+  /**
+   * @brief   The copy operator is prohibited and must not be implemented.
+   */
+  blockqueue& operator=(const blockqueue&);
+
+  /**
+   * @brief   Moves up to max items to the output list while holding the lock.
+   *
+   * @param[out] out  The list to append the items to.
+   * @param[in]  max  Maximum number of items to move.
+   *
+   * @return  The number of moved items.
+   */
+  size_t _take(LIST& out, const size_t max);
+
+  /**
+   * @brief   Wakes a parked consumer if there is any.
+   */
+  void _signal();
+
+public:
+  /**
+   * @brief   Default constructor.
+   */
+  blockqueue();
+
+  /**
+   * @brief   Checks whether the blockqueue is empty.
+   *
+   * @note    The result is only a snapshot if other threads modify the blockqueue concurrently.
+   *
+   * @return  true, if the blockqueue contains no items.
+   */
+  bool empty();
+
+  /**
+   * @brief   Retrieves the size of the blockqueue.
+   *
+   * @note    The result is only a snapshot if other threads modify the blockqueue concurrently.
+   *
+   * @return  Number of items in the blockqueue.
+   */
+  size_t size();
+
+  /**
+   * @brief   Appends an item at the back of the blockqueue and wakes a parked consumer if there is any.
+   *
+   * @param[in] i   The item to append.
+   */
+  void push_back(item& i);
+
+  /**
+   * @brief   Removes the first item from the blockqueue, parking until one is available.
+   *
+   * @return  Pointer to the removed item.
+   */
+  item* pop_front();
+
+  /**
+   * @brief   Removes the first item from the blockqueue without blocking.
+   *
+   * @return  Pointer to the removed item, or a nullpointer if the blockqueue was empty.
+   */
+  item* try_pop_front();
+
+  /**
+   * @brief   Removes the first item from the blockqueue, parking at most for the specified time.
+   *
+   * @param[in] timeout   Maximum time to wait for an item.
+   *
+   * @return  Pointer to the removed item, or a nullpointer if the timeout expired.
+   */
+  item* pop_front_for(const std::chrono::nanoseconds timeout);
+
+  /**
+   * @brief   Moves a batch of items to the specified list, parking until at least one is available.
+   *
+   * @details All items are moved within a single lock acquisition.
+   *
+   * @param[out] out  The list to append the items to.
+   * @param[in]  max  Maximum number of items to move.
+   *
+   * @return  The number of moved items.
+   */
+  size_t drain(LIST& out, const size_t max);
+};
+
+} /* namespace dlist */
+
+#include "blockqueue.tpp"
+
+#endif /* _BLOCKQUEUE_HPP_ */
@@ -0,0 +1,189 @@
+/*
+The distributed list (dlist) library provides very light-weight real-time
+capable list classes with can optionally be ordered or circular.
+Copyright (C) 2017..2017  Thomas Schöpping
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef _BLOCKQUEUE_TPP_
+#define _BLOCKQUEUE_TPP_
+
+#include <blockqueue.hpp>
+
+#include <cassert>
+
+namespace dlist
+{
+
+////////////////////////////////////////////////////////////////////////////////
+// BLOCKING QUEUE                                                             //
+////////////////////////////////////////////////////////////////////////////////
+
+template<typename LIST>
+blockqueue<LIST>::blockqueue() :
+  m_lock(), m_list(), m_waiters(0), m_futex()
+{}
+
+template<typename LIST>
+size_t blockqueue<LIST>::_take(LIST& out, const size_t max)
+{
+  size_t cnt(0);
+  this->m_lock.lock();
+  while (cnt < max) {
+    item* i(this->m_list.pop_front());
+    if (i == nullptr) {
+      break;
+    }
+    out.push_back(*i);
+    ++cnt;
+  }
+  this->m_lock.unlock();
+  return cnt;
+}
+
+template<typename LIST>
+inline void blockqueue<LIST>::_signal()
+{
+  // order the preceding unlock before reading the number of waiters, which pairs with the registration in pop_front()
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (this->m_waiters.load(std::memory_order_relaxed) > 0) {
+    this->m_futex.wake(1);
+  }
+  return;
+}
+
+template<typename LIST>
+bool blockqueue<LIST>::empty()
+{
+  this->m_lock.lock();
+  const bool e(this->m_list.empty());
+  this->m_lock.unlock();
+  return e;
+}
+
+template<typename LIST>
+size_t blockqueue<LIST>::size()
+{
+  this->m_lock.lock();
+  const size_t s(this->m_list.size());
+  this->m_lock.unlock();
+  return s;
+}
+
+template<typename LIST>
+void blockqueue<LIST>::push_back(item& i)
+{
+  assert(!i.attached());
+
+  this->m_lock.lock();
+  this->m_list.push_back(i);
+  this->m_lock.unlock();
+  this->_signal();
+  return;
+}
+
+template<typename LIST>
+typename blockqueue<LIST>::item* blockqueue<LIST>::try_pop_front()
+{
+  this->m_lock.lock();
+  item* i(this->m_list.pop_front());
+  this->m_lock.unlock();
+  return i;
+}
+
+template<typename LIST>
+typename blockqueue<LIST>::item* blockqueue<LIST>::pop_front()
+{
+  while (true) {
+    // fast path without registering as waiter
+    item* i(this->try_pop_front());
+    if (i != nullptr) {
+      return i;
+    }
+
+    // register as waiter and check again, so a producer either sees the waiter or the check sees the item
+    this->m_waiters.fetch_add(1, std::memory_order_seq_cst);
+    const uint32_t seq(this->m_futex.value());
+    i = this->try_pop_front();
+    if (i == nullptr) {
+      this->m_futex.wait(seq);
+    }
+    this->m_waiters.fetch_sub(1, std::memory_order_relaxed);
+    if (i != nullptr) {
+      return i;
+    }
+  }
+}
+
+template<typename LIST>
+typename blockqueue<LIST>::item* blockqueue<LIST>::pop_front_for(const std::chrono::nanoseconds timeout)
+{
+  const std::chrono::steady_clock::time_point deadline(std::chrono::steady_clock::now() + timeout);
+  while (true) {
+    // fast path without registering as waiter
+    item* i(this->try_pop_front());
+    if (i != nullptr) {
+      return i;
+    }
+
+    // give up if the deadline has passed
+    const std::chrono::nanoseconds remaining(deadline - std::chrono::steady_clock::now());
+    if (remaining.count() <= 0) {
+      return nullptr;
+    }
+
+    // register as waiter and check again, so a producer either sees the waiter or the check sees the item
+    this->m_waiters.fetch_add(1, std::memory_order_seq_cst);
+    const uint32_t seq(this->m_futex.value());
+    i = this->try_pop_front();
+    if (i == nullptr) {
+      this->m_futex.wait_for(seq, remaining);
+    }
+    this->m_waiters.fetch_sub(1, std::memory_order_relaxed);
+    if (i != nullptr) {
+      return i;
+    }
+  }
+}
+
+template<typename LIST>
+size_t blockqueue<LIST>::drain(LIST& out, const size_t max)
+{
+  assert(max > 0);
+
+  while (true) {
+    // fast path without registering as waiter
+    size_t cnt(this->_take(out, max));
+    if (cnt > 0) {
+      return cnt;
+    }
+
+    // register as waiter and check again, so a producer either sees the waiter or the check sees the item
+    this->m_waiters.fetch_add(1, std::memory_order_seq_cst);
+    const uint32_t seq(this->m_futex.value());
+    cnt = this->_take(out, max);
+    if (cnt == 0) {
+      this->m_futex.wait(seq);
+    }
+    this->m_waiters.fetch_sub(1, std::memory_order_relaxed);
+    if (cnt > 0) {
+      return cnt;
+    }
+  }
+}
+
+} /* namespace dlist */
+
+#endif /* _BLOCKQUEUE_TPP_ */
@@ -0,0 +1,289 @@
+/*
+The distributed list (dlist) library provides very light-weight real-time
+capable list classes with can optionally be ordered or circular.
+Copyright (C) 2017..2017  Thomas Schöpping
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef _CALENDARQUEUE_HPP_
+#define _CALENDARQUEUE_HPP_
+
+#include <dlist.hpp>
+
+#include <cstdint>
+
+namespace dlist {
+
+////////////////////////////////////////////////////////////////////////////////
+// STATIC FUNCTIONS                                                           //
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief   Default key function for calendar queues.
+ *
+ * @tparam T  Integral argument type.
+ *
+ * @param[in] d   The object to retrieve the key of.
+ *
+ * @return    The object converted to an unsigned integer.
+ */
+template<typename T> static inline uint64_t _defaultKey(const T& d);
+
+////////////////////////////////////////////////////////////////////////////////
+// CALENDAR QUEUE                                                             //
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief   Calendar queue of singly linked items with integer keys.
+ *
+ * @details The key range is divided into a ring of buckets of equal width, like the days of a year.
+ *          Each bucket is a slodlist with the comparator of the queue and holds all items whose keys fall into that day of any year.
+ *          removeMin() scans the days of the current year from the current position, so it mostly takes only a few steps.
+ *          The number of buckets follows the number of items, and the width is estimated from the separation of the smallest keys on every resize.
+ *          Thus insert() and removeMin() take amortized constant time for key distributions without extreme outliers.
+ *
+ * @note    The comparator must be consistent with the key function, i.e. cmp(a, b) implies key(a) <= key(b).
+ *
+ * @tparam T  Type of the data stored in the calendarqueue.
+ */
+template<typename T>
+class calendarqueue
+{
+public:
+  /**
+   * @brief   Alias for singly linked dlist item type with according payload type.
+   */
+  typedef typename slodlist<T>::item item;
+
+  /**
+   * @brief   Alias for singly linked dlist iterator type with according payload type.
+   */
+  typedef typename slodlist<T>::iterator iterator;
+
+  /**
+   * @brief   Alias for compare function.
+   */
+  typedef typename slodlist<T>::cmp_f cmp_f;
+
+  /**
+   * @brief   Alias for key function.
+   *
+   * @details The key function maps an object to an unsigned integer in the order of the compare function.
+   */
+  typedef uint64_t (key_f)(const T&);
+
+  /**
+   * @brief   Minimum number of buckets.
+   */
+  static const size_t MIN_BUCKETS = 16;
+
+  /**
+   * @brief   Number of smallest items to estimate the bucket width from.
+   */
+  static const size_t SAMPLES = 25;
+
+private:
+  /**
+   * @brief   Array of buckets.
+   */
+  slodlist<T>* m_buckets;
+
+  /**
+   * @brief   Number of buckets, which is a power of two.
+   */
+  size_t m_nbuckets;
+
+  /**
+   * @brief   Binary logarithm of the bucket width.
+   */
+  unsigned int m_shift;
+
+  /**
+   * @brief   Bucket of the current position.
+   */
+  size_t m_bucket;
+
+  /**
+   * @brief   Exclusive upper key bound of the current position.
+   */
+  uint64_t m_top;
+
+  /**
+   * @brief   Number of items in the calendarqueue.
+   */
+  size_t m_count;
+
+  /**
+   * @brief   Reference to a key function.
+   */
+  const key_f& m_key;
+
+  /**
+   * @brief   Reference to a compare function.
+   */
+  const cmp_f& m_cmp;
+
+  /**
+   * @brief   The copy constructor is prohibited and must not be implemented.
+   */
+  calendarqueue(const calendarqueue&);
+
+  /**
+   * @brief   The copy operator is prohibited and must not be implemented.
+   */
+  calendarqueue& operator=(const calendarqueue&);
+
+  /**
+   * @brief   Allocates and constructs an array of empty buckets.
+   *
+   * @param[in] n   Number of buckets.
+   *
+   * @return  Pointer to the array.
+   */
+  slodlist<T>* _allocate(const size_t n) const;
+
+  /**
+   * @brief   Destructs and frees an array of buckets.
+   *
+   * @param[in] buckets   Pointer to the array.
+   * @param[in] n         Number of buckets.
+   */
+  void _free(slodlist<T>* buckets, const size_t n) const;
+
+  /**
+   * @brief   Retrieves the bucket index of a key.
+   *
+   * @param[in] key   The key.
+   *
+   * @return  Index of the bucket the key falls into.
+   */
+  size_t _index(const uint64_t key) const;
+
+  /**
+   * @brief   Moves the current position to the day of a key.
+   *
+   * @param[in] key   The key.
+   */
+  void _seek(const uint64_t key);
+
+  /**
+   * @brief   Searches the bucket that holds the minimum item.
+   *
+   * @param[out] bucket   Bucket of the current position after the search.
+   * @param[out] top      Upper key bound of the current position after the search.
+   */
+  void _locate(size_t& bucket, uint64_t& top) const;
+
+  /**
+   * @brief   Redistributes all items to a new number of buckets and estimates a new bucket width.
+   *
+   * @param[in] n   The new number of buckets.
+   */
+  void _resize(const size_t n);
+
+public:
+  /**
+   * @brief   Standard constructor.
+   *
+   * @param[in] key   Reference to a key function.
+   * @param[in] cmp   Reference to a compare function.
+   */
+  calendarqueue(key_f& key = _defaultKey, cmp_f& cmp = _defaultCmp);
+
+  /**
+   * @brief   Destructor.
+   */
+  ~calendarqueue();
+
+  /**
+   * @brief   Checks whether the calendarqueue is empty.
+   *
+   * @return  true, if the calendarqueue contains no items.
+   */
+  bool empty() const;
+
+  /**
+   * @brief   Retrieves the number of items in constant time.
+   *
+   * @return  Number of items in the calendarqueue.
+   */
+  size_t size() const;
+
+  /**
+   * @brief   Retrieves the current number of buckets.
+   *
+   * @return  Number of buckets.
+   */
+  size_t buckets() const;
+
+  /**
+   * @brief   Retrieves the current bucket width.
+   *
+   * @return  Range of keys per bucket.
+   */
+  uint64_t width() const;
+
+  /**
+   * @brief   Checks whether the calendarqueue contains the specified item.
+   *
+   * @return  true, if the specified item is part of the calendarqueue.
+   */
+  bool contains(const T& d) const;
+
+  /**
+   * @brief   Removes all items from the calendarqueue.
+   *
+   * @return  The number of removed items.
+   */
+  size_t clear();
+
+  /**
+   * @brief   Removes a specific object from the calendarqueue.
+   *
+   * @param[in] rm  The payload object to remove.
+   *
+   * @return  Pointer to the removed item or a nullpointer if the calendarqueue does not contain the specified object.
+   */
+  item* remove(const T &rm);
+
+  /**
+   * @brief   Retrieves an iterator to the minimum element in the calendarqueue.
+   *
+   * @details The iterator must not be advanced, since the following items might belong to a later year.
+   *
+   * @return  Iterator pointing to the minimum element in the calendarqueue.
+   */
+  iterator min() const;
+
+  /**
+   * @brief   Inserts the specified item in the calendarqueue.
+   *
+   * @param[in] i   The item to be insterted.
+   */
+  void insert(item& i);
+
+  /**
+   * @brief   Removes the minimum item from the calendarqueue.
+   *
+   * @return  Pointer to the removed item, or a nullpointer if the calendarqueue was empty.
+   */
+  item* removeMin();
+};
+
+} /* namespace dlist */
+
+#include "calendarqueue.tpp"
+
+#endif /* _CALENDARQUEUE_HPP_ */
@@ -0,0 +1,290 @@
+/*
+The distributed list (dlist) library provides very light-weight real-time
+capable list classes with can optionally be ordered or circular.
+Copyright (C) 2017..2017  Thomas Schöpping
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef _CALENDARQUEUE_TPP_
+#define _CALENDARQUEUE_TPP_
+
+#include <calendarqueue.hpp>
+
+#include <cassert>
+#include <new>
+
+namespace dlist
+{
+
+////////////////////////////////////////////////////////////////////////////////
+// STATIC FUNCTIONS                                                           //
+////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+static inline uint64_t _defaultKey(const T& d)
+{
+  return static_cast<uint64_t>(d);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// CALENDAR QUEUE                                                             //
+////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+calendarqueue<T>::calendarqueue(key_f& key, cmp_f& cmp) :
+  m_buckets(nullptr), m_nbuckets(MIN_BUCKETS), m_shift(0), m_bucket(0), m_top(1), m_count(0), m_key(key), m_cmp(cmp)
+{
+  this->m_buckets = this->_allocate(this->m_nbuckets);
+}
+
+template<typename T>
+calendarqueue<T>::~calendarqueue()
+{
+  this->_free(this->m_buckets, this->m_nbuckets);
+}
+
+template<typename T>
+slodlist<T>* calendarqueue<T>::_allocate(const size_t n) const
+{
+  // the buckets share the compare function, so they are constructed in place
+  slodlist<T>* buckets(static_cast<slodlist<T>*>(::operator new(n * sizeof(slodlist<T>))));
+  for (size_t b = 0; b < n; ++b) {
+    new (&buckets[b]) slodlist<T>(this->m_cmp);
+  }
+  return buckets;
+}
+
+template<typename T>
+void calendarqueue<T>::_free(slodlist<T>* buckets, const size_t n) const
+{
+  for (size_t b = 0; b < n; ++b) {
+    buckets[b].~slodlist<T>();
+  }
+  ::operator delete(buckets);
+  return;
+}
+
+template<typename T>
+inline size_t calendarqueue<T>::_index(const uint64_t key) const
+{
+  return static_cast<size_t>(key >> this->m_shift) & (this->m_nbuckets - 1);
+}
+
+template<typename T>
+inline void calendarqueue<T>::_seek(const uint64_t key)
+{
+  this->m_bucket = this->_index(key);
+  this->m_top = ((key >> this->m_shift) + 1) << this->m_shift;
+  return;
+}
+
+template<typename T>
+void calendarqueue<T>::_locate(size_t& bucket, uint64_t& top) const
+{
+  assert(!this->empty());
+
+  // scan the days of one year for an item that is due within its day
+  bucket = this->m_bucket;
+  top = this->m_top;
+  for (size_t day = 0; day < this->m_nbuckets; ++day) {
+    const slodlist<T>& b(this->m_buckets[bucket]);
+    if (!b.empty() && this->m_key(*b.min()) < top) {
+      return;
+    }
+    bucket = (bucket + 1) & (this->m_nbuckets - 1);
+    top += (uint64_t(1) << this->m_shift);
+  }
+
+  // if the whole year is empty, search the minimum of all buckets directly
+  bool found(false);
+  uint64_t min(0);
+  for (size_t b = 0; b < this->m_nbuckets; ++b) {
+    if (!this->m_buckets[b].empty()) {
+      const uint64_t key(this->m_key(*this->m_buckets[b].min()));
+      if (!found || key < min) {
+        found = true;
+        min = key;
+      }
+    }
+  }
+  bucket = this->_index(min);
+  top = ((min >> this->m_shift) + 1) << this->m_shift;
+  return;
+}
+
+template<typename T>
+void calendarqueue<T>::_resize(const size_t n)
+{
+  // take all items in ascending order and sample the smallest keys
+  sldlist<T> items;
+  uint64_t samples[SAMPLES];
+  size_t sampled(0);
+  while (this->m_count > 0) {
+    this->_locate(this->m_bucket, this->m_top);
+    item* i(this->m_buckets[this->m_bucket].removeMin());
+    --this->m_count;
+    if (sampled < SAMPLES) {
+      samples[sampled++] = this->m_key(**i);
+    }
+    items.push_back(*i);
+  }
+
+  // estimate the average separation of the smallest keys, ignoring large gaps, and use three times of it as width
+  if (sampled > 1) {
+    const uint64_t average((samples[sampled - 1] - samples[0]) / (sampled - 1));
+    uint64_t sum(0);
+    size_t gaps(0);
+    for (size_t s = 1; s < sampled; ++s) {
+      if (samples[s] - samples[s - 1] <= 2 * average) {
+        sum += samples[s] - samples[s - 1];
+        ++gaps;
+      }
+    }
+    const uint64_t width((gaps > 0) ? (3 * sum / gaps) : (3 * average));
+    this->m_shift = 0;
+    while (this->m_shift < 63 && (uint64_t(1) << this->m_shift) < width) {
+      ++this->m_shift;
+    }
+  }
+
+  // replace the buckets and distribute all items again
+  this->_free(this->m_buckets, this->m_nbuckets);
+  this->m_nbuckets = n;
+  this->m_buckets = this->_allocate(n);
+  if (!items.empty()) {
+    this->_seek(this->m_key(*items.front()));
+  }
+  while (item* i = items.pop_front()) {
+    this->m_buckets[this->_index(this->m_key(**i))].insert(*i);
+    ++this->m_count;
+  }
+  return;
+}
+
+template<typename T>
+inline bool calendarqueue<T>::empty() const
+{
+  return (this->m_count == 0);
+}
+
+template<typename T>
+inline size_t calendarqueue<T>::size() const
+{
+  return this->m_count;
+}
+
+template<typename T>
+inline size_t calendarqueue<T>::buckets() const
+{
+  return this->m_nbuckets;
+}
+
+template<typename T>
+inline uint64_t calendarqueue<T>::width() const
+{
+  return (uint64_t(1) << this->m_shift);
+}
+
+template<typename T>
+bool calendarqueue<T>::contains(const T& d) const
+{
+  return this->m_buckets[this->_index(this->m_key(d))].contains(d);
+}
+
+template<typename T>
+size_t calendarqueue<T>::clear()
+{
+  size_t cnt(0);
+  // clear all buckets
+  for (size_t b = 0; b < this->m_nbuckets; ++b) {
+    cnt += this->m_buckets[b].clear();
+  }
+  this->m_count = 0;
+  return cnt;
+}
+
+template<typename T>
+typename calendarqueue<T>::item* calendarqueue<T>::remove(const T& rm)
+{
+  item* i(this->m_buckets[this->_index(this->m_key(rm))].remove(rm));
+  if (i != nullptr) {
+    --this->m_count;
+    // shrink the calendar if it became too sparse
+    if (this->m_nbuckets > MIN_BUCKETS && this->m_count < this->m_nbuckets / 2) {
+      this->_resize(this->m_nbuckets / 2);
+    }
+  }
+  return i;
+}
+
+template<typename T>
+typename calendarqueue<T>::iterator calendarqueue<T>::min() const
+{
+  // if the calendarqueue is empty, return an invalid iterator
+  if (this->empty()) {
+    return iterator();
+  }
+  // search the bucket of the minimum without moving the current position
+  else {
+    size_t bucket(0);
+    uint64_t top(0);
+    this->_locate(bucket, top);
+    return this->m_buckets[bucket].min();
+  }
+}
+
+template<typename T>
+void calendarqueue<T>::insert(item& i)
+{
+  assert(!i.attached());
+
+  // move the current position back, if the item is due before it
+  const uint64_t key(this->m_key(*i));
+  if (this->empty() || key < this->m_top - (uint64_t(1) << this->m_shift)) {
+    this->_seek(key);
+  }
+  this->m_buckets[this->_index(key)].insert(i);
+  ++this->m_count;
+
+  // grow the calendar if its buckets became too crowded
+  if (this->m_count > 2 * this->m_nbuckets) {
+    this->_resize(2 * this->m_nbuckets);
+  }
+  return;
+}
+
+template<typename T>
+typename calendarqueue<T>::item* calendarqueue<T>::removeMin()
+{
+  // if the calendarqueue is empty, return immediately
+  if (this->empty()) {
+    return nullptr;
+  }
+  // move the current position to the minimum and remove it
+  else {
+    this->_locate(this->m_bucket, this->m_top);
+    item* i(this->m_buckets[this->m_bucket].removeMin());
+    --this->m_count;
+    // shrink the calendar if it became too sparse
+    if (this->m_nbuckets > MIN_BUCKETS && this->m_count < this->m_nbuckets / 2) {
+      this->_resize(this->m_nbuckets / 2);
+    }
+    return i;
+  }
+}
+
+} /* namespace dlist */
+
+#endif /* _CALENDARQUEUE_TPP_ */
@@ -0,0 +1,176 @@
+/*
+The distributed list (dlist) library provides very light-weight real-time
+capable list classes with can optionally be ordered or circular.
+Copyright (C) 2017..2017  Thomas Schöpping
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef _CLOCKCACHE_HPP_
+#define _CLOCKCACHE_HPP_
+
+#include <dlist.hpp>
+#include <hashindex.hpp>
+
+#include <atomic>
+
+namespace dlist {
+
+////////////////////////////////////////////////////////////////////////////////
+// CLOCK CACHE                                                                //
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief   Fixed capacity cache of intrusive entries with CLOCK (second chance) replacement.
+ *
+ * @details The entries form a slcdlist and the clock hand is its eldest entry.
+ *          A hit only sets the reference bit of the entry and never relinks it.
+ *          Eviction sweeps the hand by rotating the slcdlist, clearing reference bits, until it finds an entry that has not been referenced since the last sweep.
+ *          New entries are inserted as latest, which is right behind the hand.
+ *          As in the lrucache, the entries are indexed by a _hashindex.
+ *
+ * @note    The clockcache is not thread-safe.
+ *          Only the reference bits are atomic, so referenced() may be read while another thread uses the clockcache.
+ *
+ * @tparam K  Type of the keys.
+ * @tparam T  Type of the data stored in the clockcache.
+ */
+template<typename K, typename T>
+class clockcache : public _hashindex<K>
+{
+public:
+  /**
+   * @brief   Singly linked item with a key, a reference bit and a link in the hash index.
+   */
+  class entry : public slitem<T>, public _hashitem<K>
+  {
+  friend class clockcache;
+
+  private:
+    /**
+     * @brief   Flag whether the entry has been hit since the clock hand passed it.
+     *
+     * @details The flag is a hint for replacement only and orders no other memory, so relaxed accesses suffice.
+     */
+    std::atomic<bool> m_referenced;
+
+  public:
+    /**
+     * @brief   The only constructor with payload as argument.
+     *
+     * @param[in] d   The payload to set for the entry.
+     */
+    entry(T& d);
+
+    /**
+     * @brief   Checks whether the entry is cached.
+     *
+     * @return  true, if the entry is linked in a clockcache.
+     */
+    bool cached() const;
+
+    /**
+     * @brief   Checks whether the reference bit of the entry is set.
+     *
+     * @return  true, if the entry has been hit since the clock hand passed it.
+     */
+    bool referenced() const;
+  };
+
+  /**
+   * @brief   Alias for hash function.
+   */
+  typedef typename _hashindex<K>::hash_f hash_f;
+
+private:
+  /**
+   * @brief   Circular buffer of entries, whose eldest entry is the clock hand.
+   */
+  slcdlist<T> m_clock;
+
+  /**
+   * @brief   The copy constructor is prohibited and must not be implemented.
+   */
+  clockcache(const clockcache&);
+
+  /**
+   * @brief   The copy operator is prohibited and must not be implemented.
+   */
+  clockcache& operator=(const clockcache&);
+
+public:
+  /**
+   * @brief   Standard constructor.
+   *
+   * @param[in] capacity  Maximum number of entries.
+   * @param[in] hash      Reference to a hash function.
+   */
+  clockcache(const size_t capacity, hash_f& hash = _defaultHash);
+
+  /**
+   * @brief   Looks up an entry and sets its reference bit.
+   *
+   * @param[in] key   The key to look up.
+   *
+   * @return  Pointer to the entry, or a nullpointer if the key is not cached.
+   */
+  entry* get(const K& key);
+
+  /**
+   * @brief   Looks up an entry without changing its reference bit or the counters.
+   *
+   * @param[in] key   The key to look up.
+   *
+   * @return  Pointer to the entry, or a nullpointer if the key is not cached.
+   */
+  entry* peek(const K& key) const;
+
+  /**
+   * @brief   Caches an entry behind the clock hand with its reference bit cleared.
+   *
+   * @details If the clockcache is full, an entry is evicted first.
+   *
+   * @param[in] e     The entry to cache, which must not be cached yet.
+   * @param[in] key   The key of the entry, which must not be cached yet.
+   *
+   * @return  Pointer to the evicted entry, or a nullpointer if no entry has been evicted.
+   */
+  entry* put(entry& e, const K& key);
+
+  /**
+   * @brief   Sweeps the clock hand to the first unreferenced entry and evicts it.
+   *
+   * @details The sweep takes at most one revolution, since it clears the reference bits it passes.
+   *
+   * @return  Pointer to the evicted entry, or a nullpointer if the clockcache is empty.
+   */
+  entry* evict();
+
+  /**
+   * @brief   Removes a specific entry.
+   *
+   * @details Since the clock is singly linked, this takes linear time.
+   *
+   * @param[in] e   The entry to remove.
+   *
+   * @return  true, if the entry was cached and has been removed.
+   */
+  bool erase(entry& e);
+};
+
+} /* namespace dlist */
+
+#include "clockcache.tpp"
+
+#endif /* _CLOCKCACHE_HPP_ */
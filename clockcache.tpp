@@ -0,0 +1,136 @@
+/*
+The distributed list (dlist) library provides very light-weight real-time
+capable list classes with can optionally be ordered or circular.
+Copyright (C) 2017..2017  Thomas Schöpping
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef _CLOCKCACHE_TPP_
+#define _CLOCKCACHE_TPP_
+
+#include <clockcache.hpp>
+
+#include <cassert>
+
+namespace dlist
+{
+
+////////////////////////////////////////////////////////////////////////////////
+// CLOCK CACHE                                                                //
+////////////////////////////////////////////////////////////////////////////////
+
+// ENTRY ///////////////////////////////////////////////////////////////////////
+
+template<typename K, typename T>
+clockcache<K, T>::entry::entry(T& d) :
+  slitem<T>(d), _hashitem<K>(), m_referenced(false)
+{}
+
+template<typename K, typename T>
+inline bool clockcache<K, T>::entry::cached() const
+{
+  return this->attached();
+}
+
+template<typename K, typename T>
+inline bool clockcache<K, T>::entry::referenced() const
+{
+  return this->m_referenced.load(std::memory_order_relaxed);
+}
+
+// CLOCKCACHE //////////////////////////////////////////////////////////////////
+
+template<typename K, typename T>
+clockcache<K, T>::clockcache(const size_t capacity, hash_f& hash) :
+  _hashindex<K>(capacity, hash), m_clock()
+{}
+
+template<typename K, typename T>
+typename clockcache<K, T>::entry* clockcache<K, T>::get(const K& key)
+{
+  entry* e(this->peek(key));
+  // if the key is not cached, count the miss
+  if (e == nullptr) {
+    ++this->m_misses;
+  }
+  // give the entry a second chance
+  else {
+    ++this->m_hits;
+    e->m_referenced.store(true, std::memory_order_relaxed);
+  }
+  return e;
+}
+
+template<typename K, typename T>
+typename clockcache<K, T>::entry* clockcache<K, T>::peek(const K& key) const
+{
+  return static_cast<entry*>(this->_find(key));
+}
+
+template<typename K, typename T>
+typename clockcache<K, T>::entry* clockcache<K, T>::put(entry& e, const K& key)
+{
+  assert(!e.attached());
+  assert(this->peek(key) == nullptr);
+
+  // make room for the new entry
+  entry* evicted((this->full()) ? this->evict() : nullptr);
+
+  this->_chain(e, key);
+  this->m_clock.insert(e);
+  e.m_referenced.store(false, std::memory_order_relaxed);
+  return evicted;
+}
+
+template<typename K, typename T>
+typename clockcache<K, T>::entry* clockcache<K, T>::evict()
+{
+  // if the clockcache is empty, return immediately
+  if (this->empty()) {
+    return nullptr;
+  }
+  // sweep the hand over referenced entries and clear their bits
+  else {
+    entry* hand(static_cast<entry*>(this->m_clock.eldest().get()));
+    while (hand->m_referenced.load(std::memory_order_relaxed)) {
+      hand->m_referenced.store(false, std::memory_order_relaxed);
+      this->m_clock.rotate();
+      hand = static_cast<entry*>(this->m_clock.eldest().get());
+    }
+    entry* e(static_cast<entry*>(this->m_clock.remove_eldest()));
+    this->_unchain(*e);
+    ++this->m_evictions;
+    return e;
+  }
+}
+
+template<typename K, typename T>
+bool clockcache<K, T>::erase(entry& e)
+{
+  // if the entry is not cached, there is nothing to do
+  if (!e.attached()) {
+    return false;
+  }
+  // remove the entry
+  else {
+    this->m_clock.remove(*e);
+    this->_unchain(e);
+    return true;
+  }
+}
+
+} /* namespace dlist */
+
+#endif /* _CLOCKCACHE_TPP_ */
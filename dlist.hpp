@@ -22,6 +22,9 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
 #include <iterator>
 #include <cstddef>
+#include <utility>
+#include <functional>
+#include <type_traits>
 
 ////////////////////////////////////////////////////////////////////////////////
 // VERSION INFORMATION                                                        //
@@ -64,12 +67,19 @@ enum linked_t {
 };
 
 /**
- * @brief   Enumerator to differentiate between standard, ordered, and circular dlists.
+ * @brief   Enumerator to differentiate between unordered and ordered dlists.
  */
-enum property_t {
-  NONE,       /**< Identifier for standard dlists. */
-  ORDERED,    /**< Identifier for ordered dlists. */
-  CIRCULAR,   /**< Identifier for circular dlists. */
+enum order_t {
+  UNORDERED,  /**< Identifier for dlists that keep the order of insertion. */
+  ORDERED,    /**< Identifier for dlists that keep their items sorted. */
+};
+
+/**
+ * @brief   Enumerator to differentiate between linear and circular dlists.
+ */
+enum topology_t {
+  LINEAR,     /**< Identifier for dlists whose last item has no successor. */
+  CIRCULAR,   /**< Identifier for dlists whose last item links to the first one. */
 };
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -78,20 +88,18 @@ enum property_t {
 
 class _slitem;
 class _dlitem;
+class _links;
 template<typename T> class _item;
 template<typename T> class slitem;
 template<typename T> class dlitem;
 template<typename T> class sliterator;
 template<typename T> class dliterator;
-template<linked_t LINKED, property_t PROPERTY, typename T> class _dlist;
-template<property_t PROPERTY, typename T> class _sldlist;
-template<property_t PROPERTY, typename T> class _dldlist;
-template<typename T> class sldlist;
-template<typename T> class slodlist;
-template<typename T> class slcdlist;
-template<typename T> class dldlist;
-template<typename T> class dlodlist;
-template<typename T> class dlcdlist;
+template<typename V, bool ENABLED> class _optional;
+class uncounted;
+class counted;
+class unlocked;
+template<typename LOCK> class _lockguard;
+template<linked_t LINKED, order_t ORDER, topology_t TOPOLOGY, typename T, typename SIZE, typename LOCK> class basic_dlist;
 
 ////////////////////////////////////////////////////////////////////////////////
 // STATIC FUNCTIONS                                                           //
@@ -118,6 +126,8 @@ template<typename T> static inline bool _defaultCmp(const T& a, const T& b);
  */
 class _slitem
 {
+friend class _links;
+
 protected:
   /**
    * @brief   Pointer to the next item in the dlist.
@@ -187,6 +197,8 @@ public:
  */
 class _dlitem
 {
+friend class _links;
+
 protected:
   /**
    * @brief   Pointer to the previous item in the dlist.
@@ -198,6 +210,13 @@ protected:
    */
   _dlitem* m_next;
 
+  /**
+   * @brief   Terminator of the backward links in a linear doubly linked dlist.
+   * @details The first item of a linear doubly linked dlist links back to it instead of holding a nullpointer.
+   *          Hence every item in a doubly linked dlist has at least one link, even if it is the only one.
+   */
+  static _dlitem _head;
+
 private:
   /**
    * @brief   The copy constructor is prohibited and must not be implemented.
@@ -251,6 +270,48 @@ public:
   static bool identical(const _dlitem& a, const _dlitem& b);
 };
 
+/**
+ * @brief   Access to the links of dlist items.
+ * @details Containers which maintain the links of dlist items on their own, like lock-free or seqlock protected lists, use this class instead of accessing the items directly.
+ */
+class _links
+{
+public:
+  /**
+   * @brief   Retrieves the link to the next item.
+   *
+   * @param[in] i   The item to access.
+   *
+   * @return  Reference to the link to the next item.
+   */
+  static _slitem*& next(_slitem& i);
+
+  /**
+   * @brief   Retrieves the link to the next item.
+   *
+   * @param[in] i   The item to access.
+   *
+   * @return  Reference to the link to the next item.
+   */
+  static _dlitem*& next(_dlitem& i);
+
+  /**
+   * @brief   Retrieves the link to the previous item.
+   *
+   * @param[in] i   The item to access.
+   *
+   * @return  Reference to the link to the previous item.
+   */
+  static _dlitem*& prev(_dlitem& i);
+
+  /**
+   * @brief   Retrieves the terminator of the backward links in a linear doubly linked dlist.
+   *
+   * @return  Pointer to the terminator, which the first item links back to.
+   */
+  static _dlitem* head();
+};
+
 /**
  * @brief   Base class for dlist items.
  *
@@ -348,9 +409,7 @@ template<typename T>
 class slitem : public _slitem, public _item<T>
 {
 friend class sliterator<T>;
-friend class sldlist<T>;
-friend class slodlist<T>;
-friend class slcdlist<T>;
+template<linked_t, order_t, topology_t, typename, typename, typename> friend class basic_dlist;
 
 private:
   /**
@@ -462,9 +521,7 @@ template<typename T>
 class dlitem : public _dlitem, public _item<T>
 {
 friend class dliterator<T>;
-friend class dldlist<T>;
-friend class dlodlist<T>;
-friend class dlcdlist<T>;
+template<linked_t, order_t, topology_t, typename, typename, typename> friend class basic_dlist;
 
 private:
   /**
@@ -574,9 +631,7 @@ public:
 template<typename T>
 class sliterator : public std::iterator<std::forward_iterator_tag, slitem<T>, size_t>
 {
-friend class sldlist<T>;
-friend class slodlist<T>;
-friend class slcdlist<T>;
+template<linked_t, order_t, topology_t, typename, typename, typename> friend class basic_dlist;
 
 public:
   /**
@@ -603,6 +658,13 @@ public:
    */
   sliterator(const sliterator& it);
 
+  /**
+   * @brief   Constructor associating the iterator to an item.
+   *
+   * @param[in] i   The slitem to associate or a nullpointer.
+   */
+  explicit sliterator(item* i);
+
   /**
    * @brief   Copy operator.
    *
@@ -675,6 +737,13 @@ public:
    * @return  true, if an item is associated to the iterator.
    */
   bool valid() const;
+
+  /**
+   * @brief   Retrieves the associated item.
+   *
+   * @return  Pointer to the associated slitem or a nullpointer.
+   */
+  item* get() const;
 };
 
 /**
@@ -685,9 +754,7 @@ public:
 template<typename T>
 class dliterator : public std::iterator<std::bidirectional_iterator_tag, dlitem<T>, size_t>
 {
-friend class dldlist<T>;
-friend class dlodlist<T>;
-friend class dlcdlist<T>;
+template<linked_t, order_t, topology_t, typename, typename, typename> friend class basic_dlist;
 
 public:
   /**
@@ -714,6 +781,13 @@ public:
    */
   dliterator(const dliterator& it);
 
+  /**
+   * @brief   Constructor associating the iterator to an item.
+   *
+   * @param[in] i   The dlitem to associate or a nullpointer.
+   */
+  explicit dliterator(item* i);
+
   /**
    * @brief   Copy operator.
    *
@@ -796,291 +870,258 @@ public:
    * @return  true, if an item is associated to the iterator.
    */
   bool valid() const;
+
+  /**
+   * @brief   Retrieves the associated item.
+   *
+   * @return  Pointer to the associated dlitem or a nullpointer.
+   */
+  item* get() const;
 };
 
 ////////////////////////////////////////////////////////////////////////////////
-// BASE DLIST CLASSES                                                         //
+// OPTIONAL MEMBERS                                                           //
 ////////////////////////////////////////////////////////////////////////////////
 
 /**
- * @brief   Abstract dlist base class.
+ * @brief   Storage of a member that only some configurations of a basic_dlist need.
  *
- * @tparam LINKED     Type of linkage of the items of the dlist.
- *                    Possible values are SINGLY_LINKED and DOUBLY_LINKED.
- * @tparam PROPERTY   Characteristic of the dlist.
- *                    Possible values are NONE, ORDERED, and CIRCULAR.
- * @tparam T          Type of the data stored in the dlist.
+ * @tparam V        Type of the stored value.
+ * @tparam ENABLED  Whether the value is stored.
  */
-template<linked_t LINKED, property_t PROPERTY, typename T>
-class _dlist
+template<typename V, bool ENABLED>
+class _optional
 {
 public:
   /**
-   * @brief   Default constructor.
-   */
-  _dlist();
-
-  /**
-   * @brief   Checks whether the dlist is empty.
-   *
-   * @return  true, if the dlist contains no items.
-   */
-  virtual bool empty() const = 0;
-
-  /**
-   * @brief   Retrieves the size of the dlist.
-   *
-   * @return  Number of items in the dlist.
-   */
-  virtual size_t size() const = 0;
-
-  /**
-   * @brief   Checks whether the dlist contains the specified item.
-   *
-   * @return  true, if the specified item is part of the dlist.
+   * @brief   The stored value.
    */
-  virtual bool contains(const T&) const = 0;
+  V m_value;
 
   /**
-   * @brief   Removes all items from the dlist.
+   * @brief   The only constructor with the initial value as argument.
    *
-   * @return  The number of removed items.
+   * @param[in] v   The initial value.
    */
-  virtual size_t clear() = 0;
+  _optional(const V& v);
 };
 
 /**
- * @brief   Abstract singly linked dlist base class.
+ * @brief   Disabled member, which is empty and takes no space as a [[no_unique_address]] member.
  *
- * @tparam PROPERTY   Characteristic of the dlist.
- *                    Possible values are NONE, ORDERED, and CIRCULAR.
- * @tparam T          Type of the data stored in the dlist.
+ * @tparam V  Type of the value that is not stored.
  */
-template<property_t PROPERTY, typename T>
-class _sldlist : public _dlist<SINGLY_LINKED, PROPERTY, T>
+template<typename V>
+class _optional<V, false>
 {
 public:
   /**
-   * @brief   Alias for singly linked dlist item type with according payload type.
-   */
-  typedef slitem<T> item;
-
-  /**
-   * @brief   Alias for singly linked dlist iterator type with according payload type.
-   */
-  typedef sliterator<T> iterator;
-
-public:
-  /**
-   * @brief   Default constructor.
-   */
-  _sldlist();
-
-  /**
-   * @brief   Removes a specific object from the list.
-   *
-   * @param[in] rm  The payload object to remove.
-   *
-   * @return  Pointer to the removed slitem or a nullpointer if the list does not contain the specified object.
+   * @brief   The only constructor, which ignores the initial value.
    */
-  virtual item* remove(const T& rm) = 0;
+  _optional(const V&);
 };
 
+////////////////////////////////////////////////////////////////////////////////
+// SIZE POLICIES                                                              //
+////////////////////////////////////////////////////////////////////////////////
+
 /**
- * @brief   Abstract doubly linked dlist base class.
- *
- * @tparam PROPERTY   Characteristic of the dlist.
- *                    Possible values are NONE, ORDERED, and CIRCULAR.
- * @tparam T          Type of the data stored in the dlist.
+ * @brief   Size policy that keeps no counter and lets the dlist count its items on demand.
  */
-template<property_t PROPERTY, typename T>
-class _dldlist : public _dlist<DOUBLY_LINKED, PROPERTY, T>
+class uncounted
 {
 public:
   /**
-   * @brief   Alias for doubly linked dlist item type with according payload type.
-   */
-  typedef dlitem<T> item;
-
-  /**
-   * @brief   Alias for doubly linked dlist iterator type with according payload type.
+   * @brief   Identifies the policy as not counting, so size() traverses the dlist.
    */
-  typedef dliterator<T> iterator;
+  static const bool COUNTED = false;
 
-public:
   /**
-   * @brief   Default constructor.
+   * @brief   Records added items, which is a no-op.
+   *
+   * @param[in] n   Number of added items.
    */
-  _dldlist();
+  void added(const size_t n);
 
   /**
-   * @brief   Removes a specific object from the list.
-   *
-   * @param[in] rm  The payload object to remove.
+   * @brief   Records removed items, which is a no-op.
    *
-   * @return  Pointer to the removed dlitem or a nullpointer if the list does not contain the specified object.
+   * @param[in] n   Number of removed items.
    */
-  virtual item* remove(const T& rm) = 0;
+  void removed(const size_t n);
 };
 
-////////////////////////////////////////////////////////////////////////////////
-// SINGLY LINKED DLIST CLASSES                                                //
-////////////////////////////////////////////////////////////////////////////////
-
 /**
- * @brief Standard singly linked dlist class.
+ * @brief   Size policy that keeps a counter, so the size of the dlist is known in constant time.
  *
- * @tparam T  Type of the data stored in the sldlist.
+ * @note    Operations that move a range of items from or to a counted dlist count the items of the range.
  */
-template<typename T>
-class sldlist : public _sldlist<NONE, T>
+class counted
 {
-public:
-  /**
-   * @brief   Alias for singly linked dlist item type with according payload type.
-   */
-  typedef typename _sldlist<NONE, T>::item item;
-
-  /**
-   * @brief   Alias for singly linked dlist iterator type with according payload type.
-   */
-  typedef typename _sldlist<NONE, T>::iterator iterator;
-
 private:
   /**
-   * @brief   Iterator pointing to the first item in the sldlist.
+   * @brief   Number of items in the dlist.
    */
-  iterator _first;
+  size_t m_count;
 
+public:
   /**
-   * @brief   Iterator pointing to the last item in the sldlist.
+   * @brief   Identifies the policy as counting, so size() returns the counter.
    */
-  iterator _last;
+  static const bool COUNTED = true;
 
-public:
   /**
    * @brief   Default constructor.
    */
-  sldlist();
+  counted();
 
   /**
-   * @brief   Checks whether the sldlist is empty.
+   * @brief   Records added items.
    *
-   * @return  true, if the sldlist contains no items.
+   * @param[in] n   Number of added items.
    */
-  bool empty() const;
+  void added(const size_t n);
 
   /**
-   * @brief   Retrieves the size of the sldlist.
+   * @brief   Records removed items.
    *
-   * @return  Number of items in the sldlist.
+   * @param[in] n   Number of removed items.
    */
-  size_t size() const;
+  void removed(const size_t n);
 
   /**
-   * @brief   Checks whether the sldlist contains the specified item.
+   * @brief   Retrieves the recorded number of items.
    *
-   * @return  true, if the specified item is part of the sldlist.
+   * @return  Number of items in the dlist.
    */
-  bool contains(const T& d) const;
+  size_t count() const;
+};
 
-  /**
-   * @brief   Removes all items from the sldlist.
-   *
-   * @return  The number of removed items.
-   */
-  size_t clear();
+////////////////////////////////////////////////////////////////////////////////
+// LOCK POLICIES                                                              //
+////////////////////////////////////////////////////////////////////////////////
 
+/**
+ * @brief   Lock policy for dlists that are only accessed by a single thread.
+ *
+ * @details Any class with lock() and unlock() functions, such as spinlock, can be used as lock policy instead.
+ */
+class unlocked
+{
+public:
   /**
-   * @brief   Removes a specific object from the sldlist.
-   *
-   * @param[in] rm  The payload object to remove.
-   *
-   * @return  Pointer to the removed item or a nullpointer if the list does not contain the specified object.
+   * @brief   Acquires the lock, which is a no-op.
    */
-  item* remove(const T &rm);
+  void lock();
 
   /**
-   * @brief   Equality operator.
-   *
-   * @param[in] l   List to compare.
-   *
-   * @return  true, if both lists are equal.
+   * @brief   Releases the lock, which is a no-op.
    */
-  bool operator==(const sldlist& l) const;
+  void unlock();
+};
 
+/**
+ * @brief   Holds the locks of one or two dlists for the lifetime of the guard.
+ *
+ * @details Two locks are always acquired in the order of their addresses, so operations on the same two dlists cannot deadlock.
+ *
+ * @tparam LOCK   Type of the lock policy.
+ */
+template<typename LOCK>
+class _lockguard
+{
+private:
   /**
-   * @brief   Unequality operator.
-   *
-   * @param[in] l   List to compare.
-   *
-   * @return  true, if both lists are not equal.
+   * @brief   The lock acquired first.
    */
-  bool operator!=(const sldlist& l) const;
+  LOCK& m_first;
 
   /**
-   * @brief   Retrieves an iterator to the first element in the sldlist.
-   *
-   * @return  Iterator pointing to the first element in the sldlist.
+   * @brief   The lock acquired second, or a nullpointer if only a single lock is held.
    */
-  iterator front() const;
+  LOCK* m_second;
 
   /**
-   * @brief   Retrieves an iterator to the last element in the sldlist.
-   *
-   * @return  Iterator pointing to the last element in the sldlist.
+   * @brief   The copy constructor is prohibited and must not be implemented.
    */
-  iterator back() const;
+  _lockguard(const _lockguard&);
 
   /**
-   * @brief   Appends an item at the front of the sldlist.
-   *
-   * @param[in] i   The item to append.
+   * @brief   The copy operator is prohibited and must not be implemented.
    */
-  void push_front(item& i);
+  _lockguard& operator=(const _lockguard&);
 
+public:
   /**
-   * @brief   Appends an item at the back of the sldlist.
+   * @brief   Acquires a single lock.
    *
-   * @param[in] i   The item to append.
+   * @param[in] lock  The lock to acquire.
    */
-  void push_back(item& i);
+  _lockguard(LOCK& lock);
 
   /**
-   * @brief   Removes the first item from the sldlist.
+   * @brief   Acquires two locks in the order of their addresses.
    *
-   * @return  Pointer to the removed item, or a nullpointer if the sldlist was empty.
+   * @param[in] a   The first lock to acquire.
+   * @param[in] b   The second lock to acquire, which is acquired only once if it is identical to the first one.
    */
-  item* pop_front();
+  _lockguard(LOCK& a, LOCK& b);
 
   /**
-   * @brief   Removes the last item from the sldlist
-   *
-   * @return  Pointer to the removed item, or a nullpointer if the sldlist was empty.
+   * @brief   Releases all held locks.
    */
-  item* pop_back();
+  ~_lockguard();
 };
 
+////////////////////////////////////////////////////////////////////////////////
+// BASIC DLIST                                                                //
+////////////////////////////////////////////////////////////////////////////////
+
 /**
- * @brief   Singly linked ordered dlist class.
+ * @brief   Generic dlist class, which covers every combination of linkage, order, topology, size policy, and lock policy.
  *
- * @details   Items are ordered from the smallest to the largest.
+ * @details Only the members needed by the configuration are stored, and all other ones take no space:
+ *          A linear dlist holds its first and last item, and a circular one only its last item, whose successor is the first one.
+ *          Ordered dlists additionally hold a pointer to the compare function, and keep their items from the smallest to the largest.
+ *          The size policy is updated by the dlist itself wherever items are linked or unlinked.
+ *          Each public operation holds the lock of the dlist, and operations which move items to another dlist acquire the lock of that dlist only after releasing their own one.
+ *          The default policies are empty and their calls compile to nothing.
  *
- * @tparam T  Type of the data stored in the slodlist.
+ *          Operations that do not apply to a configuration fail to compile when used:
+ *          The deque interface, front(), back(), push_front(), push_back(), pop_front(), pop_back(), and splice_back(), is available for unordered dlists.
+ *          A circular dlist only points to its last item, which links to the first one, so it serves as a circular dlist with a tail pointer.
+ *          Its deque interface operates in constant time, except for pop_back() of a singly linked one.
+ *          The circular interface, latest(), eldest(), insert(), removeLatest(), remove_eldest(), and rotate(), is available for unordered circular dlists.
+ *          The ordered interface, min(), max(), find(), the bounds, insert(), removeMin(), removeMax(), extract_before(), update_after(), and sort(), is available for ordered dlists.
+ *          Items of doubly linked dlists can additionally be removed by unlink() and repositioned by update() in ordered ones.
+ *
+ * @note    The lock only guards each operation itself, but not the iterators returned by it.
+ *
+ * @tparam LINKED     Type of linkage of the items of the dlist.
+ *                    Possible values are SINGLY_LINKED and DOUBLY_LINKED.
+ * @tparam ORDER      Order of the items of the dlist.
+ *                    Possible values are UNORDERED and ORDERED.
+ * @tparam TOPOLOGY   Topology of the dlist.
+ *                    Possible values are LINEAR and CIRCULAR.
+ * @tparam T          Type of the data stored in the dlist.
+ * @tparam SIZE       Size policy, which is either uncounted or counted.
+ * @tparam LOCK       Lock policy, which is either unlocked or a class with lock() and unlock() functions, such as spinlock.
  */
-template<typename T>
-class slodlist : public _sldlist<ORDERED, T>
+template<linked_t LINKED, order_t ORDER, topology_t TOPOLOGY, typename T, typename SIZE = uncounted, typename LOCK = unlocked>
+class basic_dlist
 {
+template<linked_t, order_t, topology_t, typename, typename, typename> friend class basic_dlist;
+
 public:
   /**
-   * @brief   Alias for singly linked dlist item type with according payload type.
+   * @brief   Alias for dlist item type with according linkage and payload type.
    */
-  typedef typename _sldlist<ORDERED, T>::item item;
+  typedef typename std::conditional<LINKED == SINGLY_LINKED, slitem<T>, dlitem<T>>::type item;
 
   /**
-   * @brief   Alias for singly linked dlist iterator type with according payload type.
+   * @brief   Alias for dlist iterator type with according linkage and payload type.
    */
-  typedef typename _sldlist<ORDERED, T>::iterator iterator;
+  typedef typename std::conditional<LINKED == SINGLY_LINKED, sliterator<T>, dliterator<T>>::type iterator;
 
   /**
    * @brief   Alias for compare function.
@@ -1092,322 +1133,295 @@ public:
 
 private:
   /**
-   * @brief   Iterator pointing to the minimum item in the slodlist.
+   * @brief   Pointer to the first item of a linear dlist, or to the last item of a circular one.
    */
-  iterator m_min;
+  item* m_head;
 
   /**
-   * @brief   Iterator pointing to the maximum item in the slodlist.
+   * @brief   Pointer to the last item of a linear dlist.
    */
-  iterator m_max;
+  [[no_unique_address]] _optional<item*, TOPOLOGY == LINEAR> m_tail;
 
   /**
-   * @brief   Reference to a compare function.
+   * @brief   Pointer to the compare function of an ordered dlist.
    */
-  const cmp_f& m_cmp;
+  [[no_unique_address]] _optional<cmp_f*, ORDER == ORDERED> m_cmp;
 
-public:
   /**
-   * @brief   Standard constructor.
-   *
-   * @param[in] cmp   Reference to a compare function.
+   * @brief   The size policy.
    */
-  slodlist(cmp_f& cmp = _defaultCmp);
+  [[no_unique_address]] SIZE m_size;
 
   /**
-   * @brief   Checks whether the slodlist is empty.
-   *
-   * @return  true, if the slodlist contains no items.
+   * @brief   The lock policy.
    */
-  bool empty() const;
+  [[no_unique_address]] mutable LOCK m_lock;
 
   /**
-   * @brief   Retrieves the size of the slodlist.
+   * @brief   Retrieves the first item.
    *
-   * @return  Number of items in the slodlist.
+   * @return  Pointer to the first item, or a nullpointer if the dlist is empty.
    */
-  size_t size() const;
+  item* _first() const;
 
   /**
-   * @brief   Checks whether the slodlist contains the specified item.
+   * @brief   Retrieves the last item.
    *
-   * @return  true, if the specified item is part of the slodlist.
+   * @return  Pointer to the last item, or a nullpointer if the dlist is empty.
    */
-  bool contains(const T& d) const;
+  item* _last() const;
 
   /**
-   * @brief   Removes all items from the slodlist.
+   * @brief   Retrieves the successor of an item.
    *
-   * @return  The number of removed items.
+   * @param[in] i   An item of the dlist.
+   *
+   * @return  Pointer to the next item, or a nullpointer if i is the last item.
    */
-  size_t clear();
+  item* _next(const item* i) const;
 
   /**
-   * @brief   Removes a specific object from the slodlist.
+   * @brief   Retrieves the predecessor of an item of a doubly linked dlist.
    *
-   * @param[in] rm  The payload object to remove.
+   * @param[in] i   An item of the dlist.
    *
-   * @return  Pointer to the removed item or a nullpointer if the list does not contain the specified object.
+   * @return  Pointer to the previous item, or a nullpointer if i is the first item.
    */
-  item* remove(const T &rm);
+  item* _prev(const item* i) const;
 
   /**
-   * @brief   Equality operator.
+   * @brief   Counts the items according to the size policy.
    *
-   * @param[in] l   List to compare.
-   *
-   * @return  true, if both lists are equal.
+   * @return  Number of items in the dlist.
    */
-  bool operator==(const slodlist& l) const;
+  size_t _count() const;
 
   /**
-   * @brief   Unequality operator.
-   *
-   * @param[in] l   List to compare.
+   * @brief   Links an item behind another one.
    *
-   * @return  true, if both lists are not equal.
+   * @param[in] prev  The item to link behind, or a nullpointer to link the item as the first one.
+   * @param[in] i     The item to link.
    */
-  bool operator!=(const slodlist& l) const;
+  void _link(item* prev, item& i);
 
   /**
-   * @brief   Retrieves an iterator to the minimum element in the slodlist.
+   * @brief   Unlinks an item and resets its links.
    *
-   * @return  Iterator pointing to the minimum element in the slodlist.
+   * @param[in] prev  The predecessor of the item, or a nullpointer if it is the first one.
+   * @param[in] i     The item to unlink.
    */
-  iterator min() const;
+  void _unlink(item* prev, item& i);
 
   /**
-   * @brief   Retrieves an iterator to the maximum element in the slodlist.
+   * @brief   Unlinks a contiguous range of items as a chain, whose last successor is a nullpointer.
    *
-   * @return  Iterator pointing to the maximum element in the slodlist.
+   * @param[in] prev    The predecessor of the range, or a nullpointer if the range starts at the first item.
+   * @param[in] first   The first item of the range.
+   * @param[in] last    The last item of the range.
+   * @param[in] cnt     Number of items in the range, which is only evaluated by a counted size policy.
    */
-  iterator max() const;
+  void _detach(item* prev, item& first, item& last, const size_t cnt);
 
   /**
-   * @brief   Inserts the specified item in the slodlist.
+   * @brief   Appends a chain of linked items to the back of an unordered dlist in constant time.
    *
-   * @param[in] i   The item to be insterted.
+   * @note    The lock of this dlist is acquired, so the caller must not hold it.
+   *
+   * @param[in] first   The first item of the chain, whose predecessor is set accordingly.
+   * @param[in] last    The last item of the chain, whose successor must be a nullpointer.
+   * @param[in] cnt     Number of items in the chain, which is only evaluated by a counted size policy.
    */
-  void insert(item& i);
+  void _append(item& first, item& last, const size_t cnt);
 
   /**
-   * @brief   Removes the minimum item from the slodlist.
+   * @brief   Removes all items without acquiring the lock.
    *
-   * @return  Pointer to the removed item, or a nullpointer if the slodlist was empty.
+   * @return  The number of removed items.
    */
-  item* removeMin();
+  size_t _clear();
 
   /**
-   * @brief   Removes the maximum item from the slodlist
+   * @brief   Exchanges the items, the compare function, and the size of two dlists without acquiring the locks.
    *
-   * @return  Pointer to the removed item, or a nullpointer if the slodlist was empty.
+   * @param[in] l   The list to exchange with.
    */
-  item* removeMax();
+  void _swap(basic_dlist& l);
 
   /**
-   * @brief   Sorts all items in the list in case some values have been modified.
+   * @brief   Links an item as the first one without acquiring the lock.
+   *
+   * @param[in] i   The item to link.
    */
-  void sort();
-};
+  void _push_front(item& i);
 
-/**
- * @brief   Singly linked circular dlist class.
- *
- * @tparam T  Type of the data stored in the slcdlist.
- */
-template<typename T>
-class slcdlist : public _sldlist<CIRCULAR, T>
-{
-public:
   /**
-   * @brief   Alias for singly linked dlist item type with according payload type.
+   * @brief   Links an item as the last one without acquiring the lock.
+   *
+   * @param[in] i   The item to link.
    */
-  typedef typename _sldlist<CIRCULAR, T>::item item;
+  void _push_back(item& i);
 
   /**
-   * @brief   Alias for singly linked dlist iterator type with according payload type.
+   * @brief   Unlinks the first item without acquiring the lock.
+   *
+   * @return  Pointer to the removed item, or a nullpointer if the dlist was empty.
    */
-  typedef typename _sldlist<CIRCULAR, T>::iterator iterator;
+  item* _pop_front();
 
-private:
   /**
-   * @brief   Iterator pointing to the most recently inserted item in the slcdlist.
+   * @brief   Unlinks the last item without acquiring the lock.
+   *
+   * @return  Pointer to the removed item, or a nullpointer if the dlist was empty.
    */
-  iterator m_latest;
+  item* _pop_back();
 
-public:
   /**
-   * @brief   Default constructor.
+   * @brief   Inserts an item in front of the first item that is not smaller, without acquiring the lock.
+   *
+   * @param[in] i   The item to insert.
    */
-  slcdlist();
+  void _insert(item& i);
 
   /**
-   * @brief   Checks whether the slcdlist is empty.
+   * @brief   Searches the boundary between the items that belong before a key and the other items without acquiring the lock.
+   *
+   * @details Doubly linked dlists are searched from both ends alternately, and singly linked ones from the first item on.
    *
-   * @return  true, if the slcdlist contains no items.
+   * @param[in] key     The value to search for.
+   * @param[in] upper   Whether items equal to the key belong before it.
+   *
+   * @return  Pointer to the first item behind the boundary, or a nullpointer if all items belong before the key.
    */
-  bool empty() const;
+  item* _bound(const T& key, const bool upper) const;
 
   /**
-   * @brief   Retrieves the size of the slcdlist.
-   *
-   * @return  Number of items in the slcdlist.
+   * @brief   The copy constructor is prohibited and must not be implemented.
    */
-  size_t size() const;
+  basic_dlist(const basic_dlist&);
 
   /**
-   * @brief   Checks whether the slcdlist contains the specified item.
-   *
-   * @return  true, if the specified item is part of the slcdlist.
+   * @brief   The copy operator is prohibited and must not be implemented.
    */
-  bool contains(const T& d) const;
+  basic_dlist& operator=(const basic_dlist&);
 
+public:
   /**
-   * @brief   Removes all items from the slcdlist.
+   * @brief   Default constructor.
    *
-   * @return  The number of removed items.
+   * @details Ordered dlists use the default compare function.
    */
-  size_t clear();
+  basic_dlist();
 
   /**
-   * @brief   Removes a specific object from the slcdlist.
+   * @brief   Constructor of ordered dlists.
    *
-   * @param[in] rm  The payload object to remove.
-   *
-   * @return  Pointer to the removed item or a nullpointer if the list does not contain the specified object.
+   * @param[in] cmp   Reference to a compare function.
    */
-  item* remove(const T &rm);
+  basic_dlist(cmp_f& cmp);
 
   /**
-   * @brief   Equality operator.
+   * @brief   Move constructor.
    *
-   * @param[in] l   List to compare.
+   * @details Takes over all items and the compare function of another dlist in constant time.
    *
-   * @return  true, if both lists are equal.
+   * @param[in] l   The list to take the items from, which is empty afterwards.
    */
-  bool operator==(const slcdlist& l) const;
+  basic_dlist(basic_dlist&& l);
 
   /**
-   * @brief   Unequality operator.
+   * @brief   Move operator.
    *
-   * @param[in] l   List to compare.
+   * @details All items of this dlist are removed before the items and the compare function of the other dlist are taken over in constant time.
    *
-   * @return  true, if both lists are not equal.
-   */
-  bool operator!=(const slcdlist& l) const;
-
-  /**
-   * @brief   Retrieves an iterator to the latest element in the slcdlist.
+   * @param[in] l   The list to take the items from, which is empty afterwards.
    *
-   * @return  Iterator pointing to the most recently added element in the slcdlist.
+   * @return  Reference to this dlist.
    */
-  iterator latest() const;
+  basic_dlist& operator=(basic_dlist&& l);
 
   /**
-   * @brief   Retrieves an iterator to the eldest element in the slcdlist.
+   * @brief   Exchanges the items and the compare function of two dlists in constant time.
    *
-   * @return  Iterator pointing to the oldest element in the slcdlist.
+   * @param[in] l   The list to exchange with.
    */
-  iterator eldest() const;
+  void swap(basic_dlist& l);
 
   /**
-   * @brief   Inserts the specified item in the slcdlist.
+   * @brief   Checks whether the dlist is empty.
    *
-   * @param[in] i   The item to be insterted.
+   * @return  true, if the dlist contains no items.
    */
-  void insert(item& i);
+  bool empty() const;
 
   /**
-   * @brief   Removes the latest item from the slcdlist.
+   * @brief   Retrieves the size of the dlist.
    *
-   * @return  Pointer to the removed item, or a nullpointer if the slcdlist was empty.
-   */
-  item* removeLatest();
-
-  /**
-   * @brief   Removes the oldest item from the slcdlist.
+   * @details A counted dlist returns its counter, and any other one is traversed.
    *
-   * @return  Pointer to the removed item, or a nullpointer if the slcdlist was empty.
-   */
-  item* remove_eldest();
-};
-
-////////////////////////////////////////////////////////////////////////////////
-// DOUBLY LINKED DLIST CLASSES                                                //
-////////////////////////////////////////////////////////////////////////////////
-
-/**
- * @brief Standard doubly linked dlist class.
- *
- * @tparam T  Type of the data stored in the dldlist.
- */
-template<typename T>
-class dldlist : public _dldlist<NONE, T>
-{
-public:
-  /**
-   * @brief   Alias for doubly linked dlist item type with according payload type.
-   */
-  typedef typename _dldlist<NONE, T>::item item;
-
-  /**
-   * @brief   Alias for doubly linked dlist iterator type with according payload type.
-   */
-  typedef typename _dldlist<NONE, T>::iterator iterator;
-
-private:
-  /**
-   * @brief   Iterator pointing to the first item in the dldlist.
-   */
-  iterator _first;
-
-  /**
-   * @brief   Iterator pointing to the last item in the dldlist.
-   */
-  iterator _last;
-
-public:
-  /**
-   * @brief   Default constructor.
+   * @return  Number of items in the dlist.
    */
-  dldlist();
+  size_t size() const;
 
   /**
-   * @brief   Checks whether the dldlist is empty.
+   * @brief   Checks whether the dlist contains the specified item.
    *
-   * @return  true, if the dldlist contains no items.
+   * @return  true, if the specified item is part of the dlist.
    */
-  bool empty() const;
+  bool contains(const T& d) const;
 
   /**
-   * @brief   Retrieves the size of the dldlist.
+   * @brief   Removes all items from the dlist.
    *
-   * @return  Number of items in the dldlist.
+   * @return  The number of removed items.
    */
-  size_t size() const;
+  size_t clear();
 
   /**
-   * @brief   Checks whether the dldlist contains the specified item.
+   * @brief   Removes a specific object from the dlist.
+   *
+   * @param[in] rm  The payload object to remove.
    *
-   * @return  true, if the specified item is part of the dldlist.
+   * @return  Pointer to the removed item or a nullpointer if the list does not contain the specified object.
    */
-  bool contains(const T& d) const;
+  item* remove(const T& rm);
 
   /**
-   * @brief   Removes all items from the dldlist.
+   * @brief   Removes all items whose payload satisfies a predicate in a single pass from the first to the last item.
+   *
+   * @details The removed items keep their order and are appended to the back of the output list.
+   *
+   * @tparam PRED       Type of the predicate, which is called with the payload and returns true for items to remove.
+   * @tparam OTOPOLOGY  Topology of the output list.
+   * @tparam OSIZE      Size policy of the output list.
+   * @tparam OLOCK      Lock policy of the output list.
+   *
+   * @param[in] pred  The predicate.
+   * @param[in] out   The unordered list to append the removed items to.
    *
    * @return  The number of removed items.
    */
-  size_t clear();
+  template<typename PRED, topology_t OTOPOLOGY, typename OSIZE, typename OLOCK>
+  size_t remove_if(PRED pred, basic_dlist<LINKED, UNORDERED, OTOPOLOGY, T, OSIZE, OLOCK>& out);
 
   /**
-   * @brief   Removes a specific object from the dldlist.
+   * @brief   Removes a contiguous range of items.
    *
-   * @param[in] rm  The payload object to remove.
+   * @details The range is unlinked and appended to the back of the output list.
+   *          A doubly linked dlist does so in constant time, while a singly linked one searches the predecessor of the range from the first item on and traverses the range to find its end.
+   *          A range moved from or to a counted dlist is traversed to count its items.
    *
-   * @return  Pointer to the removed item or a nullpointer if the list does not contain the specified object.
+   * @note    The range of a circular dlist must not wrap around from the last to the first item.
+   *
+   * @tparam OTOPOLOGY  Topology of the output list.
+   * @tparam OSIZE      Size policy of the output list.
+   * @tparam OLOCK      Lock policy of the output list.
+   *
+   * @param[in] first   Iterator pointing to the first item to remove.
+   * @param[in] last    Iterator pointing to the item behind the range, or an invalid iterator to remove up to the last item.
+   * @param[in] out     The unordered list to append the removed items to.
    */
-  item* remove(const T &rm);
+  template<topology_t OTOPOLOGY, typename OSIZE, typename OLOCK>
+  void erase(const iterator& first, const iterator& last, basic_dlist<LINKED, UNORDERED, OTOPOLOGY, T, OSIZE, OLOCK>& out);
 
   /**
    * @brief   Equality operator.
@@ -1416,7 +1430,7 @@ public:
    *
    * @return  true, if both lists are equal.
    */
-  bool operator==(const dldlist& l) const;
+  bool operator==(const basic_dlist& l) const;
 
   /**
    * @brief   Unequality operator.
@@ -1425,321 +1439,297 @@ public:
    *
    * @return  true, if both lists are not equal.
    */
-  bool operator!=(const dldlist& l) const;
+  bool operator!=(const basic_dlist& l) const;
 
   /**
-   * @brief   Retrieves an iterator to the first element in the dldlist.
+   * @brief   Retrieves an iterator to the first element in an unordered dlist.
    *
-   * @return  Iterator pointing to the first element in the dldlist.
+   * @return  Iterator pointing to the first element in the dlist.
    */
   iterator front() const;
 
   /**
-   * @brief   Retrieves an iterator to the last element in the dldlist.
+   * @brief   Retrieves an iterator to the last element in an unordered dlist.
    *
-   * @return  Iterator pointing to the last element in the dldlist.
+   * @return  Iterator pointing to the last element in the dlist.
    */
   iterator back() const;
 
   /**
-   * @brief   Appends an item at the front of the dldlist.
+   * @brief   Appends an item at the front of an unordered dlist.
    *
    * @param[in] i   The item to append.
    */
   void push_front(item& i);
 
   /**
-   * @brief   Appends an item at the back of the dldlist.
+   * @brief   Appends an item at the back of an unordered dlist.
    *
    * @param[in] i   The item to append.
    */
   void push_back(item& i);
 
   /**
-   * @brief   Removes the first item from the dldlist.
+   * @brief   Removes the first item from an unordered dlist.
    *
-   * @return  Pointer to the removed item, or a nullpointer if the dldlist was empty.
+   * @return  Pointer to the removed item, or a nullpointer if the dlist was empty.
    */
   item* pop_front();
 
   /**
-   * @brief   Removes the last item from the dldlist
+   * @brief   Removes the last item from an unordered dlist.
    *
-   * @return  Pointer to the removed item, or a nullpointer if the dldlist was empty.
+   * @note    A singly linked dlist searches the predecessor of the last item from the first item on.
+   *
+   * @return  Pointer to the removed item, or a nullpointer if the dlist was empty.
    */
   item* pop_back();
-};
-
-/**
- * @brief   Doubly linked ordered dlist class.
- *
- * @details   Items are ordered from the smallest to the largest.
- *
- * @tparam T  Type of the data stored in the dlodlist.
- */
-template<typename T>
-class dlodlist : public _dldlist<ORDERED, T>
-{
-public:
-  /**
-   * @brief   Alias for doubly linked dlist item type with according payload type.
-   */
-  typedef typename _dldlist<ORDERED, T>::item item;
-
-  /**
-   * @brief   Alias for doubly linked dlist iterator type with according payload type.
-   */
-  typedef typename _dldlist<ORDERED, T>::iterator iterator;
 
   /**
-   * @brief   Alias for compare function.
+   * @brief   Moves all items of another unordered dlist to the back of this unordered dlist.
    *
-   * @details The compare function takes two objects as arguments and returns a bool.
-   *          By definition, the function shall return true if the first argumend is considered smaller than the second argument.
+   * @details The items are moved in constant time, unless this dlist is counted but the other one is not, so its items have to be counted.
+   *
+   * @tparam OTOPOLOGY  Topology of the other list.
+   * @tparam OSIZE      Size policy of the other list.
+   * @tparam OLOCK      Lock policy of the other list.
+   *
+   * @param[in] l   The list to take the items from, which is empty afterwards.
    */
-  typedef bool (cmp_f)(const T&, const T&);
+  template<topology_t OTOPOLOGY, typename OSIZE, typename OLOCK>
+  void splice_back(basic_dlist<LINKED, UNORDERED, OTOPOLOGY, T, OSIZE, OLOCK>& l);
 
-private:
   /**
-   * @brief   Iterator pointing to the minimum item in the dlodlist.
+   * @brief   Retrieves an iterator to the latest element in an unordered circular dlist.
+   *
+   * @return  Iterator pointing to the most recently added element in the dlist.
    */
-  iterator m_min;
+  iterator latest() const;
 
   /**
-   * @brief   Iterator pointing to the maximum item in the dlodlist.
+   * @brief   Retrieves an iterator to the eldest element in an unordered circular dlist.
+   *
+   * @return  Iterator pointing to the oldest element in the dlist.
    */
-  iterator m_max;
+  iterator eldest() const;
 
   /**
-   * @brief   Reference to a compare function.
+   * @brief   Inserts the specified item in the dlist.
+   *
+   * @details An unordered circular dlist inserts the item as the latest one in constant time.
+   *          An ordered dlist inserts the item in front of the first item that is not smaller.
+   *
+   * @param[in] i   The item to be insterted.
    */
-  const cmp_f& m_cmp;
+  void insert(item& i);
 
-public:
   /**
-   * @brief   Standard constructor.
+   * @brief   Removes the latest item from an unordered circular dlist.
    *
-   * @param[in] cmp   Reference to a compare function.
+   * @note    A singly linked dlist searches the predecessor of the latest item from the eldest item on.
+   *
+   * @return  Pointer to the removed item, or a nullpointer if the dlist was empty.
    */
-  dlodlist(cmp_f& cmp = _defaultCmp);
+  item* removeLatest();
 
   /**
-   * @brief   Checks whether the dlodlist is empty.
+   * @brief   Removes the oldest item from an unordered circular dlist.
    *
-   * @return  true, if the dlodlist contains no items.
+   * @return  Pointer to the removed item, or a nullpointer if the dlist was empty.
    */
-  bool empty() const;
+  item* remove_eldest();
 
   /**
-   * @brief   Retrieves the size of the dlodlist.
-   *
-   * @return  Number of items in the dlodlist.
+   * @brief   Moves the eldest item of an unordered circular dlist to the latest position in constant time.
    */
-  size_t size() const;
+  void rotate();
 
   /**
-   * @brief   Checks whether the dlodlist contains the specified item.
+   * @brief   Retrieves an iterator to the minimum element in an ordered dlist.
    *
-   * @return  true, if the specified item is part of the dlodlist.
+   * @return  Iterator pointing to the minimum element in the dlist.
    */
-  bool contains(const T& d) const;
+  iterator min() const;
 
   /**
-   * @brief   Removes all items from the dlodlist.
+   * @brief   Retrieves an iterator to the maximum element in an ordered dlist.
    *
-   * @return  The number of removed items.
+   * @return  Iterator pointing to the maximum element in the dlist.
    */
-  size_t clear();
+  iterator max() const;
 
   /**
-   * @brief   Removes a specific object from the dlodlist.
+   * @brief   Searches an item of an ordered dlist that is equal to a key with respect to the compare function.
    *
-   * @param[in] rm  The payload object to remove.
+   * @details The search stops as soon as the position of the key is passed.
    *
-   * @return  Pointer to the removed item or a nullpointer if the list does not contain the specified object.
+   * @param[in] key   The value to search for.
+   *
+   * @return  Iterator pointing to the first equal item, or an invalid iterator if no item is equal to the key.
    */
-  item* remove(const T &rm);
+  iterator find(const T& key) const;
 
   /**
-   * @brief   Equality operator.
+   * @brief   Searches the first item of an ordered dlist that is not smaller than a key.
    *
-   * @param[in] l   List to compare.
+   * @details A doubly linked dlist is searched from the minimum and from the maximum alternately, so the search takes time proportional to the distance to the closer end.
+   *          A singly linked dlist is searched from the minimum on.
    *
-   * @return  true, if both lists are equal.
+   * @param[in] key   The value to search for.
+   *
+   * @return  Iterator pointing to the first item not smaller than the key, or an invalid iterator if all items are smaller.
    */
-  bool operator==(const dlodlist& l) const;
+  iterator lower_bound(const T& key) const;
 
   /**
-   * @brief   Unequality operator.
+   * @brief   Searches the first item of an ordered dlist that is greater than a key.
    *
-   * @param[in] l   List to compare.
+   * @details A doubly linked dlist is searched from the minimum and from the maximum alternately, so the search takes time proportional to the distance to the closer end.
+   *          A singly linked dlist is searched from the minimum on.
    *
-   * @return  true, if both lists are not equal.
-   */
-  bool operator!=(const dlodlist& l) const;
-
-  /**
-   * @brief   Retrieves an iterator to the minimum element in the dlodlist.
+   * @param[in] key   The value to search for.
    *
-   * @return  Iterator pointing to the minimum element in the dlodlist.
+   * @return  Iterator pointing to the first item greater than the key, or an invalid iterator if no item is greater.
    */
-  iterator min() const;
+  iterator upper_bound(const T& key) const;
 
   /**
-   * @brief   Retrieves an iterator to the maximum element in the dlodlist.
+   * @brief   Searches the range of items of an ordered dlist that are equal to a key.
    *
-   * @return  Iterator pointing to the maximum element in the dlodlist.
-   */
-  iterator max() const;
-
-  /**
-   * @brief   Inserts the specified item in the dlodlist.
+   * @param[in] key   The value to search for.
    *
-   * @param[in] i   The item to be insterted.
+   * @return  Pair of lower_bound() and upper_bound(), which are equal if no item is equal to the key.
    */
-  void insert(item& i);
+  std::pair<iterator, iterator> equal_range(const T& key) const;
 
   /**
-   * @brief   Removes the minimum item from the dlodlist.
+   * @brief   Removes the minimum item from an ordered dlist.
    *
-   * @return  Pointer to the removed item, or a nullpointer if the dlodlist was empty.
+   * @return  Pointer to the removed item, or a nullpointer if the dlist was empty.
    */
   item* removeMin();
 
   /**
-   * @brief   Removes the maximum item from the dlodlist
+   * @brief   Removes the maximum item from an ordered dlist.
+   *
+   * @note    A singly linked dlist searches the predecessor of the maximum from the minimum on.
    *
-   * @return  Pointer to the removed item, or a nullpointer if the dlodlist was empty.
+   * @return  Pointer to the removed item, or a nullpointer if the dlist was empty.
    */
   item* removeMax();
 
   /**
-   * @brief   Sorts all items in the list in case some values have been modified.
-   */
-  void sort();
-};
-
-/**
- * @brief   Doubly linked circular dlist class.
- *
- * @tparam T  Type of the data stored in the dlcdlist.
- */
-template<typename T>
-class dlcdlist : public _dldlist<CIRCULAR, T>
-{
-public:
-  /**
-   * @brief   Alias for doubly linked dlist item type with according payload type.
-   */
-  typedef typename _dldlist<CIRCULAR, T>::item item;
-
-  /**
-   * @brief   Alias for doubly linked dlist iterator type with according payload type.
-   */
-  typedef typename _dldlist<CIRCULAR, T>::iterator iterator;
-
-private:
-  /**
-   * @brief   Iterator pointing to the most recently inserted item in the dlcdlist.
-   */
-  iterator m_latest;
-
-public:
-  /**
-   * @brief   Default constructor.
-   */
-  dlcdlist();
-
-  /**
-   * @brief   Checks whether the dlcdlist is empty.
+   * @brief   Removes all items of an ordered dlist that are smaller than a key at once.
    *
-   * @return  true, if the dlcdlist contains no items.
-   */
-  bool empty() const;
-
-  /**
-   * @brief   Retrieves the size of the dlcdlist.
+   * @details Only the removed prefix is traversed to find its end, which is then unlinked in constant time.
+   *          The items keep their order and are appended to the back of the output list.
    *
-   * @return  Number of items in the dlcdlist.
-   */
-  size_t size() const;
-
-  /**
-   * @brief   Checks whether the dlcdlist contains the specified item.
+   * @tparam OTOPOLOGY  Topology of the output list.
+   * @tparam OSIZE      Size policy of the output list.
+   * @tparam OLOCK      Lock policy of the output list.
    *
-   * @return  true, if the specified item is part of the dlcdlist.
-   */
-  bool contains(const T& d) const;
-
-  /**
-   * @brief   Removes all items from the dlcdlist.
+   * @param[in] key   The value to compare against.
+   * @param[in] out   The unordered list to append the removed items to.
    *
    * @return  The number of removed items.
    */
-  size_t clear();
+  template<topology_t OTOPOLOGY, typename OSIZE, typename OLOCK>
+  size_t extract_before(const T& key, basic_dlist<LINKED, UNORDERED, OTOPOLOGY, T, OSIZE, OLOCK>& out);
 
   /**
-   * @brief   Removes a specific object from the dlcdlist.
+   * @brief   Moves an item of an ordered dlist to its correct position after its value has been modified.
    *
-   * @param[in] rm  The payload object to remove.
+   * @details The item is identified by its predecessor, which also works for singly linked items.
+   *          An item that became greater is moved towards the maximum in time proportional to the distance moved.
+   *          An item that became smaller is moved towards the minimum, which requires to search its position from the minimum on.
    *
-   * @return  Pointer to the removed item or a nullpointer if the list does not contain the specified object.
+   * @param[in] prev  Iterator to the predecessor of the modified item, or an invalid iterator if the minimum has been modified.
    */
-  item* remove(const T &rm);
+  void update_after(const iterator& prev);
 
   /**
-   * @brief   Equality operator.
+   * @brief   Moves an item of a doubly linked ordered dlist to its correct position after its value has been modified.
    *
-   * @param[in] l   List to compare.
+   * @details The item is moved towards the minimum or the maximum in time proportional to the distance moved.
    *
-   * @return  true, if both lists are equal.
+   * @param[in] i   The modified item, which must be part of the dlist.
    */
-  bool operator==(const dlcdlist& l) const;
+  void update(item& i);
 
   /**
-   * @brief   Unequality operator.
-   *
-   * @param[in] l   List to compare.
-   *
-   * @return  true, if both lists are not equal.
+   * @brief   Sorts all items of an ordered dlist in case some values have been modified.
    */
-  bool operator!=(const dlcdlist& l) const;
+  void sort();
 
   /**
-   * @brief   Retrieves an iterator to the latest element in the dlcdlist.
+   * @brief   Removes the specified item from a doubly linked dlist in constant time.
    *
-   * @return  Iterator pointing to the most recently added element in the dlcdlist.
-   */
-  iterator latest() const;
-
-  /**
-   * @brief   Retrieves an iterator to the eldest element in the dlcdlist.
+   * @note    The item must be part of this dlist.
+   *          Debug builds only check that the neighbours of the item link back to it.
+   *          Membership in this dlist is thus verified for the first and the last item of a linear dlist only.
    *
-   * @return  Iterator pointing to the oldest element in the dlcdlist.
-   */
-  iterator eldest() const;
-
-  /**
-   * @brief   Inserts the specified item in the dlcdlist.
+   * @param[in] i   The item to remove.
    *
-   * @param[in] i   The item to be insterted.
+   * @return  Pointer to the removed item.
    */
-  void insert(item& i);
+  item* unlink(item& i);
+};
 
-  /**
-   * @brief   Removes the latest item from the dlcdlist.
-   *
-   * @return  Pointer to the removed item, or a nullpointer if the dlcdlist was empty.
-   */
-  item* removeLatest();
+////////////////////////////////////////////////////////////////////////////////
+// DLIST CLASSES                                                              //
+////////////////////////////////////////////////////////////////////////////////
 
-  /**
-   * @brief   Removes the oldest item from the dlcdlist.
-   *
-   * @return  Pointer to the removed item, or a nullpointer if the dlcdlist was empty.
-   */
-  item* remove_eldest();
-};
+/**
+ * @brief   Standard singly linked dlist class.
+ *
+ * @tparam T  Type of the data stored in the sldlist.
+ */
+template<typename T>
+using sldlist = basic_dlist<SINGLY_LINKED, UNORDERED, LINEAR, T>;
+
+/**
+ * @brief   Singly linked ordered dlist class.
+ *
+ * @details   Items are ordered from the smallest to the largest.
+ *
+ * @tparam T  Type of the data stored in the slodlist.
+ */
+template<typename T>
+using slodlist = basic_dlist<SINGLY_LINKED, ORDERED, LINEAR, T>;
+
+/**
+ * @brief   Singly linked circular dlist class.
+ *
+ * @tparam T  Type of the data stored in the slcdlist.
+ */
+template<typename T>
+using slcdlist = basic_dlist<SINGLY_LINKED, UNORDERED, CIRCULAR, T>;
+
+/**
+ * @brief   Standard doubly linked dlist class.
+ *
+ * @tparam T  Type of the data stored in the dldlist.
+ */
+template<typename T>
+using dldlist = basic_dlist<DOUBLY_LINKED, UNORDERED, LINEAR, T>;
+
+/**
+ * @brief   Doubly linked ordered dlist class.
+ *
+ * @details   Items are ordered from the smallest to the largest.
+ *
+ * @tparam T  Type of the data stored in the dlodlist.
+ */
+template<typename T>
+using dlodlist = basic_dlist<DOUBLY_LINKED, ORDERED, LINEAR, T>;
+
+/**
+ * @brief   Doubly linked circular dlist class.
+ *
+ * @tparam T  Type of the data stored in the dlcdlist.
+ */
+template<typename T>
+using dlcdlist = basic_dlist<DOUBLY_LINKED, UNORDERED, CIRCULAR, T>;
 
 } /* namespace dlist */
 
@@ -73,6 +73,8 @@ _dlitem::_dlitem() :
   m_prev(nullptr), m_next(nullptr)
 {}
 
+inline _dlitem _dlitem::_head;
+
 inline bool _dlitem::attached() const
 {
   return (this->m_prev != nullptr) || (this->m_next != nullptr);
@@ -93,6 +95,28 @@ inline bool _dlitem::identical(const _dlitem &a, const _dlitem &b)
   return (a.m_prev == b.m_prev) && (a.m_next == b.m_next);
 }
 
+// _LINKS //////////////////////////////////////////////////////////////////////
+
+inline _slitem*& _links::next(_slitem& i)
+{
+  return i.m_next;
+}
+
+inline _dlitem*& _links::next(_dlitem& i)
+{
+  return i.m_next;
+}
+
+inline _dlitem*& _links::prev(_dlitem& i)
+{
+  return i.m_prev;
+}
+
+inline _dlitem* _links::head()
+{
+  return &_dlitem::_head;
+}
+
 // _ITEM ///////////////////////////////////////////////////////////////////////
 
 template<typename T>
@@ -256,6 +280,11 @@ sliterator<T>::sliterator(const sliterator& it) :
   m_item(it.m_item)
 {}
 
+template<typename T>
+sliterator<T>::sliterator(item* i) :
+  m_item(i)
+{}
+
 template<typename T>
 inline sliterator<T>& sliterator<T>::operator=(const sliterator& it)
 {
@@ -315,6 +344,12 @@ inline bool sliterator<T>::valid() const
   return (this->m_item != nullptr);
 }
 
+template<typename T>
+inline typename sliterator<T>::item* sliterator<T>::get() const
+{
+  return this->m_item;
+}
+
 // DLITERATOR //////////////////////////////////////////////////////////////////
 
 template<typename T>
@@ -327,6 +362,11 @@ dliterator<T>::dliterator(const dliterator& it) :
   m_item(it.m_item)
 {}
 
+template<typename T>
+dliterator<T>::dliterator(item* i) :
+  m_item(i)
+{}
+
 template<typename T>
 inline dliterator<T>& dliterator<T>::operator=(const dliterator& it)
 {
@@ -359,7 +399,7 @@ template<typename T>
 inline dliterator<T>& dliterator<T>::operator--()
 {
   if (this->m_item != nullptr) {
-    this->m_item = static_cast<item*>(this->m_item->m_prev);
+    this->m_item = (this->m_item->m_prev != &item::_head) ? static_cast<item*>(this->m_item->m_prev) : nullptr;
   }
   return *this;
 }
@@ -388,7 +428,7 @@ T* dliterator<T>::peek(const int n) const
   }
   // peek backwards or skip if n >= 0
   while (cnt < 0 && i != nullptr) {
-    i = static_cast<item*>(i->m_prev);
+    i = (i->m_prev != &item::_head) ? static_cast<item*>(i->m_prev) : nullptr;
     ++cnt;
   }
   return (i != nullptr) ? &(i->m_data) : nullptr;
@@ -400,824 +440,708 @@ inline bool dliterator<T>::valid() const
   return (this->m_item != nullptr);
 }
 
+template<typename T>
+inline typename dliterator<T>::item* dliterator<T>::get() const
+{
+  return this->m_item;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
-// BASE DLIST CLASSES                                                         //
+// OPTIONAL MEMBERS                                                           //
 ////////////////////////////////////////////////////////////////////////////////
 
-// _DLIST //////////////////////////////////////////////////////////////////////
-
-template<linked_t LINKED, property_t PROPERTY, typename T>
-_dlist<LINKED, PROPERTY, T>::_dlist()
-{}
-
-// _SLDLIST ////////////////////////////////////////////////////////////////////
-
-template<property_t PROPERTY, typename T>
-_sldlist<PROPERTY, T>::_sldlist() :
-  _dlist<SINGLY_LINKED, PROPERTY, T>()
+template<typename V, bool ENABLED>
+inline _optional<V, ENABLED>::_optional(const V& v) :
+  m_value(v)
 {}
 
-// _DLDLIST ////////////////////////////////////////////////////////////////////
-
-template<property_t PROPERTY, typename T>
-_dldlist<PROPERTY, T>::_dldlist() :
-  _dlist<DOUBLY_LINKED, PROPERTY, T>()
+template<typename V>
+inline _optional<V, false>::_optional(const V&)
 {}
 
 ////////////////////////////////////////////////////////////////////////////////
-// SINGLY LINKED DLIST CLASSES                                                //
+// SIZE POLICIES                                                              //
 ////////////////////////////////////////////////////////////////////////////////
 
-// SINGLY LINKED DLIST /////////////////////////////////////////////////////////
-
-template<typename T>
-sldlist<T>::sldlist() :
-  _sldlist<NONE, T>(), _first(), _last()
-{}
+// UNCOUNTED ///////////////////////////////////////////////////////////////////
 
-template<typename T>
-inline bool sldlist<T>::empty() const
+inline void uncounted::added(const size_t)
 {
-  assert(!((this->_first.m_item == nullptr) ^ (this->_last.m_item == nullptr)));
-
-  return (this->_first.m_item == nullptr);
+  return;
 }
 
-template<typename T>
-size_t sldlist<T>::size() const
+inline void uncounted::removed(const size_t)
 {
-  // if the list is empty, return immediately
-  if (this->empty()) {
-    return 0;
-  }
-  // iterate through the list
-  else {
-    size_t cnt(1);
-    iterator it(this->_first);
-    while (it != this->_last) {
-      ++it;
-      ++cnt;
-    }
-    return cnt;
-  }
+  return;
 }
 
-template<typename T>
-bool sldlist<T>::contains(const T& d) const
+// COUNTED /////////////////////////////////////////////////////////////////////
+
+inline counted::counted() :
+  m_count(0)
+{}
+
+inline void counted::added(const size_t n)
 {
-  // if the list is empty, return immediately
-  if (this->empty()) {
-    return false;
-  }
-  // iterate through the list and search for d
-  else {
-    iterator it(this->_first);
-    while (true) {
-      // test for d
-      if (&(it.m_item->m_data) == &d) {
-        return true;
-      }
-      // keep going as long as the end is not reached yet
-      else if (it != this->_last) {
-        ++it;
-      }
-      // break the loop when all items have been checked
-      else {
-        return false;
-      }
-    }
-  }
+  this->m_count += n;
+  return;
 }
 
-template<typename T>
-size_t sldlist<T>::clear()
+inline void counted::removed(const size_t n)
 {
-  size_t cnt(0);
-  // pop all elements
-  while (this->pop_front() != nullptr) {
-    ++cnt;
-  }
-  return cnt;
+  assert(n <= this->m_count);
+
+  this->m_count -= n;
+  return;
 }
 
-template<typename T>
-typename sldlist<T>::item* sldlist<T>::remove(const T& rm)
+inline size_t counted::count() const
 {
-  // if the list is empty, return immediately
-  if (this->empty()) {
-    return nullptr;
-  }
-  // iterat through the list and remove the first item pointing to rm
-  else {
-    iterator current(this->_first);
-    iterator last;
-    while (true) {
-      // test for rm
-      if (&(current.m_item->m_data) == &rm) {
-        // the first item matches
-        if (current == this->_first) {
-          // if the last item will be removed, set all pointers accordingly
-          if (this->_first == this->_last) {
-            this->_first.m_item = nullptr;
-            this->_last.m_item = nullptr;
-          }
-          // increase the _first iterator
-          else {
-            ++this->_first;
-          }
-        }
-        // the last item matches
-        else if (current == this->_last) {
-          this->_last = last;
-          this->_last.m_item->m_next = nullptr;
-        }
-        // any item inbetween the first and the last item will be removed
-        else {
-          last.m_item->m_next = current.m_item->m_next;
-        }
-        current.m_item->m_next = nullptr;
-        return current.m_item;
-      }
-      // keep going as long as the end is not reached yet
-      else if (current != this->_last) {
-        last = current;
-        ++current;
-      }
-      // break the loop when all items have been checked
-      else {
-        return nullptr;
-      }
-    }
-  }
+  return this->m_count;
 }
 
-template<typename T>
-inline bool sldlist<T>::operator==(const sldlist& l) const
+////////////////////////////////////////////////////////////////////////////////
+// LOCK POLICIES                                                              //
+////////////////////////////////////////////////////////////////////////////////
+
+// UNLOCKED ////////////////////////////////////////////////////////////////////
+
+inline void unlocked::lock()
 {
-  return (this->_first == l._first) && (this->_last == l._last);
+  return;
 }
 
-template<typename T>
-inline bool sldlist<T>::operator!=(const sldlist& l) const
+inline void unlocked::unlock()
 {
-  return (this->_first != l._first) || (this->_last != l._last);
+  return;
 }
 
-template<typename T>
-inline typename sldlist<T>::iterator sldlist<T>::front() const
+// _LOCKGUARD //////////////////////////////////////////////////////////////////
+
+template<typename LOCK>
+inline _lockguard<LOCK>::_lockguard(LOCK& lock) :
+  m_first(lock), m_second(nullptr)
 {
-  return this->_first;
+  this->m_first.lock();
 }
 
-template<typename T>
-inline typename sldlist<T>::iterator sldlist<T>::back() const
+template<typename LOCK>
+inline _lockguard<LOCK>::_lockguard(LOCK& a, LOCK& b) :
+  m_first(std::less<LOCK*>()(&b, &a) ? b : a), m_second((&a == &b) ? nullptr : (std::less<LOCK*>()(&b, &a) ? &a : &b))
 {
-  return this->_last;
+  this->m_first.lock();
+  if (this->m_second != nullptr) {
+    this->m_second->lock();
+  }
 }
 
-template<typename T>
-void sldlist<T>::push_front(item& i)
+template<typename LOCK>
+inline _lockguard<LOCK>::~_lockguard()
 {
-  assert(!i.attached());
-
-  // if the list is empty, initialize both iterators
-  if (this->empty()) {
-    this->_first.m_item = &i;
-    this->_last.m_item = &i;
-    return;
-  }
-  // append the item at the front
-  else {
-    i.m_next = this->_first.m_item;
-    this->_first.m_item = &i;
-    return;
+  if (this->m_second != nullptr) {
+    this->m_second->unlock();
   }
+  this->m_first.unlock();
 }
 
-template<typename T>
-void sldlist<T>::push_back(item& i)
-{
-  assert(!i.attached());
+////////////////////////////////////////////////////////////////////////////////
+// BASIC DLIST                                                                //
+////////////////////////////////////////////////////////////////////////////////
 
-  // if the list is empty, initialize both iterators
-  if (this->empty()) {
-    this->_first.m_item = &i;
-    this->_last.m_item = &i;
-    return;
+// PRIVATE FUNCTIONS ///////////////////////////////////////////////////////////
+
+template<linked_t LINKED, order_t ORDER, topology_t TOPOLOGY, typename T, typename SIZE, typename LOCK>
+inline typename basic_dlist<LINKED, ORDER, TOPOLOGY, T, SIZE, LOCK>::item* basic_dlist<LINKED, ORDER, TOPOLOGY, T, SIZE, LOCK>::_first() const
+{
+  // the first item of a circular dlist follows the last one
+  if constexpr (TOPOLOGY == CIRCULAR) {
+    return (this->m_head != nullptr) ? static_cast<item*>(this->m_head->m_next) : nullptr;
   }
-  // append the item at the back
   else {
-    this->_last.m_item->m_next = &i;
-    ++this->_last;
-    return;
+    return this->m_head;
   }
 }
 
-template<typename T>
-typename sldlist<T>::item* sldlist<T>::pop_front()
+template<linked_t LINKED, order_t ORDER, topology_t TOPOLOGY, typename T, typename SIZE, typename LOCK>
+inline typename basic_dlist<LINKED, ORDER, TOPOLOGY, T, SIZE, LOCK>::item* basic_dlist<LINKED, ORDER, TOPOLOGY, T, SIZE, LOCK>::_last() const
 {
-  // if the list is empty, return immediately
-  if (this->empty()) {
-    return nullptr;
-  }
-  // if the last item will be removed, invalidate the iterators
-  else if (this->_first == this->_last) {
-    item* i(this->_first.m_item);
-    this->_first.m_item = nullptr;
-    this->_last.m_item = nullptr;
-    i->m_next = nullptr;
-    return i;
+  // a circular dlist points to its last item
+  if constexpr (TOPOLOGY == CIRCULAR) {
+    return this->m_head;
   }
-  // remove the first item
   else {
-    item* i(this->_first.m_item);
-    ++this->_first;
-    i->m_next = nullptr;
-    return i;
+    return this->m_tail.m_value;
   }
 }
 
-template<typename T>
-typename sldlist<T>::item* sldlist<T>::pop_back()
+template<linked_t LINKED, order_t ORDER, topology_t TOPOLOGY, typename T, typename SIZE, typename LOCK>
+inline typename basic_dlist<LINKED, ORDER, TOPOLOGY, T, SIZE, LOCK>::item* basic_dlist<LINKED, ORDER, TOPOLOGY, T, SIZE, LOCK>::_next(const item* i) const
 {
-  // if the list is empty, return immediately
-  if (this->empty()) {
-    return nullptr;
+  // the last item of a circular dlist links to the first one
+  if constexpr (TOPOLOGY == CIRCULAR) {
+    return (i != this->m_head) ? static_cast<item*>(i->m_next) : nullptr;
   }
-  // if the last item will be removed, invalidate the iterators
-  else if (this->_first == this->_last) {
-    item* i(this->_last.m_item);
-    this->_first.m_item = nullptr;
-    this->_last.m_item = nullptr;
-    i->m_next = nullptr;
-    return i;
-  }
-  // remove the last item
   else {
-    item* i(this->_last.m_item);
-    // find the item before the last
-    iterator it(this->_first);
-    while (it.m_item->m_next != this->_last.m_item) {
-      ++it;
-    }
-    this->_last = it;
-    this->_last.m_item->m_next = nullptr;
-    return i;
+    return static_cast<item*>(i->m_next);
   }
 }
 
-// SINGLY LINKED ORDERED DLIST /////////////////////////////////////////////////
-
-template<typename T>
-slodlist<T>::slodlist(cmp_f& cmp) :
-  _sldlist<ORDERED, T>(), m_min(), m_max(), m_cmp(cmp)
-{}
-
-template<typename T>
-inline bool slodlist<T>::empty() const
+template<linked_t LINKED, order_t ORDER, topology_t TOPOLOGY, typename T, typename SIZE, typename LOCK>
+inline typename basic_dlist<LINKED, ORDER, TOPOLOGY, T, SIZE, LOCK>::item* basic_dlist<LINKED, ORDER, TOPOLOGY, T, SIZE, LOCK>::_prev(const item* i) const
 {
-  assert(!((this->m_min.m_item == nullptr) ^ (this->m_max.m_item == nullptr)));
+  static_assert(LINKED == DOUBLY_LINKED, "only doubly linked items know their predecessor");
 
-  return (this->m_min.m_item == nullptr);
+  // the first item of a circular dlist links back to the last one
+  if constexpr (TOPOLOGY == CIRCULAR) {
+    return (i->m_prev != this->m_head) ? static_cast<item*>(i->m_prev) : nullptr;
+  }
+  // the first item of a linear dlist links back to the terminator
+  else {
+    return (i->m_prev != &item::_head) ? static_cast<item*>(i->m_prev) : nullptr;
+  }
 }
 
-template<typename T>
-size_t slodlist<T>::size() const
+template<linked_t LINKED, order_t ORDER, topology_t TOPOLOGY, typename T, typename SIZE, typename LOCK>
+size_t basic_dlist<LINKED, ORDER, TOPOLOGY, T, SIZE, LOCK>::_count() const
 {
+  // a counted dlist knows its size
+  if constexpr (SIZE::COUNTED) {
+    return this->m_size.count();
+  }
   // if the list is empty, return immediately
-  if (this->empty()) {
+  else if (this->m_head == nullptr) {
     return 0;
   }
   // iterate through the list
   else {
     size_t cnt(1);
-    iterator it(this->m_min);
-    while (it != this->m_max) {
-      ++it;
+    const item* const last(this->_last());
+    for (const item* i = this->_first(); i != last; i = static_cast<const item*>(i->m_next)) {
       ++cnt;
     }
     return cnt;
   }
 }
 
-template<typename T>
-bool slodlist<T>::contains(const T& d) const
+template<linked_t LINKED, order_t ORDER, topology_t TOPOLOGY, typename T, typename SIZE, typename LOCK>
+void basic_dlist<LINKED, ORDER, TOPOLOGY, T, SIZE, LOCK>::_link(item* prev, item& i)
 {
-  // if the list is empty, return immediately
-  if (this->empty()) {
-    return false;
+  if constexpr (TOPOLOGY == LINEAR) {
+    item* next((prev != nullptr) ? static_cast<item*>(prev->m_next) : this->m_head);
+    // link the item in forward direction
+    i.m_next = next;
+    if (prev == nullptr) {
+      this->m_head = &i;
+    }
+    else {
+      prev->m_next = &i;
+    }
+    // link the item in backward direction, where the first item links back to the terminator
+    if constexpr (LINKED == DOUBLY_LINKED) {
+      i.m_prev = (prev != nullptr) ? static_cast<_dlitem*>(prev) : &item::_head;
+      if (next != nullptr) {
+        next->m_prev = &i;
+      }
+    }
+    // the item becomes the last one if it has no successor
+    if (next == nullptr) {
+      this->m_tail.m_value = &i;
+    }
   }
-  // iterate through the list and search for d
   else {
-    iterator it(this->m_min);
-    while (true) {
-      // test for d
-      if (&(it.m_item->m_data) == &d) {
-        return true;
+    // if the list is empty, the item links to itself
+    if (this->m_head == nullptr) {
+      i.m_next = &i;
+      if constexpr (LINKED == DOUBLY_LINKED) {
+        i.m_prev = &i;
       }
-      // keep going as long as the end is not reached yet
-      else if (it != this->m_max) {
-        ++it;
+      this->m_head = &i;
+    }
+    // link the item into the ring, where the predecessor of the first position is the last item
+    else {
+      item* ring_prev((prev != nullptr) ? prev : this->m_head);
+      item* ring_next(static_cast<item*>(ring_prev->m_next));
+      i.m_next = ring_next;
+      ring_prev->m_next = &i;
+      if constexpr (LINKED == DOUBLY_LINKED) {
+        i.m_prev = ring_prev;
+        ring_next->m_prev = &i;
       }
-      // break the loop when all items have been checked
-      else {
-        return false;
+      // the item becomes the last one if it is linked behind the last one
+      if (prev == this->m_head) {
+        this->m_head = &i;
       }
     }
   }
+  this->m_size.added(1);
+  return;
 }
 
-template<typename T>
-size_t slodlist<T>::clear()
+template<linked_t LINKED, order_t ORDER, topology_t TOPOLOGY, typename T, typename SIZE, typename LOCK>
+void basic_dlist<LINKED, ORDER, TOPOLOGY, T, SIZE, LOCK>::_unlink(item* prev, item& i)
 {
-  size_t cnt(0);
-  // pop all elements
-  while (this->removeMin() != nullptr) {
-    ++cnt;
+  if constexpr (TOPOLOGY == LINEAR) {
+    item* next(static_cast<item*>(i.m_next));
+    // bypass the item in forward direction
+    if (prev == nullptr) {
+      this->m_head = next;
+    }
+    else {
+      prev->m_next = next;
+    }
+    // bypass the item in backward direction
+    if (next == nullptr) {
+      this->m_tail.m_value = prev;
+    }
+    else if constexpr (LINKED == DOUBLY_LINKED) {
+      next->m_prev = i.m_prev;
+    }
   }
-  return cnt;
+  else {
+    // if the last item will be removed, the list becomes empty
+    if (i.m_next == &i) {
+      this->m_head = nullptr;
+    }
+    // bypass the item in the ring, where the predecessor of the first item is the last one
+    else {
+      item* ring_prev((prev != nullptr) ? prev : this->m_head);
+      ring_prev->m_next = i.m_next;
+      if constexpr (LINKED == DOUBLY_LINKED) {
+        static_cast<item*>(i.m_next)->m_prev = ring_prev;
+      }
+      if (&i == this->m_head) {
+        this->m_head = ring_prev;
+      }
+    }
+  }
+  i.m_next = nullptr;
+  if constexpr (LINKED == DOUBLY_LINKED) {
+    i.m_prev = nullptr;
+  }
+  this->m_size.removed(1);
+  return;
 }
 
-template<typename T>
-typename slodlist<T>::item* slodlist<T>::remove(const T& rm)
+template<linked_t LINKED, order_t ORDER, topology_t TOPOLOGY, typename T, typename SIZE, typename LOCK>
+void basic_dlist<LINKED, ORDER, TOPOLOGY, T, SIZE, LOCK>::_detach(item* prev, item& first, item& last, const size_t cnt)
 {
-  // if the list is empty, return immediately
-  if (this->empty()) {
-    return nullptr;
+  if constexpr (TOPOLOGY == LINEAR) {
+    item* next(static_cast<item*>(last.m_next));
+    // bypass the range in forward direction
+    if (prev == nullptr) {
+      this->m_head = next;
+    }
+    else {
+      prev->m_next = next;
+    }
+    // bypass the range in backward direction
+    if (next == nullptr) {
+      this->m_tail.m_value = prev;
+    }
+    else if constexpr (LINKED == DOUBLY_LINKED) {
+      next->m_prev = first.m_prev;
+    }
   }
-  // iterate through the list and remove the first item poining to rm
   else {
-    iterator current(this->m_min);
-    iterator last;
-    while (true) {
-      // test for rm
-      if (&(current.m_item->m_data) == &rm) {
-        // the minimum item matches
-        if (current == this->m_min) {
-          // if the last item will be removed, set all pointers accordingly
-          if (this->m_min == this->m_max) {
-            this->m_min.m_item = nullptr;
-            this->m_max.m_item = nullptr;
-          }
-          // increase the m_min iterator
-          else {
-            ++this->m_min;
-          }
-        }
-        // the maximum item matches
-        else if (current == this->m_max) {
-          this->m_max = last;
-          this->m_max.m_item->m_next = nullptr;
-        }
-        // any item inbetween the minimum and the maximum will be removed
-        else {
-          last.m_item->m_next = current.m_item->m_next;
-        }
-        current.m_item->m_next = nullptr;
-        return current.m_item;
-      }
-      // keep going as long as the end is not reached yet
-      else if (current != this->m_max) {
-        last = current;
-        ++current;
+    // if the range covers all items, the list becomes empty
+    if (last.m_next == &first) {
+      this->m_head = nullptr;
+    }
+    // bypass the range in the ring, where the predecessor of the first item is the last one
+    else {
+      item* ring_prev((prev != nullptr) ? prev : this->m_head);
+      ring_prev->m_next = last.m_next;
+      if constexpr (LINKED == DOUBLY_LINKED) {
+        static_cast<item*>(last.m_next)->m_prev = ring_prev;
       }
-      // break the loop when all items have been checked
-      else {
-        return nullptr;
+      if (&last == this->m_head) {
+        this->m_head = ring_prev;
       }
     }
   }
+  last.m_next = nullptr;
+  this->m_size.removed(cnt);
+  return;
 }
 
-template<typename T>
-inline bool slodlist<T>::operator==(const slodlist& l) const
+template<linked_t LINKED, order_t ORDER, topology_t TOPOLOGY, typename T, typename SIZE, typename LOCK>
+void basic_dlist<LINKED, ORDER, TOPOLOGY, T, SIZE, LOCK>::_append(item& first, item& last, const size_t cnt)
 {
-  return (this->m_min == l.m_min) && (this->m_max == l.m_max) && (this->m_cmp == l.m_cmp);
-}
+  static_assert(ORDER == UNORDERED, "items can only be appended to unordered dlists");
 
-template<typename T>
-inline bool slodlist<T>::operator!=(const slodlist& l) const
-{
-  return (this->m_min != l.m_min) || (this->m_max != l.m_max) || (this->m_cmp != l.m_cmp);
+  _lockguard<LOCK> guard(this->m_lock);
+  if constexpr (TOPOLOGY == LINEAR) {
+    if constexpr (LINKED == DOUBLY_LINKED) {
+      first.m_prev = (this->m_head != nullptr) ? static_cast<_dlitem*>(this->m_tail.m_value) : &item::_head;
+    }
+    // if the list is empty, take over the chain
+    if (this->m_head == nullptr) {
+      this->m_head = &first;
+    }
+    // link the chain behind the last item
+    else {
+      this->m_tail.m_value->m_next = &first;
+    }
+    this->m_tail.m_value = &last;
+  }
+  else {
+    // if the list is empty, close the chain to a ring
+    if (this->m_head == nullptr) {
+      last.m_next = &first;
+      if constexpr (LINKED == DOUBLY_LINKED) {
+        first.m_prev = &last;
+      }
+    }
+    // link the chain between the last and the first item
+    else {
+      item* eldest(static_cast<item*>(this->m_head->m_next));
+      last.m_next = eldest;
+      this->m_head->m_next = &first;
+      if constexpr (LINKED == DOUBLY_LINKED) {
+        first.m_prev = this->m_head;
+        eldest->m_prev = &last;
+      }
+    }
+    this->m_head = &last;
+  }
+  this->m_size.added(cnt);
+  return;
 }
 
-template<typename T>
-inline typename slodlist<T>::iterator slodlist<T>::min() const
+template<linked_t LINKED, order_t ORDER, topology_t TOPOLOGY, typename T, typename SIZE, typename LOCK>
+size_t basic_dlist<LINKED, ORDER, TOPOLOGY, T, SIZE, LOCK>::_clear()
 {
-  return this->m_min;
+  size_t cnt(0);
+  item* const last(this->_last());
+  item* i(this->_first());
+  // reset the links of all items
+  while (i != nullptr) {
+    item* next((i != last) ? static_cast<item*>(i->m_next) : nullptr);
+    i->m_next = nullptr;
+    if constexpr (LINKED == DOUBLY_LINKED) {
+      i->m_prev = nullptr;
+    }
+    ++cnt;
+    i = next;
+  }
+  this->m_head = nullptr;
+  if constexpr (TOPOLOGY == LINEAR) {
+    this->m_tail.m_value = nullptr;
+  }
+  this->m_size.removed(cnt);
+  return cnt;
 }
 
-template<typename T>
-inline typename slodlist<T>::iterator slodlist<T>::max() const
+template<linked_t LINKED, order_t ORDER, topology_t TOPOLOGY, typename T, typename SIZE, typename LOCK>
+void basic_dlist<LINKED, ORDER, TOPOLOGY, T, SIZE, LOCK>::_swap(basic_dlist& l)
 {
-  return this->m_max;
+  std::swap(this->m_head, l.m_head);
+  std::swap(this->m_tail, l.m_tail);
+  std::swap(this->m_cmp, l.m_cmp);
+  std::swap(this->m_size, l.m_size);
+  return;
 }
 
-template<typename T>
-void slodlist<T>::insert(item& i)
+template<linked_t LINKED, order_t ORDER, topology_t TOPOLOGY, typename T, typename SIZE, typename LOCK>
+void basic_dlist<LINKED, ORDER, TOPOLOGY, T, SIZE, LOCK>::_push_front(item& i)
 {
   assert(!i.attached());
 
-  // if the list is empty, initialize it
-  if (this->empty()) {
-    this->m_min.m_item = &i;
-    this->m_max.m_item = &i;
-    return;
+  if constexpr (TOPOLOGY == LINEAR) {
+    if constexpr (LINKED == DOUBLY_LINKED) {
+      i.m_prev = &item::_head;
+    }
+    // if the list is empty, the item is the last one as well
+    if (this->m_head == nullptr) {
+      this->m_tail.m_value = &i;
+    }
+    // link the item in front of the first one
+    else {
+      i.m_next = this->m_head;
+      if constexpr (LINKED == DOUBLY_LINKED) {
+        this->m_head->m_prev = &i;
+      }
+    }
+    this->m_head = &i;
   }
-  // iterate through the list and insert the item at the correct location
   else {
-    iterator current(this->m_min);
-    iterator last;
-    while (true) {
-      // check, whether i is smaller compared to the current item
-      if (!this->m_cmp(*current, *i)) {
-        // special case: if i is smaller than the first item, prepend it
-        if (current == this->m_min) {
-          i.m_next = this->m_min.m_item;
-          this->m_min.m_item = &i;
-        }
-        // insert the item
-        else {
-          last.m_item->m_next = &i;
-          i.m_next = current.m_item;
-        }
-        return;
-      }
-      // if all items in the list are smaller, append it
-      else if (current == this->m_max) {
-        this->m_max.m_item->m_next = &i;
-        ++this->m_max;
-        return;
+    // if the list is empty, the item links to itself and is the last one as well
+    if (this->m_head == nullptr) {
+      i.m_next = &i;
+      if constexpr (LINKED == DOUBLY_LINKED) {
+        i.m_prev = &i;
       }
-      // keep going as long as the end is not reached yet
-      else {
-        last = current;
-        ++current;
+      this->m_head = &i;
+    }
+    // link the item between the last and the first one
+    else {
+      item* first(static_cast<item*>(this->m_head->m_next));
+      i.m_next = first;
+      this->m_head->m_next = &i;
+      if constexpr (LINKED == DOUBLY_LINKED) {
+        i.m_prev = this->m_head;
+        first->m_prev = &i;
       }
     }
   }
+  this->m_size.added(1);
+  return;
 }
 
-template<typename T>
-typename slodlist<T>::item* slodlist<T>::removeMin()
+template<linked_t LINKED, order_t ORDER, topology_t TOPOLOGY, typename T, typename SIZE, typename LOCK>
+void basic_dlist<LINKED, ORDER, TOPOLOGY, T, SIZE, LOCK>::_push_back(item& i)
 {
-  // if the list is empty, return immediately
-  if (this->empty()) {
-    return nullptr;
-  }
-  // if the last item will be removed, invalidate the iterators
-  else if (this->m_min == this->m_max) {
-    item* i(this->m_min.m_item);
-    this->m_min.m_item = nullptr;
-    this->m_max.m_item = nullptr;
-    i->m_next = nullptr;
-    return i;
+  if constexpr (TOPOLOGY == LINEAR) {
+    assert(!i.attached());
+
+    // if the list is empty, the item is the first one as well
+    if (this->m_head == nullptr) {
+      if constexpr (LINKED == DOUBLY_LINKED) {
+        i.m_prev = &item::_head;
+      }
+      this->m_head = &i;
+    }
+    // link the item behind the last one
+    else {
+      if constexpr (LINKED == DOUBLY_LINKED) {
+        i.m_prev = this->m_tail.m_value;
+      }
+      this->m_tail.m_value->m_next = &i;
+    }
+    this->m_tail.m_value = &i;
+    this->m_size.added(1);
   }
-  // remove the smallest item
+  // link the item in front of the first one and move the ring, so it becomes the last one
   else {
-    item* i(this->m_min.m_item);
-    ++this->m_min;
-    i->m_next = nullptr;
-    return i;
+    this->_push_front(i);
+    this->m_head = &i;
   }
+  return;
 }
 
-template<typename T>
-typename slodlist<T>::item* slodlist<T>::removeMax()
+template<linked_t LINKED, order_t ORDER, topology_t TOPOLOGY, typename T, typename SIZE, typename LOCK>
+typename basic_dlist<LINKED, ORDER, TOPOLOGY, T, SIZE, LOCK>::item* basic_dlist<LINKED, ORDER, TOPOLOGY, T, SIZE, LOCK>::_pop_front()
 {
   // if the list is empty, return immediately
-  if (this->empty()) {
+  if (this->m_head == nullptr) {
     return nullptr;
   }
-  // if the last item will be removed, invalidate the iterators
-  else if (this->m_min == this->m_max) {
-    item* i(this->m_max.m_item);
-    this->m_min.m_item = nullptr;
-    this->m_max.m_item = nullptr;
-    i->m_next = nullptr;
-    return i;
+  item* i(this->_first());
+  // if the last item will be removed, the list becomes empty
+  if (i == this->_last()) {
+    this->m_head = nullptr;
+    if constexpr (TOPOLOGY == LINEAR) {
+      this->m_tail.m_value = nullptr;
+    }
+  }
+  // the second item becomes the first one
+  else if constexpr (TOPOLOGY == LINEAR) {
+    this->m_head = static_cast<item*>(i->m_next);
+    if constexpr (LINKED == DOUBLY_LINKED) {
+      this->m_head->m_prev = &item::_head;
+    }
   }
-  // remove the largest item
+  // bypass the first item in the ring
   else {
-    item* i(this->m_max.m_item);
-    // find the item before the last
-    iterator it(this->m_min);
-    while (it.m_item->m_next != this->m_max.m_item) {
-      ++it;
+    this->m_head->m_next = i->m_next;
+    if constexpr (LINKED == DOUBLY_LINKED) {
+      static_cast<item*>(i->m_next)->m_prev = this->m_head;
     }
-    this->m_max = it;
-    this->m_max.m_item->m_next = nullptr;
-    return i;
   }
+  i->m_next = nullptr;
+  if constexpr (LINKED == DOUBLY_LINKED) {
+    i->m_prev = nullptr;
+  }
+  this->m_size.removed(1);
+  return i;
 }
 
-template<typename T>
-void slodlist<T>::sort()
-{
-  // if the list contains less than two items, return immediately
-  if (this->m_min.m_item == this->m_max.m_item) {
-    return;
-  }
-  // clear the list, and reinsert all items
-  else {
-    // initialize temporary iterators and item pointer
-    iterator min_tmp(this->m_min);
-    iterator max_tmp(this->m_max);
-    item* i(nullptr);
-
-    // reset the list
-    this->m_min.m_item = nullptr;
-    this->m_max.m_item = nullptr;
-
-    // re-insert all items
-    bool abort(false);
-    while (!abort) {
-      // check if this is the last iteration
-      abort = (min_tmp == max_tmp);
-
-      // detach and item and re-insert it in this list
-      i = min_tmp.m_item;
-      ++min_tmp;
-      i->m_next = nullptr;
-      this->insert(*i);
-    }
-
-    return;
-  }
-}
-
-// SINGLY LINKED CIRCULAR DLIST ////////////////////////////////////////////////
-
-template<typename T>
-slcdlist<T>::slcdlist() :
-  _sldlist<CIRCULAR, T>(), m_latest()
-{}
-
-template<typename T>
-inline bool slcdlist<T>::empty() const
-{
-  return (this->m_latest.m_item == nullptr);
-}
-
-template<typename T>
-size_t slcdlist<T>::size() const
+template<linked_t LINKED, order_t ORDER, topology_t TOPOLOGY, typename T, typename SIZE, typename LOCK>
+typename basic_dlist<LINKED, ORDER, TOPOLOGY, T, SIZE, LOCK>::item* basic_dlist<LINKED, ORDER, TOPOLOGY, T, SIZE, LOCK>::_pop_back()
 {
   // if the list is empty, return immediately
-  if (this->empty()) {
-    return 0;
-  }
-  // iterate through the list
-  else {
-    size_t cnt(0);
-    iterator it(this->m_latest);
-    do {
-      ++it;
-      ++cnt;
-    } while (it != this->m_latest);
-    return cnt;
+  if (this->m_head == nullptr) {
+    return nullptr;
   }
-}
-
-template<typename T>
-bool slcdlist<T>::contains(const T& d) const
-{
-  // if the list is empty, return immediately
-  if (this->empty()) {
-    return false;
+  item* i(this->_last());
+  item* first(this->_first());
+  // if the last item will be removed, the list becomes empty
+  if (i == first) {
+    this->m_head = nullptr;
+    if constexpr (TOPOLOGY == LINEAR) {
+      this->m_tail.m_value = nullptr;
+    }
   }
-  // iterate through the list and search for d
+  // the second last item becomes the last one
   else {
-    iterator it(this->m_latest);
-    while (true) {
-      // test for d
-      if (&(it.m_item->m_data) == &d) {
-        return true;
+    item* prev(first);
+    if constexpr (LINKED == DOUBLY_LINKED) {
+      prev = static_cast<item*>(i->m_prev);
+    }
+    // search the second last item from the first one on
+    else {
+      while (prev->m_next != i) {
+        prev = static_cast<item*>(prev->m_next);
       }
-      // keep going as long as the end is not reached yet
-      else {
-        ++it;
-        // break the loop when all items have been checked
-        if (it == this->m_latest) {
-          return false;
-        }
+    }
+    prev->m_next = i->m_next;
+    if constexpr (TOPOLOGY == LINEAR) {
+      this->m_tail.m_value = prev;
+    }
+    else {
+      if constexpr (LINKED == DOUBLY_LINKED) {
+        first->m_prev = prev;
       }
+      this->m_head = prev;
     }
   }
+  i->m_next = nullptr;
+  if constexpr (LINKED == DOUBLY_LINKED) {
+    i->m_prev = nullptr;
+  }
+  this->m_size.removed(1);
+  return i;
 }
 
-template<typename T>
-size_t slcdlist<T>::clear()
+template<linked_t LINKED, order_t ORDER, topology_t TOPOLOGY, typename T, typename SIZE, typename LOCK>
+void basic_dlist<LINKED, ORDER, TOPOLOGY, T, SIZE, LOCK>::_insert(item& i)
 {
-  size_t cnt(0);
-  // remove all elements
-  while (this->remove_eldest() != nullptr) {
-    ++cnt;
+  assert(!i.attached());
+
+  // search the last item that is smaller, so the item is inserted in front of the first one that is not
+  item* prev(nullptr);
+  item* current(this->_first());
+  while (current != nullptr && this->m_cmp.m_value(**current, *i)) {
+    prev = current;
+    current = this->_next(current);
   }
-  return cnt;
+  this->_link(prev, i);
+  return;
 }
 
-template<typename T>
-typename slcdlist<T>::item* slcdlist<T>::remove(const T& rm)
+template<linked_t LINKED, order_t ORDER, topology_t TOPOLOGY, typename T, typename SIZE, typename LOCK>
+typename basic_dlist<LINKED, ORDER, TOPOLOGY, T, SIZE, LOCK>::item* basic_dlist<LINKED, ORDER, TOPOLOGY, T, SIZE, LOCK>::_bound(const T& key, const bool upper) const
 {
   // if the list is empty, return immediately
-  if (this->empty()) {
+  if (this->m_head == nullptr) {
     return nullptr;
   }
-  // iterate through the list and remove the first item poitning to rm
-  else {
-    iterator current(this->m_latest);
-    ++current;
-    iterator last(this->m_latest);
+  // approach the boundary from both ends alternately
+  else if constexpr (LINKED == DOUBLY_LINKED) {
+    item* forward(this->_first());
+    item* backward(this->_last());
     while (true) {
-      // test for rm
-      if (&(current.m_item->m_data) == &rm) {
-        // if the m_latest item matches
-        if (current == this->m_latest) {
-          // if the last item will be removed, set all pointers accordingly
-          if (this->m_latest.m_item->m_next == this->m_latest.m_item) {
-            item* i(this->m_latest.m_item);
-            this->m_latest.m_item = nullptr;
-            return i;
-          }
-          // decrease the m_latest iterator
-          else {
-            this->m_latest = last;
-          }
-        }
-        last.m_item->m_next = current.m_item->m_next;
-        current.m_item->m_next = nullptr;
-        return current.m_item;
+      // the first item from the minimum on that does not belong before the key is the boundary
+      if (!(upper ? !this->m_cmp.m_value(key, **forward) : this->m_cmp.m_value(**forward, key))) {
+        return forward;
       }
-      // keep going as long as the end is not reached yet
-      else if (current != this->m_latest) {
-        last = current;
-        ++current;
-      }
-      // break the loop when all items have been checked
-      else {
-        return nullptr;
+      // the first item from the maximum on that belongs before the key precedes the boundary
+      if (upper ? !this->m_cmp.m_value(key, **backward) : this->m_cmp.m_value(**backward, key)) {
+        return this->_next(backward);
       }
+      forward = this->_next(forward);
+      backward = this->_prev(backward);
+    }
+  }
+  // skip all items that belong before the key, and stop at the first one that does not
+  else {
+    item* current(this->_first());
+    while (current != nullptr && (upper ? !this->m_cmp.m_value(key, **current) : this->m_cmp.m_value(**current, key))) {
+      current = this->_next(current);
     }
+    return current;
   }
 }
 
-template<typename T>
-inline bool slcdlist<T>::operator==(const slcdlist& l) const
-{
-  return (this->m_latest == l.m_latest);
-}
+// GENERAL INTERFACE ///////////////////////////////////////////////////////////
 
-template<typename T>
-inline bool slcdlist<T>::operator!=(const slcdlist& l) const
+template<linked_t LINKED, order_t ORDER, topology_t TOPOLOGY, typename T, typename SIZE, typename LOCK>
+basic_dlist<LINKED, ORDER, TOPOLOGY, T, SIZE, LOCK>::basic_dlist() :
+  m_head(nullptr), m_tail(nullptr), m_cmp(nullptr), m_size(), m_lock()
 {
-  return (this->m_latest != l.m_latest);
+  // ordered dlists use the default compare function
+  if constexpr (ORDER == ORDERED) {
+    this->m_cmp.m_value = &_defaultCmp<T>;
+  }
 }
 
-template<typename T>
-inline typename slcdlist<T>::iterator slcdlist<T>::latest() const
+template<linked_t LINKED, order_t ORDER, topology_t TOPOLOGY, typename T, typename SIZE, typename LOCK>
+basic_dlist<LINKED, ORDER, TOPOLOGY, T, SIZE, LOCK>::basic_dlist(cmp_f& cmp) :
+  m_head(nullptr), m_tail(nullptr), m_cmp(&cmp), m_size(), m_lock()
 {
-  return this->m_latest;
+  static_assert(ORDER == ORDERED, "only ordered dlists take a compare function");
 }
 
-template<typename T>
-inline typename slcdlist<T>::iterator slcdlist<T>::eldest() const
+template<linked_t LINKED, order_t ORDER, topology_t TOPOLOGY, typename T, typename SIZE, typename LOCK>
+basic_dlist<LINKED, ORDER, TOPOLOGY, T, SIZE, LOCK>::basic_dlist(basic_dlist&& l) :
+  m_head(nullptr), m_tail(nullptr), m_cmp(l.m_cmp), m_size(), m_lock()
 {
-  iterator it(this->m_latest);
-  ++it;
-  return it;
+  _lockguard<LOCK> guard(l.m_lock);
+  this->_swap(l);
 }
 
-template<typename T>
-void slcdlist<T>::insert(item& i)
+template<linked_t LINKED, order_t ORDER, topology_t TOPOLOGY, typename T, typename SIZE, typename LOCK>
+basic_dlist<LINKED, ORDER, TOPOLOGY, T, SIZE, LOCK>& basic_dlist<LINKED, ORDER, TOPOLOGY, T, SIZE, LOCK>::operator=(basic_dlist&& l)
 {
-  assert(!i.attached());
-
-  // if the list is empty, initialize its iterator and the items m_next pointer
-  if (this->empty()){
-    this->m_latest.m_item = &i;
-    i.m_next = &i;
-    return;
-  }
-  // insert the item as the m_latest
-  else {
-    i.m_next = this->m_latest.m_item->m_next;
-    this->m_latest.m_item->m_next = &i;
-    ++this->m_latest;
-    return;
+  // remove all items before taking over the ones of the other list
+  if (this != &l) {
+    _lockguard<LOCK> guard(this->m_lock, l.m_lock);
+    this->_clear();
+    this->_swap(l);
   }
+  return *this;
 }
 
-template<typename T>
-typename slcdlist<T>::item* slcdlist<T>::removeLatest()
+template<linked_t LINKED, order_t ORDER, topology_t TOPOLOGY, typename T, typename SIZE, typename LOCK>
+void basic_dlist<LINKED, ORDER, TOPOLOGY, T, SIZE, LOCK>::swap(basic_dlist& l)
 {
-  // if the list is empty, return immediately
-  if (this->empty()) {
-    return nullptr;
-  }
-  // if the last item will be removed, invalidate the iterator
-  else if (this->m_latest.m_item->m_next == this->m_latest.m_item) {
-    item* i(this->m_latest.m_item);
-    this->m_latest.m_item = nullptr;
-    i->m_next = nullptr;
-    return i;
-  }
-  // remove the latest and decrement the iterator
-  else {
-    item* i(this->m_latest.m_item);
-    // search for the second latest item
-    iterator second_latest(this->m_latest);
-    ++second_latest;
-    while (second_latest.m_item->m_next != this->m_latest.m_item) {
-      ++second_latest;
-    }
-    second_latest.m_item->m_next = this->m_latest.m_item->m_next;
-    this->m_latest = second_latest;
-    i->m_next = nullptr;
-    return i;
+  if (this != &l) {
+    _lockguard<LOCK> guard(this->m_lock, l.m_lock);
+    this->_swap(l);
   }
+  return;
 }
 
-template<typename T>
-typename slcdlist<T>::item* slcdlist<T>::remove_eldest()
+template<linked_t LINKED, order_t ORDER, topology_t TOPOLOGY, typename T, typename SIZE, typename LOCK>
+inline bool basic_dlist<LINKED, ORDER, TOPOLOGY, T, SIZE, LOCK>::empty() const
 {
-  // if the list is empty, return immediately
-  if (this->empty()) {
-    return nullptr;
+  _lockguard<LOCK> guard(this->m_lock);
+  if constexpr (TOPOLOGY == LINEAR) {
+    assert(!((this->m_head == nullptr) ^ (this->m_tail.m_value == nullptr)));
   }
-  // if the last item will be removed, invalidate the iterator
-  else if (this->m_latest.m_item->m_next == this->m_latest.m_item) {
-    item* i(this->m_latest.m_item);
-    this->m_latest.m_item = nullptr;
-    i->m_next = nullptr;
-    return i;
-  }
-  // remove the eldest
-  else {
-    item* i(static_cast<item*>(this->m_latest.m_item->m_next));
-    this->m_latest.m_item->m_next = i->m_next;
-    i->m_next = nullptr;
-    return i;
-  }
-}
-
-////////////////////////////////////////////////////////////////////////////////
-// DOUBLY LINKED DLIST CLASSES                                                //
-////////////////////////////////////////////////////////////////////////////////
-
-// DOUBLY LINKED DLIST /////////////////////////////////////////////////////////
-
-template<typename T>
-dldlist<T>::dldlist() :
-  _dldlist<NONE, T>(), _first(), _last()
-{}
-
-template<typename T>
-inline bool dldlist<T>::empty() const
-{
-  assert(!((this->_first.m_item == nullptr) ^ (this->_last.m_item == nullptr)));
 
-  return (this->_first.m_item == nullptr);
+  return (this->m_head == nullptr);
 }
 
-template<typename T>
-size_t dldlist<T>::size() const
+template<linked_t LINKED, order_t ORDER, topology_t TOPOLOGY, typename T, typename SIZE, typename LOCK>
+size_t basic_dlist<LINKED, ORDER, TOPOLOGY, T, SIZE, LOCK>::size() const
 {
-  // if the list is empty, return immediately
-  if (this->empty()) {
-    return 0;
-  }
-  // iterate through the list
-  else {
-    size_t cnt(1);
-    iterator it(this->_first);
-    while (it != this->_last) {
-      ++it;
-      ++cnt;
-    }
-    return cnt;
-  }
+  _lockguard<LOCK> guard(this->m_lock);
+  return this->_count();
 }
 
-template<typename T>
-bool dldlist<T>::contains(const T& d) const
+template<linked_t LINKED, order_t ORDER, topology_t TOPOLOGY, typename T, typename SIZE, typename LOCK>
+bool basic_dlist<LINKED, ORDER, TOPOLOGY, T, SIZE, LOCK>::contains(const T& d) const
 {
+  _lockguard<LOCK> guard(this->m_lock);
   // if the list is empty, return immediately
-  if (this->empty()) {
+  if (this->m_head == nullptr) {
     return false;
   }
   // iterate through the list and search for d
   else {
-    iterator it(this->_first);
+    const item* const last(this->_last());
+    const item* i(this->_first());
     while (true) {
       // test for d
-      if (&(it.m_item->m_data) == &d) {
+      if (&(i->m_data) == &d) {
         return true;
       }
       // keep going as long as the end is not reached yet
-      else if (it != this->_last) {
-        ++it;
+      else if (i != last) {
+        i = static_cast<const item*>(i->m_next);
       }
-      // break the loop when all ites have been checked
+      // break the loop when all items have been checked
       else {
         return false;
       }
@@ -1225,687 +1149,518 @@ bool dldlist<T>::contains(const T& d) const
   }
 }
 
-template<typename T>
-size_t dldlist<T>::clear()
+template<linked_t LINKED, order_t ORDER, topology_t TOPOLOGY, typename T, typename SIZE, typename LOCK>
+size_t basic_dlist<LINKED, ORDER, TOPOLOGY, T, SIZE, LOCK>::clear()
 {
-  size_t cnt(0);
-  // pop all elements
-  while (this->pop_front() != nullptr) {
-    ++cnt;
-  }
-  return cnt;
+  _lockguard<LOCK> guard(this->m_lock);
+  return this->_clear();
 }
 
-template<typename T>
-typename dldlist<T>::item* dldlist<T>::remove(const T& rm)
+template<linked_t LINKED, order_t ORDER, topology_t TOPOLOGY, typename T, typename SIZE, typename LOCK>
+typename basic_dlist<LINKED, ORDER, TOPOLOGY, T, SIZE, LOCK>::item* basic_dlist<LINKED, ORDER, TOPOLOGY, T, SIZE, LOCK>::remove(const T& rm)
 {
-  // if the list is empty, return immediately
-  if (this->empty()) {
-    return nullptr;
+  _lockguard<LOCK> guard(this->m_lock);
+  // iterate through the list and remove the first item pointing to rm
+  item* prev(nullptr);
+  for (item* current = this->_first(); current != nullptr; current = this->_next(current)) {
+    if (&(current->m_data) == &rm) {
+      this->_unlink(prev, *current);
+      return current;
+    }
+    prev = current;
   }
-  // iterate throuh the list and remove the first item pointing to rm
-  else {
-    iterator current(this->_first);
-    while (true) {
-      // test for rm
-      if (&(current.m_item->m_data) == &rm) {
-        // the first item matches
-        if (current == this->_first) {
-          // if the last item will be reomved, set all pointers accordingly
-          if (this->_first == this->_last) {
-            this->_first.m_item = nullptr;
-            this->_last.m_item = nullptr;
-          }
-          // increase the _first iterator
-          else {
-            ++this->_first;
-            this->_first.m_item->m_prev = nullptr;
-          }
-        }
-        // the last item matches
-        else if (current.m_item == this->_last.m_item) {
-          --this->_last;
-          this->_last.m_item->m_next = nullptr;
+  return nullptr;
+}
+
+template<linked_t LINKED, order_t ORDER, topology_t TOPOLOGY, typename T, typename SIZE, typename LOCK>
+template<typename PRED, topology_t OTOPOLOGY, typename OSIZE, typename OLOCK>
+size_t basic_dlist<LINKED, ORDER, TOPOLOGY, T, SIZE, LOCK>::remove_if(PRED pred, basic_dlist<LINKED, UNORDERED, OTOPOLOGY, T, OSIZE, OLOCK>& out)
+{
+  size_t cnt(0);
+  item* first(nullptr);
+  item* last(nullptr);
+  {
+    _lockguard<LOCK> guard(this->m_lock);
+    // iterate through the list once and move all matching items to a chain
+    item* prev(nullptr);
+    item* current(this->_first());
+    while (current != nullptr) {
+      item* next(this->_next(current));
+      if (pred(**current)) {
+        this->_unlink(prev, *current);
+        if (last == nullptr) {
+          first = current;
         }
-        // any item inbetween the first and last item will be removed
         else {
-          static_cast<item*>(current.m_item->m_prev)->m_next = current.m_item->m_next;
-          static_cast<item*>(current.m_item->m_next)->m_prev = current.m_item->m_prev;
+          last->m_next = current;
+          if constexpr (LINKED == DOUBLY_LINKED) {
+            current->m_prev = last;
+          }
         }
-        current.m_item->m_prev = nullptr;
-        current.m_item->m_next = nullptr;
-        return current.m_item;
-      }
-      // keep goind as long as the end is not reached yet
-      else if (current != this->_last) {
-        ++current;
+        last = current;
+        ++cnt;
       }
-      // break the loop when all items have been checked
       else {
-        return nullptr;
+        prev = current;
       }
+      current = next;
     }
   }
+  // append the chain after the lock of this list has been released
+  if (first != nullptr) {
+    out._append(*first, *last, cnt);
+  }
+  return cnt;
 }
 
-template<typename T>
-inline bool dldlist<T>::operator==(const dldlist& l) const
+template<linked_t LINKED, order_t ORDER, topology_t TOPOLOGY, typename T, typename SIZE, typename LOCK>
+template<topology_t OTOPOLOGY, typename OSIZE, typename OLOCK>
+void basic_dlist<LINKED, ORDER, TOPOLOGY, T, SIZE, LOCK>::erase(const iterator& first, const iterator& last, basic_dlist<LINKED, UNORDERED, OTOPOLOGY, T, OSIZE, OLOCK>& out)
 {
-  return (this->_first == l._first) && (this->_last == l._last);
+  // if the range is empty, there is nothing to do
+  if (!first.valid() || first == last) {
+    return;
+  }
+  item* begin(first.m_item);
+  item* end(begin);
+  size_t cnt(0);
+  {
+    _lockguard<LOCK> guard(this->m_lock);
+    item* prev(nullptr);
+    if constexpr (LINKED == DOUBLY_LINKED) {
+      prev = this->_prev(begin);
+      end = last.valid() ? static_cast<item*>(last.m_item->m_prev) : this->_last();
+    }
+    else {
+      // search the predecessor of the range
+      if (begin != this->_first()) {
+        prev = this->_first();
+        while (prev->m_next != begin) {
+          prev = static_cast<item*>(prev->m_next);
+        }
+      }
+      // search the last item of the range, which ends at the last item at most
+      while (end != this->_last() && end->m_next != last.m_item) {
+        end = static_cast<item*>(end->m_next);
+      }
+    }
+    // count the range only if a counted list needs its size
+    if constexpr (SIZE::COUNTED || OSIZE::COUNTED) {
+      cnt = 1;
+      for (const item* i = begin; i != end; i = static_cast<const item*>(i->m_next)) {
+        ++cnt;
+      }
+    }
+    this->_detach(prev, *begin, *end, cnt);
+  }
+  // append the range after the lock of this list has been released
+  out._append(*begin, *end, cnt);
+  return;
 }
 
-template<typename T>
-inline bool dldlist<T>::operator!=(const dldlist& l) const
+template<linked_t LINKED, order_t ORDER, topology_t TOPOLOGY, typename T, typename SIZE, typename LOCK>
+bool basic_dlist<LINKED, ORDER, TOPOLOGY, T, SIZE, LOCK>::operator==(const basic_dlist& l) const
 {
-  return (this->_first != l._first) || (this->_last != l._last);
+  _lockguard<LOCK> guard(this->m_lock, l.m_lock);
+  if constexpr (ORDER == ORDERED) {
+    if (this->m_cmp.m_value != l.m_cmp.m_value) {
+      return false;
+    }
+  }
+  return (this->m_head == l.m_head) && (this->_last() == l._last());
 }
 
-template<typename T>
-inline typename dldlist<T>::iterator dldlist<T>::front() const
+template<linked_t LINKED, order_t ORDER, topology_t TOPOLOGY, typename T, typename SIZE, typename LOCK>
+inline bool basic_dlist<LINKED, ORDER, TOPOLOGY, T, SIZE, LOCK>::operator!=(const basic_dlist& l) const
 {
-  return this->_first;
+  return !(*this == l);
 }
 
-template<typename T>
-inline typename dldlist<T>::iterator dldlist<T>::back() const
-{
-  return this->_last;
-}
+// DEQUE INTERFACE /////////////////////////////////////////////////////////////
 
-template<typename T>
-void dldlist<T>::push_front(item& i)
+template<linked_t LINKED, order_t ORDER, topology_t TOPOLOGY, typename T, typename SIZE, typename LOCK>
+inline typename basic_dlist<LINKED, ORDER, TOPOLOGY, T, SIZE, LOCK>::iterator basic_dlist<LINKED, ORDER, TOPOLOGY, T, SIZE, LOCK>::front() const
 {
-  assert(!i.attached());
+  static_assert(ORDER == UNORDERED, "only unordered dlists provide the deque interface");
 
-  // if the list is empty, initialize both iterators
-  if (this->empty()) {
-    this->_first.m_item = &i;
-    this->_last.m_item = &i;
-    return;
-  }
-  // append the item at the front
-  else {
-    i.m_next = this->_first.m_item;
-    this->_first.m_item->m_prev = &i;
-    --this->_first;
-    return;
-  }
+  _lockguard<LOCK> guard(this->m_lock);
+  return iterator(this->_first());
 }
 
-template<typename T>
-void dldlist<T>::push_back(item& i)
+template<linked_t LINKED, order_t ORDER, topology_t TOPOLOGY, typename T, typename SIZE, typename LOCK>
+inline typename basic_dlist<LINKED, ORDER, TOPOLOGY, T, SIZE, LOCK>::iterator basic_dlist<LINKED, ORDER, TOPOLOGY, T, SIZE, LOCK>::back() const
 {
-  assert(!i.attached());
+  static_assert(ORDER == UNORDERED, "only unordered dlists provide the deque interface");
 
-  // if the list is empty, initialize both iterators
-  if (this->empty()) {
-    this->_first.m_item = &i;
-    this->_last.m_item = &i;
-    return;
-  }
-  // append the item at the back;
-  else {
-    this->_last.m_item->m_next = &i;
-    i.m_prev = this->_last.m_item;
-    ++this->_last;
-    return;
-  }
+  _lockguard<LOCK> guard(this->m_lock);
+  return iterator(this->_last());
 }
 
-template<typename T>
-typename dldlist<T>::item* dldlist<T>::pop_front()
+template<linked_t LINKED, order_t ORDER, topology_t TOPOLOGY, typename T, typename SIZE, typename LOCK>
+void basic_dlist<LINKED, ORDER, TOPOLOGY, T, SIZE, LOCK>::push_front(item& i)
 {
-  // if the list is empty, return immediately
-  if (this->empty()) {
-    return nullptr;
-  }
-  // if the last item will be removed, invalidate the iterators
-  else if (this->_first == this->_last) {
-    item* i(this->_first.m_item);
-    this->_first.m_item = nullptr;
-    this->_last.m_item = nullptr;
-    i->m_prev = nullptr;
-    i->m_next = nullptr;
-    return i;
-  }
-  // remove the first item
-  else {
-    item* i(this->_first.m_item);
-    ++this->_first;
-    this->_first.m_item->m_prev = nullptr;
-    i->m_prev = nullptr;
-    i->m_next = nullptr;
-    return i;
-  }
+  static_assert(ORDER == UNORDERED, "only unordered dlists provide the deque interface");
+
+  _lockguard<LOCK> guard(this->m_lock);
+  this->_push_front(i);
+  return;
 }
 
-template<typename T>
-typename dldlist<T>::item* dldlist<T>::pop_back()
+template<linked_t LINKED, order_t ORDER, topology_t TOPOLOGY, typename T, typename SIZE, typename LOCK>
+void basic_dlist<LINKED, ORDER, TOPOLOGY, T, SIZE, LOCK>::push_back(item& i)
 {
-  // if the list is empty, return immediately
-  if (this->empty()) {
-    return nullptr;
-  }
-  // if the last item will be removed, invalidate the iterators
-  else if (this->_first == this->_last) {
-    item* i(this->_last.m_item);
-    this->_first.m_item = nullptr;
-    this->_last.m_item = nullptr;
-    i->m_prev = nullptr;
-    i->m_next = nullptr;
-    return i;
-  }
-  // remove the last item
-  else {
-    item* i(this->_last.m_item);
-    --this->_last;
-    this->_last.m_item->m_next = nullptr;
-    i->m_prev = nullptr;
-    i->m_next = nullptr;
-    return i;
-  }
+  static_assert(ORDER == UNORDERED, "only unordered dlists provide the deque interface");
+
+  _lockguard<LOCK> guard(this->m_lock);
+  this->_push_back(i);
+  return;
 }
 
-// DOUBLY LINKED ORDERED DLIST /////////////////////////////////////////////////
+template<linked_t LINKED, order_t ORDER, topology_t TOPOLOGY, typename T, typename SIZE, typename LOCK>
+typename basic_dlist<LINKED, ORDER, TOPOLOGY, T, SIZE, LOCK>::item* basic_dlist<LINKED, ORDER, TOPOLOGY, T, SIZE, LOCK>::pop_front()
+{
+  static_assert(ORDER == UNORDERED, "only unordered dlists provide the deque interface");
 
-template<typename T>
-dlodlist<T>::dlodlist(cmp_f& cmp) :
-  _dldlist<ORDERED, T>(), m_min(), m_max(), m_cmp(cmp)
-{}
+  _lockguard<LOCK> guard(this->m_lock);
+  return this->_pop_front();
+}
 
-template<typename T>
-inline bool dlodlist<T>::empty() const
+template<linked_t LINKED, order_t ORDER, topology_t TOPOLOGY, typename T, typename SIZE, typename LOCK>
+typename basic_dlist<LINKED, ORDER, TOPOLOGY, T, SIZE, LOCK>::item* basic_dlist<LINKED, ORDER, TOPOLOGY, T, SIZE, LOCK>::pop_back()
 {
-  assert(!((this->m_min.m_item == nullptr) ^ (this->m_max.m_item == nullptr)));
+  static_assert(ORDER == UNORDERED, "only unordered dlists provide the deque interface");
 
-  return (this->m_min.m_item == nullptr);
+  _lockguard<LOCK> guard(this->m_lock);
+  return this->_pop_back();
 }
 
-template<typename T>
-size_t dlodlist<T>::size() const
+template<linked_t LINKED, order_t ORDER, topology_t TOPOLOGY, typename T, typename SIZE, typename LOCK>
+template<topology_t OTOPOLOGY, typename OSIZE, typename OLOCK>
+void basic_dlist<LINKED, ORDER, TOPOLOGY, T, SIZE, LOCK>::splice_back(basic_dlist<LINKED, UNORDERED, OTOPOLOGY, T, OSIZE, OLOCK>& l)
 {
-  // if the list is empty, return immediately
-  if (this->empty()) {
-    return 0;
-  }
-  // iterate through the list
-  else {
-    size_t cnt(1);
-    iterator it(this->m_min);
-    while (it != this->m_max) {
-      ++it;
-      ++cnt;
+  static_assert(ORDER == UNORDERED, "only unordered dlists provide the deque interface");
+
+  item* first(nullptr);
+  item* last(nullptr);
+  size_t cnt(0);
+  {
+    _lockguard<OLOCK> guard(l.m_lock);
+    // if the other list is empty, there is nothing to do
+    if (l.m_head == nullptr) {
+      return;
     }
-    return cnt;
+    first = l._first();
+    last = l._last();
+    // count the items only if a counted list needs their number
+    if constexpr (SIZE::COUNTED || OSIZE::COUNTED) {
+      cnt = l._count();
+    }
+    l._detach(nullptr, *first, *last, cnt);
   }
+  // append the items after the lock of the other list has been released
+  this->_append(*first, *last, cnt);
+  return;
 }
 
-template<typename T>
-bool dlodlist<T>::contains(const T& d) const
+// CIRCULAR INTERFACE //////////////////////////////////////////////////////////
+
+template<linked_t LINKED, order_t ORDER, topology_t TOPOLOGY, typename T, typename SIZE, typename LOCK>
+inline typename basic_dlist<LINKED, ORDER, TOPOLOGY, T, SIZE, LOCK>::iterator basic_dlist<LINKED, ORDER, TOPOLOGY, T, SIZE, LOCK>::latest() const
 {
-  // if the list is empty, return immediately
-  if (this->empty()) {
-    return false;
-  }
-  // iterator through the list and search for d
-  else {
-    iterator it(this->m_min);
-    while (true) {
-      // test for d
-      if (&(it.m_item->m_data) == &d) {
-        return true;
-      }
-      // keep going as long as the end is not reached yet
-      else if (it != this->m_max) {
-        ++it;
-      }
-      // break the loop when all item have been checked
-      else {
-        return false;
-      }
-    }
-  }
+  static_assert(ORDER == UNORDERED && TOPOLOGY == CIRCULAR, "only unordered circular dlists provide the circular interface");
+
+  _lockguard<LOCK> guard(this->m_lock);
+  return iterator(this->m_head);
 }
 
-template<typename T>
-size_t dlodlist<T>::clear()
+template<linked_t LINKED, order_t ORDER, topology_t TOPOLOGY, typename T, typename SIZE, typename LOCK>
+inline typename basic_dlist<LINKED, ORDER, TOPOLOGY, T, SIZE, LOCK>::iterator basic_dlist<LINKED, ORDER, TOPOLOGY, T, SIZE, LOCK>::eldest() const
 {
-  size_t cnt(0);
-  // pop all elements
-  while (this->removeMin() != nullptr) {
-    ++cnt;
-  }
-  return cnt;
+  static_assert(ORDER == UNORDERED && TOPOLOGY == CIRCULAR, "only unordered circular dlists provide the circular interface");
+
+  _lockguard<LOCK> guard(this->m_lock);
+  return iterator(this->_first());
 }
 
-template<typename T>
-typename dlodlist<T>::item* dlodlist<T>::remove(const T& rm)
+template<linked_t LINKED, order_t ORDER, topology_t TOPOLOGY, typename T, typename SIZE, typename LOCK>
+void basic_dlist<LINKED, ORDER, TOPOLOGY, T, SIZE, LOCK>::insert(item& i)
 {
-  // if the list is empty, return immediately
-  if (this->empty()) {
-    return nullptr;
+  static_assert(ORDER == ORDERED || TOPOLOGY == CIRCULAR, "only ordered and circular dlists insert items");
+
+  _lockguard<LOCK> guard(this->m_lock);
+  // an ordered dlist keeps the item in place
+  if constexpr (ORDER == ORDERED) {
+    this->_insert(i);
   }
-  // iterate through the list and remove the first item pointing to rm
+  // a circular dlist inserts the item as the latest one
   else {
-    iterator current(this->m_min);
-    while (true) {
-      // test for rm
-      if (&(current.m_item->m_data) == &rm) {
-        // the minimum item matches
-        if (current == this->m_min) {
-          // if the last item will be removed, set all pointers accordingly
-          if (this->m_min == this->m_max) {
-            this->m_min.m_item = nullptr;
-            this->m_max.m_item = nullptr;
-          }
-          // increase the m_min iterator
-          else {
-            ++this->m_min;
-            this->m_min.m_item->m_prev = nullptr;
-          }
-        }
-        // the maximum item matches
-        else if (current == this->m_max) {
-          --this->m_max;
-          this->m_max.m_item->m_next = nullptr;
-        }
-        // any item inbtetween the minimum and the maximum will be removed
-        else {
-          static_cast<item*>(current.m_item->m_prev)->m_next = current.m_item->m_next;
-          static_cast<item*>(current.m_item->m_next)->m_prev = current.m_item->m_prev;
-        }
-        current.m_item->m_prev = nullptr;
-        current.m_item->m_next = nullptr;
-        return current.m_item;
-      }
-      // keep going as long as the end is not reached yet
-      else if (current != this->m_max) {
-        ++current;
-      }
-      // break the loop when all items have been checked
-      else {
-        return nullptr;
-      }
-    }
+    this->_push_back(i);
   }
+  return;
 }
 
-template<typename T>
-inline bool dlodlist<T>::operator==(const dlodlist& l) const
+template<linked_t LINKED, order_t ORDER, topology_t TOPOLOGY, typename T, typename SIZE, typename LOCK>
+typename basic_dlist<LINKED, ORDER, TOPOLOGY, T, SIZE, LOCK>::item* basic_dlist<LINKED, ORDER, TOPOLOGY, T, SIZE, LOCK>::removeLatest()
 {
-  return (this->m_min == l.m_min) && (this->m_max == l.m_max) && (this->m_cmp == l.m_cmp);
-}
+  static_assert(ORDER == UNORDERED && TOPOLOGY == CIRCULAR, "only unordered circular dlists provide the circular interface");
 
-template<typename T>
-inline bool dlodlist<T>::operator!=(const dlodlist& l) const
-{
-  return (this->m_min != l.m_min) || (this->m_max != l.m_max) || (this->m_cmp != l.m_cmp);
+  _lockguard<LOCK> guard(this->m_lock);
+  return this->_pop_back();
 }
 
-template<typename T>
-inline typename dlodlist<T>::iterator dlodlist<T>::min() const
+template<linked_t LINKED, order_t ORDER, topology_t TOPOLOGY, typename T, typename SIZE, typename LOCK>
+typename basic_dlist<LINKED, ORDER, TOPOLOGY, T, SIZE, LOCK>::item* basic_dlist<LINKED, ORDER, TOPOLOGY, T, SIZE, LOCK>::remove_eldest()
 {
-  return this->m_min;
+  static_assert(ORDER == UNORDERED && TOPOLOGY == CIRCULAR, "only unordered circular dlists provide the circular interface");
+
+  _lockguard<LOCK> guard(this->m_lock);
+  return this->_pop_front();
 }
 
-template<typename T>
-inline typename dlodlist<T>::iterator dlodlist<T>::max() const
+template<linked_t LINKED, order_t ORDER, topology_t TOPOLOGY, typename T, typename SIZE, typename LOCK>
+inline void basic_dlist<LINKED, ORDER, TOPOLOGY, T, SIZE, LOCK>::rotate()
 {
-  return this->m_max;
+  static_assert(ORDER == UNORDERED && TOPOLOGY == CIRCULAR, "only unordered circular dlists provide the circular interface");
+
+  _lockguard<LOCK> guard(this->m_lock);
+  // the eldest item follows the latest one
+  if (this->m_head != nullptr) {
+    this->m_head = static_cast<item*>(this->m_head->m_next);
+  }
+  return;
 }
 
-template<typename T>
-void dlodlist<T>::insert(item& i)
+// ORDERED INTERFACE ///////////////////////////////////////////////////////////
+
+template<linked_t LINKED, order_t ORDER, topology_t TOPOLOGY, typename T, typename SIZE, typename LOCK>
+inline typename basic_dlist<LINKED, ORDER, TOPOLOGY, T, SIZE, LOCK>::iterator basic_dlist<LINKED, ORDER, TOPOLOGY, T, SIZE, LOCK>::min() const
 {
-  assert(!i.attached());
+  static_assert(ORDER == ORDERED, "only ordered dlists provide the ordered interface");
 
-  // if the list is empty, initialize it
-  if (this->empty()) {
-    this->m_min.m_item = &i;
-    this->m_max.m_item = &i;
-    return;
-  }
-  // iteratr through the list and insert the item at the correct location
-  else {
-    iterator current(this->m_min);
-    while (true) {
-      // check, whether i is smaller compared to the current item and insert it
-      if (!m_cmp(*current, *i)) {
-        // special case: if i is smaller than the first item, prepend it
-        if (current == this->m_min) {
-          i.m_next = current.m_item;
-          current.m_item->m_prev = &i;
-          --this->m_min;
-        }
-        // insert the item
-        else {
-          static_cast<item*>(current.m_item->m_prev)->m_next = static_cast<item*>(&i);
-          i.m_prev = current.m_item->m_prev;
-          i.m_next = current.m_item;
-          current.m_item->m_prev = &i;
-        }
-        return;
-      }
-      // if all items in the list are smaller, append it
-      else if (current == this->m_max) {
-        this->m_max.m_item->m_next = &i;
-        i.m_prev = this->m_max.m_item;
-        ++this->m_max;
-        return;
-      }
-      // keep going as long as the end is not reached yet
-      else {
-        ++current;
-      }
-    }
-  }
+  _lockguard<LOCK> guard(this->m_lock);
+  return iterator(this->_first());
 }
 
-template<typename T>
-typename dlodlist<T>::item* dlodlist<T>::removeMin()
+template<linked_t LINKED, order_t ORDER, topology_t TOPOLOGY, typename T, typename SIZE, typename LOCK>
+inline typename basic_dlist<LINKED, ORDER, TOPOLOGY, T, SIZE, LOCK>::iterator basic_dlist<LINKED, ORDER, TOPOLOGY, T, SIZE, LOCK>::max() const
 {
-  // if the list is empty, return immediately
-  if (this->empty()) {
-    return nullptr;
-  }
-  // if the last item will be removed, invalidate the iterators
-  else if (this->m_min == this->m_max) {
-    item* i(this->m_min.m_item);
-    this->m_min.m_item = nullptr;
-    this->m_max.m_item = nullptr;
-    i->m_prev = nullptr;
-    i->m_next = nullptr;
-    return i;
-  }
-  // remove the smallest item
-  else {
-    item* i(this->m_min.m_item);
-    ++this->m_min;
-    this->m_min.m_item->m_prev = nullptr;
-    i->m_prev = nullptr;
-    i->m_next = nullptr;
-    return i;
-  }
+  static_assert(ORDER == ORDERED, "only ordered dlists provide the ordered interface");
+
+  _lockguard<LOCK> guard(this->m_lock);
+  return iterator(this->_last());
 }
 
-template<typename T>
-typename dlodlist<T>::item* dlodlist<T>::removeMax()
+template<linked_t LINKED, order_t ORDER, topology_t TOPOLOGY, typename T, typename SIZE, typename LOCK>
+typename basic_dlist<LINKED, ORDER, TOPOLOGY, T, SIZE, LOCK>::iterator basic_dlist<LINKED, ORDER, TOPOLOGY, T, SIZE, LOCK>::find(const T& key) const
 {
-  // if the list is empty, return immediately
-  if (this->empty()) {
-    return nullptr;
-  }
-  // if the last item will be removed, invalidate the iterators
-  if (this->m_min == this->m_max) {
-    item* i(this->m_max.m_item);
-    this->m_min.m_item = nullptr;
-    this->m_max.m_item = nullptr;
-    i->m_prev = nullptr;
-    i->m_next = nullptr;
-    return i;
-  }
-  // remove the largest item
-  else {
-    item* i(this->m_max.m_item);
-    --this->m_max;
-    this->m_max.m_item->m_next = nullptr;
-    i->m_prev = nullptr;
-    i->m_next = nullptr;
-    return i;
+  static_assert(ORDER == ORDERED, "only ordered dlists provide the ordered interface");
+
+  _lockguard<LOCK> guard(this->m_lock);
+  item* i(this->_bound(key, false));
+  // the first item not smaller than the key must not be greater either
+  if (i != nullptr && this->m_cmp.m_value(key, **i)) {
+    return iterator();
   }
+  return iterator(i);
 }
 
-template<typename T>
-void dlodlist<T>::sort()
+template<linked_t LINKED, order_t ORDER, topology_t TOPOLOGY, typename T, typename SIZE, typename LOCK>
+inline typename basic_dlist<LINKED, ORDER, TOPOLOGY, T, SIZE, LOCK>::iterator basic_dlist<LINKED, ORDER, TOPOLOGY, T, SIZE, LOCK>::lower_bound(const T& key) const
 {
-  // if the list contains less than two items, return immediately
-  if (this->m_min.m_item == this->m_max.m_item) {
-    return;
-  }
-  // clear the list, and reinsert all items
-  else {
-    // initialize temporary iterators and item pointer
-    iterator min_tmp(this->m_min);
-    iterator max_tmp(this->m_max);
-    item* i(nullptr);
-
-    // reset the list
-    this->m_min.m_item = nullptr;
-    this->m_max.m_item = nullptr;
-
-    // re-insert all items
-    bool abort(false);
-    while (!abort) {
-      // check if this is the last iteration
-      abort = (min_tmp == max_tmp);
-
-      // detach and item and re-insert it in this list
-      i = min_tmp.m_item;
-      ++min_tmp;
-      i->m_prev = nullptr;
-      i->m_next = nullptr;
-      this->insert(*i);
-    }
+  static_assert(ORDER == ORDERED, "only ordered dlists provide the ordered interface");
 
-    return;
-  }
+  _lockguard<LOCK> guard(this->m_lock);
+  return iterator(this->_bound(key, false));
 }
 
-// DOUBLY LINKED CIRCULAR DLIST ////////////////////////////////////////////////
+template<linked_t LINKED, order_t ORDER, topology_t TOPOLOGY, typename T, typename SIZE, typename LOCK>
+inline typename basic_dlist<LINKED, ORDER, TOPOLOGY, T, SIZE, LOCK>::iterator basic_dlist<LINKED, ORDER, TOPOLOGY, T, SIZE, LOCK>::upper_bound(const T& key) const
+{
+  static_assert(ORDER == ORDERED, "only ordered dlists provide the ordered interface");
 
-template<typename T>
-dlcdlist<T>::dlcdlist() :
-  _dldlist<CIRCULAR, T>(), m_latest()
-{}
+  _lockguard<LOCK> guard(this->m_lock);
+  return iterator(this->_bound(key, true));
+}
 
-template<typename T>
-inline bool dlcdlist<T>::empty() const
+template<linked_t LINKED, order_t ORDER, topology_t TOPOLOGY, typename T, typename SIZE, typename LOCK>
+inline std::pair<typename basic_dlist<LINKED, ORDER, TOPOLOGY, T, SIZE, LOCK>::iterator, typename basic_dlist<LINKED, ORDER, TOPOLOGY, T, SIZE, LOCK>::iterator> basic_dlist<LINKED, ORDER, TOPOLOGY, T, SIZE, LOCK>::equal_range(const T& key) const
 {
-  return (this->m_latest.m_item == nullptr);
+  static_assert(ORDER == ORDERED, "only ordered dlists provide the ordered interface");
+
+  _lockguard<LOCK> guard(this->m_lock);
+  return std::pair<iterator, iterator>(iterator(this->_bound(key, false)), iterator(this->_bound(key, true)));
 }
 
-template<typename T>
-size_t dlcdlist<T>::size() const
+template<linked_t LINKED, order_t ORDER, topology_t TOPOLOGY, typename T, typename SIZE, typename LOCK>
+typename basic_dlist<LINKED, ORDER, TOPOLOGY, T, SIZE, LOCK>::item* basic_dlist<LINKED, ORDER, TOPOLOGY, T, SIZE, LOCK>::removeMin()
 {
-  // if the list is empty, return immediately
-  if (this->empty()) {
-    return 0;
-  }
-  // iterate through the list
-  else {
-    size_t cnt(0);
-    iterator it(this->m_latest);
-    do {
-      ++it;
-      ++cnt;
-    } while (it != this->m_latest);
-    return cnt;
-  }
+  static_assert(ORDER == ORDERED, "only ordered dlists provide the ordered interface");
+
+  _lockguard<LOCK> guard(this->m_lock);
+  return this->_pop_front();
 }
 
-template<typename T>
-bool dlcdlist<T>::contains(const T& d) const
+template<linked_t LINKED, order_t ORDER, topology_t TOPOLOGY, typename T, typename SIZE, typename LOCK>
+typename basic_dlist<LINKED, ORDER, TOPOLOGY, T, SIZE, LOCK>::item* basic_dlist<LINKED, ORDER, TOPOLOGY, T, SIZE, LOCK>::removeMax()
 {
-  // if the list is empty, return immediately
-  if (this->empty()) {
-    return false;
-  }
-  // iterate through the list and search for d
-  else {
-    iterator it(this->m_latest);
-    while (true) {
-      // test for d
-      if (&(it.m_item->m_data) == &d) {
-        return true;
-      }
-      // keep going as long as the end is not reached yet
-      else {
-        ++it;
-        // break the loop when all items have been checked
-        if (it == this->m_latest) {
-          return false;
-        }
-      }
-    }
-  }
+  static_assert(ORDER == ORDERED, "only ordered dlists provide the ordered interface");
+
+  _lockguard<LOCK> guard(this->m_lock);
+  return this->_pop_back();
 }
 
-template<typename T>
-size_t dlcdlist<T>::clear()
+template<linked_t LINKED, order_t ORDER, topology_t TOPOLOGY, typename T, typename SIZE, typename LOCK>
+template<topology_t OTOPOLOGY, typename OSIZE, typename OLOCK>
+size_t basic_dlist<LINKED, ORDER, TOPOLOGY, T, SIZE, LOCK>::extract_before(const T& key, basic_dlist<LINKED, UNORDERED, OTOPOLOGY, T, OSIZE, OLOCK>& out)
 {
+  static_assert(ORDER == ORDERED, "only ordered dlists provide the ordered interface");
+
+  item* first(nullptr);
+  item* last(nullptr);
   size_t cnt(0);
-  // remove all elements
-  while (this->remove_eldest() != nullptr) {
-    ++cnt;
+  {
+    _lockguard<LOCK> guard(this->m_lock);
+    first = this->_first();
+    // if the minimum is not smaller than the key, there is nothing to do
+    if (first == nullptr || !this->m_cmp.m_value(**first, key)) {
+      return 0;
+    }
+    // find the last item that is smaller than the key
+    last = first;
+    cnt = 1;
+    item* next(this->_next(last));
+    while (next != nullptr && this->m_cmp.m_value(**next, key)) {
+      last = next;
+      next = this->_next(next);
+      ++cnt;
+    }
+    this->_detach(nullptr, *first, *last, cnt);
   }
+  // append the prefix after the lock of this list has been released
+  out._append(*first, *last, cnt);
   return cnt;
 }
 
-template<typename T>
-typename dlcdlist<T>::item* dlcdlist<T>::remove(const T& rm)
+template<linked_t LINKED, order_t ORDER, topology_t TOPOLOGY, typename T, typename SIZE, typename LOCK>
+void basic_dlist<LINKED, ORDER, TOPOLOGY, T, SIZE, LOCK>::update_after(const iterator& prev)
 {
-  // if the list is empty, return immediately
-  if (this->empty()) {
-    return nullptr;
-  }
-  // iterator through the list and remove the first item pointing to rm
-  else {
-    iterator current(this->m_latest);
-    ++current;
-    while (true) {
-      // test for rm
-      if (&(current.m_item->m_data) == &rm) {
-        // if the m_latest item matches
-        if (current == this->m_latest) {
-          // if the last item will be removed, set all pointer accordingly
-          if (this->m_latest.m_item->m_next == this->m_latest.m_item) {
-            item* i(this->m_latest.m_item);
-            this->m_latest.m_item = nullptr;
-            return i;
-          }
-          // decrease the m_latest iterator
-          else {
-            --this->m_latest;
-          }
-        }
-        static_cast<item*>(current.m_item->m_prev)->m_next = current.m_item->m_next;
-        static_cast<item*>(current.m_item->m_next)->m_prev = current.m_item->m_prev;
-        current.m_item->m_prev = nullptr;
-        current.m_item->m_next = nullptr;
-        return current.m_item;
-      }
-      // keep going as long as the end is not reached yet
-      else if (current != this->m_latest) {
-        ++current;
-      }
-      // break the loop when all items have been checked
-      else {
-        return nullptr;
-      }
-    }
+  static_assert(ORDER == ORDERED, "only ordered dlists provide the ordered interface");
+
+  _lockguard<LOCK> guard(this->m_lock);
+  assert(this->m_head != nullptr);
+
+  // unlink the modified item, which is the minimum if there is no predecessor
+  item* i(prev.valid() ? this->_next(prev.m_item) : this->_first());
+  assert(i != nullptr);
+  this->_unlink(prev.m_item, *i);
+
+  // if the item became smaller than its predecessor, search its position from the minimum on
+  item* last(prev.m_item);
+  if (last != nullptr && this->m_cmp.m_value(**i, **last)) {
+    last = nullptr;
   }
-}
+  item* current((last != nullptr) ? this->_next(last) : this->_first());
 
-template<typename T>
-inline bool dlcdlist<T>::operator==(const dlcdlist& l) const
-{
-  return (this->m_latest == l.m_latest);
-}
+  // move on while the current item is smaller
+  while (current != nullptr && this->m_cmp.m_value(**current, **i)) {
+    last = current;
+    current = this->_next(current);
+  }
 
-template<typename T>
-inline bool dlcdlist<T>::operator!=(const dlcdlist& l) const
-{
-  return (this->m_latest != l.m_latest);
+  // link the item behind the last smaller item
+  this->_link(last, *i);
+  return;
 }
 
-template<typename T>
-inline typename dlcdlist<T>::iterator dlcdlist<T>::latest() const
+template<linked_t LINKED, order_t ORDER, topology_t TOPOLOGY, typename T, typename SIZE, typename LOCK>
+void basic_dlist<LINKED, ORDER, TOPOLOGY, T, SIZE, LOCK>::update(item& i)
 {
-  return this->m_latest;
-}
+  static_assert(ORDER == ORDERED && LINKED == DOUBLY_LINKED, "only doubly linked ordered dlists update items by themselves");
 
-template<typename T>
-inline typename dlcdlist<T>::iterator dlcdlist<T>::eldest() const
-{
-  iterator it(this->m_latest);
-  ++it;
-  return it;
-}
+  _lockguard<LOCK> guard(this->m_lock);
+  assert(i.attached());
 
-template <typename T>
-void dlcdlist<T>::insert(item& i)
-{
-  assert(!i.attached());
+  item* const before(this->_prev(&i));
+  item* const after(this->_next(&i));
+  item* prev(before);
 
-  // if the list is empty, initialize its iterator and the items m_prev and m_next pointers
-  if (this->empty()) {
-    this->m_latest.m_item = &i;
-    i.m_prev = &i;
-    i.m_next = &i;
-    return;
+  // if the item became smaller than its predecessor, search the last smaller item towards the minimum
+  if (before != nullptr && this->m_cmp.m_value(*i, **before)) {
+    while (prev != nullptr && !this->m_cmp.m_value(**prev, *i)) {
+      prev = this->_prev(prev);
+    }
   }
-  // insert the item as the m_latest
+  // if the item became greater than its successor, search the last smaller item towards the maximum
+  else if (after != nullptr && this->m_cmp.m_value(**after, *i)) {
+    prev = after;
+    for (item* next = this->_next(prev); next != nullptr && this->m_cmp.m_value(**next, *i); next = this->_next(prev)) {
+      prev = next;
+    }
+  }
+  // otherwise, the item is in place already
   else {
-    i.m_prev = this->m_latest.m_item;
-    i.m_next = this->m_latest.m_item->m_next;
-    static_cast<item*>(this->m_latest.m_item->m_next)->m_prev = &i;
-    this->m_latest.m_item->m_next = &i;
-    ++this->m_latest;
     return;
   }
+
+  // move the item behind the last smaller item
+  this->_unlink(before, i);
+  this->_link(prev, i);
+  return;
 }
 
-template<typename T>
-typename dlcdlist<T>::item* dlcdlist<T>::removeLatest()
+template<linked_t LINKED, order_t ORDER, topology_t TOPOLOGY, typename T, typename SIZE, typename LOCK>
+void basic_dlist<LINKED, ORDER, TOPOLOGY, T, SIZE, LOCK>::sort()
 {
-  // if the list is empty, return immediately
-  if (this->empty()) {
-    return nullptr;
-  }
-  // if the last item will be removed, invalidate the iterator
-  else if (this->m_latest.m_item->m_next == this->m_latest.m_item) {
-    item* i(this->m_latest.m_item);
-    this->m_latest.m_item = nullptr;
-    i->m_prev = nullptr;
-    i->m_next = nullptr;
-    return i;
+  static_assert(ORDER == ORDERED, "only ordered dlists provide the ordered interface");
+
+  _lockguard<LOCK> guard(this->m_lock);
+  // if the list contains less than two items, return immediately
+  if (this->_first() == this->_last()) {
+    return;
   }
-  // remove the latest and decrement the iterator
+  // detach all items as a chain, and reinsert them
   else {
-    item* i(this->m_latest.m_item);
-    --this->m_latest;
-    this->m_latest.m_item->m_next = i->m_next;
-    static_cast<item*>(this->m_latest.m_item->m_next)->m_prev = this->m_latest.m_item;
-    i->m_prev = nullptr;
-    i->m_next = nullptr;
-    return i;
+    item* i(this->_first());
+    this->_last()->m_next = nullptr;
+    this->m_head = nullptr;
+    if constexpr (TOPOLOGY == LINEAR) {
+      this->m_tail.m_value = nullptr;
+    }
+    size_t cnt(0);
+    while (i != nullptr) {
+      item* next(static_cast<item*>(i->m_next));
+      i->m_next = nullptr;
+      if constexpr (LINKED == DOUBLY_LINKED) {
+        i->m_prev = nullptr;
+      }
+      this->_insert(*i);
+      ++cnt;
+      i = next;
+    }
+    // the reinserted items have been counted again
+    this->m_size.removed(cnt);
+    return;
   }
 }
 
-template<typename T>
-typename dlcdlist<T>::item* dlcdlist<T>::remove_eldest()
+// DOUBLY LINKED INTERFACE /////////////////////////////////////////////////////
+
+template<linked_t LINKED, order_t ORDER, topology_t TOPOLOGY, typename T, typename SIZE, typename LOCK>
+typename basic_dlist<LINKED, ORDER, TOPOLOGY, T, SIZE, LOCK>::item* basic_dlist<LINKED, ORDER, TOPOLOGY, T, SIZE, LOCK>::unlink(item& i)
 {
-  // if the list is empty, return immediately
-  if (this->empty()) {
-    return nullptr;
-  }
-  // if the last item will be removed, invalidate the iterator
-  else if (this->m_latest.m_item->m_next == this->m_latest.m_item) {
-    item* i(this->m_latest.m_item);
-    this->m_latest.m_item = nullptr;
-    i->m_prev = nullptr;
-    i->m_next = nullptr;
-    return i;
-  }
-  // remove the eldest
-  else {
-    item* i(static_cast<item*>(this->m_latest.m_item->m_next));
-    this->m_latest.m_item->m_next = i->m_next;
-    static_cast<item*>(this->m_latest.m_item->m_next)->m_prev = this->m_latest.m_item;
-    i->m_prev = nullptr;
-    i->m_next = nullptr;
-    return i;
-  }
+  static_assert(LINKED == DOUBLY_LINKED, "only doubly linked items can be unlinked in constant time");
+
+  _lockguard<LOCK> guard(this->m_lock);
+  item* prev(this->_prev(&i));
+  item* next(this->_next(&i));
+
+  // check the links of the item only, so that unlinking remains constant in time
+  assert(i.attached());
+  assert((prev == nullptr) ? (this->_first() == &i) : (prev->m_next == &i));
+  assert((next == nullptr) ? (this->_last() == &i) : (next->m_prev == &i));
+
+  this->_unlink(prev, i);
+  return &i;
 }
 
 } /* namespace dlist */
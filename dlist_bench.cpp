@@ -0,0 +1,2038 @@
+/*
+The distributed list (dlist) library provides very light-weight real-time
+capable list classes with can optionally be ordered or circular.
+Copyright (C) 2017..2017  Thomas Schöpping
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <coroutine>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <random>
+#include <shared_mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+#include <asyncqueue.hpp>
+#include <bcdlist.hpp>
+#include <blockqueue.hpp>
+#include <calendarqueue.hpp>
+#include <clockcache.hpp>
+#include <dlist.hpp>
+#include <evqueue.hpp>
+#include <executor.hpp>
+#include <lrucache.hpp>
+#include <monodeque.hpp>
+#include <multiqueue.hpp>
+#include <pheap.hpp>
+#include <rcudlist.hpp>
+#include <readyqueue.hpp>
+#include <seqcdlist.hpp>
+#include <spinlock.hpp>
+#include <timerwheel.hpp>
+#include <topk.hpp>
+#include <ttlcdlist.hpp>
+#include <wsdeque.hpp>
+
+using namespace std;
+using namespace dlist;
+
+////////////////////////////////////////////////////////////////////////////////
+// HELPERS                                                                    //
+////////////////////////////////////////////////////////////////////////////////
+
+typedef chrono::steady_clock bench_clock;
+
+static double seconds_since(const bench_clock::time_point& start)
+{
+  return chrono::duration<double>(bench_clock::now() - start).count();
+}
+
+static unsigned int max_threads()
+{
+  const unsigned int hw(thread::hardware_concurrency());
+  return (hw > 0) ? hw : 1;
+}
+
+static vector<unsigned int> thread_counts()
+{
+  // powers of two up to all cores, plus all cores themselves
+  vector<unsigned int> counts;
+  for (unsigned int t = 1; t < max_threads(); t *= 2) {
+    counts.push_back(t);
+  }
+  counts.push_back(max_threads());
+  return counts;
+}
+
+static vector<uint64_t> zipf_keys(const size_t universe, const size_t count, const double exponent)
+{
+  // key k is drawn with a probability proportional to 1/(k+1)^exponent
+  mt19937_64 rng(42);
+  vector<double> weights(universe);
+  for (size_t k = 0; k < universe; ++k) {
+    weights[k] = 1.0 / pow(static_cast<double>(k + 1), exponent);
+  }
+  discrete_distribution<uint64_t> dist(weights.begin(), weights.end());
+  vector<uint64_t> keys(count);
+  for (uint64_t& k : keys) {
+    k = dist(rng);
+  }
+  return keys;
+}
+
+/**
+ * @brief   Fenwick tree to determine the rank of a key among the keys currently present.
+ */
+class rank_tree
+{
+private:
+  vector<uint32_t> m_tree;
+
+public:
+  rank_tree(const size_t n) : m_tree(n + 1, 0) {}
+
+  void add(size_t key, const int32_t delta)
+  {
+    for (++key; key < m_tree.size(); key += key & (~key + 1)) {
+      m_tree[key] += delta;
+    }
+  }
+
+  // number of present keys smaller than key
+  uint32_t rank(size_t key) const
+  {
+    uint32_t r(0);
+    for (; key > 0; key -= key & (~key + 1)) {
+      r += m_tree[key];
+    }
+    return r;
+  }
+};
+
+/**
+ * @brief   Conventional blocking queue with a mutex and a condition variable, as baseline for blockqueue.
+ */
+class cvqueue
+{
+private:
+  dldlist<uint32_t> m_list;
+  mutex m_lock;
+  condition_variable m_cond;
+
+public:
+  void push_back(dldlist<uint32_t>::item& i)
+  {
+    {
+      lock_guard<mutex> guard(m_lock);
+      m_list.push_back(i);
+    }
+    m_cond.notify_one();
+  }
+
+  dldlist<uint32_t>::item* pop_front()
+  {
+    unique_lock<mutex> guard(m_lock);
+    m_cond.wait(guard, [this]() { return !m_list.empty(); });
+    return m_list.pop_front();
+  }
+};
+
+/**
+ * @brief   Queue that writes its eventfd for every item, as baseline for evqueue.
+ */
+class fdqueue
+{
+private:
+  dldlist<uint32_t> m_list;
+  mutex m_lock;
+  const int m_fd;
+
+public:
+  fdqueue() : m_fd(eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC)) {}
+  ~fdqueue() { close(m_fd); }
+
+  int fd() const { return m_fd; }
+
+  void push_back(dldlist<uint32_t>::item& i)
+  {
+    {
+      lock_guard<mutex> guard(m_lock);
+      m_list.push_back(i);
+    }
+    const uint64_t one(1);
+    if (write(m_fd, &one, sizeof(one)) != sizeof(one)) {
+      abort();
+    }
+  }
+
+  bool drain(dldlist<uint32_t>& out)
+  {
+    uint64_t cnt;
+    if (read(m_fd, &cnt, sizeof(cnt)) != sizeof(cnt)) {
+      return false;
+    }
+    lock_guard<mutex> guard(m_lock);
+    out.splice_back(m_list);
+    return true;
+  }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// BENCHMARKS                                                                 //
+////////////////////////////////////////////////////////////////////////////////
+
+void multiqueue_rank_bench()
+{
+  const size_t n = 1 << 16;
+  const unsigned int threads = max(max_threads(), 4u);
+
+  vector<uint32_t> keys(n);
+  for (size_t k = 0; k < n; ++k) {
+    keys[k] = static_cast<uint32_t>(k);
+  }
+  shuffle(keys.begin(), keys.end(), mt19937(42));
+  deque<dlodlist<uint32_t>::item> items;
+  for (size_t k = 0; k < n; ++k) {
+    items.emplace_back(keys[k]);
+  }
+
+  cout << endl << "  rank error of removeMin() with " << n << " items, " << threads << " threads" << endl;
+  for (size_t c : {1, 2, 4, 8}) {
+    multiqueue<uint32_t> queue(threads, c);
+    rank_tree present(n);
+    for (size_t k = 0; k < n; ++k) {
+      queue.insert(items[k]);
+      present.add(keys[k], 1);
+    }
+    // the rank of a removed key is the number of smaller keys still present
+    double sum(0);
+    uint32_t worst(0);
+    while (dlodlist<uint32_t>::item* i = queue.removeMin()) {
+      const uint32_t r(present.rank(**i));
+      present.add(**i, -1);
+      sum += r;
+      worst = max(worst, r);
+    }
+    cout << "    c=" << c << " (" << setw(3) << queue.shards() << " shards): mean rank error " << fixed << setprecision(2) << setw(7) << sum / n << ", max " << worst << endl;
+  }
+}
+
+void multiqueue_throughput_bench()
+{
+  const size_t prefill = 1 << 12;
+  const size_t ops = 1 << 18;
+
+  cout << endl << "  insert/removeMin pairs per second, " << prefill << " items per thread" << endl;
+  for (unsigned int threads : thread_counts()) {
+    deque<uint32_t> keys;
+    deque<dlodlist<uint32_t>::item> items;
+    for (size_t k = 0; k < threads * prefill; ++k) {
+      keys.push_back(static_cast<uint32_t>(k * 2654435761u));
+    }
+    for (size_t k = 0; k < threads * prefill; ++k) {
+      items.emplace_back(keys[k]);
+    }
+
+    // multiqueue
+    double mq_rate(0);
+    {
+      multiqueue<uint32_t> queue(threads);
+      for (dlodlist<uint32_t>::item& i : items) {
+        queue.insert(i);
+      }
+      vector<thread> workers;
+      const bench_clock::time_point start(bench_clock::now());
+      for (unsigned int t = 0; t < threads; ++t) {
+        workers.emplace_back([&queue, ops, t]() {
+          minstd_rand rng(t + 1);
+          for (size_t o = 0; o < ops / 8; ++o) {
+            dlodlist<uint32_t>::item* i(queue.removeMin());
+            if (i != nullptr) {
+              **i += rng() % 1024;
+              queue.insert(*i);
+            }
+          }
+        });
+      }
+      for (thread& w : workers) {
+        w.join();
+      }
+      mq_rate = (threads * (ops / 8)) / seconds_since(start);
+      queue.clear();
+    }
+
+    // single dlodlist protected by a mutex
+    double list_rate(0);
+    {
+      dlodlist<uint32_t> list;
+      mutex lock;
+      for (dlodlist<uint32_t>::item& i : items) {
+        list.insert(i);
+      }
+      vector<thread> workers;
+      const bench_clock::time_point start(bench_clock::now());
+      for (unsigned int t = 0; t < threads; ++t) {
+        workers.emplace_back([&list, &lock, ops, t]() {
+          minstd_rand rng(t + 1);
+          for (size_t o = 0; o < ops / 64; ++o) {
+            lock_guard<mutex> guard(lock);
+            dlodlist<uint32_t>::item* i(list.removeMin());
+            **i += rng() % 1024;
+            list.insert(*i);
+          }
+        });
+      }
+      for (thread& w : workers) {
+        w.join();
+      }
+      list_rate = (threads * (ops / 64)) / seconds_since(start);
+      list.clear();
+    }
+
+    cout << "    " << setw(3) << threads << " threads: multiqueue " << fixed << setprecision(3) << setw(9) << mq_rate / 1e6 << " Mops/s, locked dlodlist " << setw(9) << list_rate / 1e6 << " Mops/s" << endl;
+  }
+}
+
+void rcudldlist_readers_bench()
+{
+  const size_t routes = 64;
+  const double duration = 0.5;
+
+  cout << endl << "  traversals per second of " << routes << " routes while one writer churns the list" << endl;
+  for (unsigned int threads : thread_counts()) {
+    deque<uint32_t> keys;
+    for (size_t k = 0; k < routes; ++k) {
+      keys.push_back(static_cast<uint32_t>(k));
+    }
+
+    // rcudldlist with lock-free readers
+    double rcu_rate(0);
+    {
+      deque<dldlist<uint32_t>::item> items;
+      for (uint32_t& k : keys) {
+        items.emplace_back(k);
+      }
+      rcudomain domain(threads);
+      rcudldlist<uint32_t> list(domain);
+      for (dldlist<uint32_t>::item& i : items) {
+        list.push_back(i);
+      }
+      atomic<bool> stop(false);
+      atomic<uint64_t> traversals(0);
+      atomic<uint64_t> checksum(0);
+      vector<thread> readers;
+      for (unsigned int t = 0; t < threads; ++t) {
+        readers.emplace_back([&domain, &list, &stop, &traversals, &checksum]() {
+          rcureader reader(domain);
+          uint64_t cnt(0);
+          uint64_t sum(0);
+          while (!stop.load(memory_order_relaxed)) {
+            lock_guard<rcureader> guard(reader);
+            for (rcudldlist<uint32_t>::iterator it = list.front(); it.valid(); ++it) {
+              sum += *it;
+            }
+            ++cnt;
+          }
+          traversals += cnt;
+          checksum += sum;
+        });
+      }
+      const bench_clock::time_point start(bench_clock::now());
+      while (seconds_since(start) < duration) {
+        // move the first route to the back
+        dldlist<uint32_t>::item* i(list.pop_front());
+        list.synchronize();
+        list.push_back(*i);
+      }
+      stop = true;
+      for (thread& r : readers) {
+        r.join();
+      }
+      rcu_rate = traversals / seconds_since(start);
+      list.clear();
+    }
+
+    // dldlist protected by a reader-writer lock
+    double rw_rate(0);
+    {
+      deque<dldlist<uint32_t>::item> items;
+      for (uint32_t& k : keys) {
+        items.emplace_back(k);
+      }
+      dldlist<uint32_t> list;
+      shared_mutex lock;
+      for (dldlist<uint32_t>::item& i : items) {
+        list.push_back(i);
+      }
+      atomic<bool> stop(false);
+      atomic<uint64_t> traversals(0);
+      atomic<uint64_t> checksum(0);
+      vector<thread> readers;
+      for (unsigned int t = 0; t < threads; ++t) {
+        readers.emplace_back([&list, &lock, &stop, &traversals, &checksum]() {
+          uint64_t cnt(0);
+          uint64_t sum(0);
+          while (!stop.load(memory_order_relaxed)) {
+            shared_lock<shared_mutex> guard(lock);
+            for (dldlist<uint32_t>::iterator it = list.front(); it.valid(); ++it) {
+              sum += *it;
+            }
+            ++cnt;
+          }
+          traversals += cnt;
+          checksum += sum;
+        });
+      }
+      const bench_clock::time_point start(bench_clock::now());
+      while (seconds_since(start) < duration) {
+        lock_guard<shared_mutex> guard(lock);
+        list.push_back(*list.pop_front());
+      }
+      stop = true;
+      for (thread& r : readers) {
+        r.join();
+      }
+      rw_rate = traversals / seconds_since(start);
+      list.clear();
+    }
+
+    cout << "    " << setw(3) << threads << " readers: rcudldlist " << fixed << setprecision(3) << setw(9) << rcu_rate / 1e6 << " M/s, shared_mutex dldlist " << setw(9) << rw_rate / 1e6 << " M/s" << endl;
+  }
+}
+
+void seqdlcdlist_history_bench()
+{
+  const size_t capacity = 256;
+  const size_t k = 16;
+  const double duration = 0.5;
+
+  cout << endl << "  history of " << capacity << " events, snapshots of the latest " << k << " while one writer records events" << endl;
+  for (unsigned int threads : thread_counts()) {
+    deque<uint32_t> values;
+    for (size_t v = 0; v <= capacity; ++v) {
+      values.push_back(static_cast<uint32_t>(v));
+    }
+
+    // seqdlcdlist with lock-free snapshots
+    double seq_events(0);
+    double seq_snapshots(0);
+    uint64_t seq_checksum(0);
+    {
+      deque<dlcdlist<uint32_t>::item> items;
+      for (uint32_t& v : values) {
+        items.emplace_back(v);
+      }
+      seqdlcdlist<uint32_t> list;
+      atomic<bool> stop(false);
+      atomic<uint64_t> snapshots(0);
+      atomic<uint64_t> checksum(0);
+      vector<thread> readers;
+      for (unsigned int t = 0; t < threads; ++t) {
+        readers.emplace_back([&list, &stop, &snapshots, &checksum]() {
+          uint32_t* out[k];
+          uint64_t cnt(0);
+          uint64_t sum(0);
+          while (!stop.load(memory_order_relaxed)) {
+            const size_t n(list.snapshot(out, k));
+            if (n > 0) {
+              sum += *out[n - 1];
+            }
+            ++cnt;
+          }
+          snapshots += cnt;
+          checksum += sum;
+        });
+      }
+      uint64_t events(0);
+      const bench_clock::time_point start(bench_clock::now());
+      while (seconds_since(start) < duration) {
+        for (size_t e = 0; e < 1024; ++e, ++events) {
+          if (list.size() == capacity) {
+            list.remove_eldest();
+          }
+          list.insert(items[events % items.size()]);
+        }
+      }
+      stop = true;
+      for (thread& r : readers) {
+        r.join();
+      }
+      const double elapsed(seconds_since(start));
+      seq_events = events / elapsed;
+      seq_snapshots = snapshots / elapsed;
+      seq_checksum = checksum;
+      list.clear();
+    }
+
+    // dlcdlist protected by a mutex
+    double mtx_events(0);
+    double mtx_snapshots(0);
+    uint64_t mtx_checksum(0);
+    {
+      deque<dlcdlist<uint32_t>::item> items;
+      for (uint32_t& v : values) {
+        items.emplace_back(v);
+      }
+      dlcdlist<uint32_t> list;
+      mutex lock;
+      atomic<bool> stop(false);
+      atomic<uint64_t> snapshots(0);
+      atomic<uint64_t> checksum(0);
+      vector<thread> readers;
+      for (unsigned int t = 0; t < threads; ++t) {
+        readers.emplace_back([&list, &lock, &stop, &snapshots, &checksum]() {
+          uint32_t* out[k];
+          uint64_t cnt(0);
+          uint64_t sum(0);
+          while (!stop.load(memory_order_relaxed)) {
+            lock_guard<mutex> guard(lock);
+            size_t n(0);
+            if (!list.empty()) {
+              dlcdlist<uint32_t>::iterator it(list.latest());
+              do {
+                out[n++] = &(*it);
+                --it;
+              } while (n < k && it != list.latest());
+              sum += *out[n - 1];
+            }
+            ++cnt;
+          }
+          snapshots += cnt;
+          checksum += sum;
+        });
+      }
+      uint64_t events(0);
+      const bench_clock::time_point start(bench_clock::now());
+      while (seconds_since(start) < duration) {
+        for (size_t e = 0; e < 1024; ++e, ++events) {
+          lock_guard<mutex> guard(lock);
+          if (events >= capacity) {
+            list.remove_eldest();
+          }
+          list.insert(items[events % items.size()]);
+        }
+      }
+      stop = true;
+      for (thread& r : readers) {
+        r.join();
+      }
+      const double elapsed(seconds_since(start));
+      mtx_events = events / elapsed;
+      mtx_snapshots = snapshots / elapsed;
+      mtx_checksum = checksum;
+      list.clear();
+    }
+
+    cout << "    " << setw(3) << threads << " readers: seqdlcdlist " << fixed << setprecision(3) << setw(9) << seq_events / 1e6 << " M events/s " << setw(9) << seq_snapshots / 1e6 << " M snapshots/s, locked dlcdlist " << setw(9) << mtx_events / 1e6 << " M events/s " << setw(9) << mtx_snapshots / 1e6 << " M snapshots/s" << ((seq_checksum == 0 || mtx_checksum == 0) ? " (no items seen)" : "") << endl;
+  }
+}
+
+void wsdeque_treewalk_bench()
+{
+  const unsigned int depth = 20;
+  const size_t nodes = (size_t(1) << depth) - 1;
+
+  // node n of the implicit binary tree has the children 2n and 2n+1
+  deque<uint32_t> ids;
+  for (size_t n = 0; n <= nodes; ++n) {
+    ids.push_back(static_cast<uint32_t>(n));
+  }
+  deque<dldlist<uint32_t>::item> items;
+  for (size_t n = 0; n <= nodes; ++n) {
+    items.emplace_back(ids[n]);
+  }
+
+  cout << endl << "  fork-join walk of a binary tree with " << nodes << " nodes" << endl;
+  for (unsigned int threads : thread_counts()) {
+    // per-worker wsdeques
+    double ws_rate(0);
+    {
+      vector<wsdeque<uint32_t>*> deques;
+      for (unsigned int t = 0; t < threads; ++t) {
+        deques.push_back(new wsdeque<uint32_t>());
+      }
+      atomic<size_t> remaining(nodes);
+      atomic<uint64_t> checksum(0);
+      deques[0]->push_back(items[1]);
+      vector<thread> workers;
+      const bench_clock::time_point start(bench_clock::now());
+      for (unsigned int t = 0; t < threads; ++t) {
+        workers.emplace_back([&deques, &items, &remaining, &checksum, nodes, threads, t]() {
+          minstd_rand rng(t + 1);
+          uint64_t sum(0);
+          while (remaining.load(memory_order_relaxed) > 0) {
+            // work on the own deque, or steal from a random victim
+            dldlist<uint32_t>::item* i(deques[t]->pop_back());
+            if (i == nullptr) {
+              i = deques[rng() % threads]->pop_front();
+              if (i == nullptr) {
+                continue;
+              }
+            }
+            const size_t n(**i);
+            sum += n;
+            if (2 * n + 1 <= nodes) {
+              deques[t]->push_back(items[2 * n]);
+              deques[t]->push_back(items[2 * n + 1]);
+            }
+            remaining.fetch_sub(1, memory_order_relaxed);
+          }
+          checksum += sum;
+        });
+      }
+      for (thread& w : workers) {
+        w.join();
+      }
+      ws_rate = nodes / seconds_since(start);
+      for (wsdeque<uint32_t>* d : deques) {
+        delete d;
+      }
+    }
+
+    // per-worker dldlists protected by mutexes
+    double list_rate(0);
+    {
+      vector<dldlist<uint32_t>*> lists;
+      vector<mutex*> locks;
+      for (unsigned int t = 0; t < threads; ++t) {
+        lists.push_back(new dldlist<uint32_t>());
+        locks.push_back(new mutex());
+      }
+      atomic<size_t> remaining(nodes);
+      atomic<uint64_t> checksum(0);
+      lists[0]->push_back(items[1]);
+      vector<thread> workers;
+      const bench_clock::time_point start(bench_clock::now());
+      for (unsigned int t = 0; t < threads; ++t) {
+        workers.emplace_back([&lists, &locks, &items, &remaining, &checksum, nodes, threads, t]() {
+          minstd_rand rng(t + 1);
+          uint64_t sum(0);
+          while (remaining.load(memory_order_relaxed) > 0) {
+            // work on the own list, or steal from a random victim
+            dldlist<uint32_t>::item* i(nullptr);
+            {
+              lock_guard<mutex> guard(*locks[t]);
+              i = lists[t]->pop_back();
+            }
+            if (i == nullptr) {
+              const unsigned int victim(rng() % threads);
+              lock_guard<mutex> guard(*locks[victim]);
+              i = lists[victim]->pop_front();
+              if (i == nullptr) {
+                continue;
+              }
+            }
+            const size_t n(**i);
+            sum += n;
+            if (2 * n + 1 <= nodes) {
+              lock_guard<mutex> guard(*locks[t]);
+              lists[t]->push_back(items[2 * n]);
+              lists[t]->push_back(items[2 * n + 1]);
+            }
+            remaining.fetch_sub(1, memory_order_relaxed);
+          }
+          checksum += sum;
+        });
+      }
+      for (thread& w : workers) {
+        w.join();
+      }
+      list_rate = nodes / seconds_since(start);
+      for (unsigned int t = 0; t < threads; ++t) {
+        delete lists[t];
+        delete locks[t];
+      }
+    }
+
+    cout << "    " << setw(3) << threads << " threads: wsdeque " << fixed << setprecision(3) << setw(9) << ws_rate / 1e6 << " M nodes/s, locked dldlists " << setw(9) << list_rate / 1e6 << " M nodes/s" << endl;
+  }
+}
+
+template<typename QUEUE>
+static double handoff_roundtrip(const size_t rounds)
+{
+  uint32_t token(0);
+  dldlist<uint32_t>::item item(token);
+  QUEUE ping;
+  QUEUE pong;
+  thread echo([&ping, &pong, rounds]() {
+    for (size_t r = 0; r < rounds; ++r) {
+      pong.push_back(*ping.pop_front());
+    }
+  });
+  const bench_clock::time_point start(bench_clock::now());
+  for (size_t r = 0; r < rounds; ++r) {
+    ping.push_back(item);
+    pong.pop_front();
+  }
+  const double elapsed(seconds_since(start));
+  echo.join();
+  return elapsed / rounds;
+}
+
+void blockqueue_handoff_bench()
+{
+  const size_t rounds = 1 << 14;
+
+  cout << endl << "  one-way hand-off latency between two threads, averaged over " << rounds << " round trips" << endl;
+  const double bq(handoff_roundtrip<blockqueue<dldlist<uint32_t>>>(rounds) / 2);
+  const double cv(handoff_roundtrip<cvqueue>(rounds) / 2);
+  cout << "    blockqueue " << fixed << setprecision(3) << setw(9) << bq * 1e6 << " us, condition variable queue " << setw(9) << cv * 1e6 << " us" << endl;
+}
+
+template<typename QUEUE>
+static double producer_cost(deque<dldlist<uint32_t>::item>& items)
+{
+  QUEUE queue;
+  const size_t n(items.size());
+  thread consumer([&queue, n]() {
+    for (size_t c = 0; c < n; ++c) {
+      queue.pop_front();
+    }
+  });
+  const bench_clock::time_point start(bench_clock::now());
+  for (dldlist<uint32_t>::item& i : items) {
+    queue.push_back(i);
+  }
+  const double elapsed(seconds_since(start));
+  consumer.join();
+  return elapsed / n;
+}
+
+void blockqueue_producer_bench()
+{
+  const size_t n = 1 << 20;
+
+  deque<uint32_t> values(n, 0);
+  deque<dldlist<uint32_t>::item> items;
+  for (uint32_t& v : values) {
+    items.emplace_back(v);
+  }
+
+  cout << endl << "  producer cost per push_back of " << n << " items with a concurrent consumer" << endl;
+  const double bq(producer_cost<blockqueue<dldlist<uint32_t>>>(items));
+  const double cv(producer_cost<cvqueue>(items));
+  cout << "    blockqueue " << fixed << setprecision(1) << setw(7) << bq * 1e9 << " ns, condition variable queue " << setw(7) << cv * 1e9 << " ns" << endl;
+}
+
+template<typename QUEUE>
+static void epoll_loop(deque<dldlist<uint32_t>::item>& items, double& rate, double& batch)
+{
+  QUEUE queue;
+  const int ep(epoll_create1(EPOLL_CLOEXEC));
+  struct epoll_event ev;
+  ev.events = EPOLLIN;
+  ev.data.ptr = &queue;
+  epoll_ctl(ep, EPOLL_CTL_ADD, queue.fd(), &ev);
+
+  const size_t n(items.size());
+  const bench_clock::time_point start(bench_clock::now());
+  thread producer([&queue, &items]() {
+    for (dldlist<uint32_t>::item& i : items) {
+      queue.push_back(i);
+    }
+  });
+  dldlist<uint32_t> ready;
+  size_t received(0);
+  size_t wakeups(0);
+  while (received < n) {
+    struct epoll_event e;
+    if (epoll_wait(ep, &e, 1, 1000) != 1) {
+      continue;
+    }
+    ++wakeups;
+    queue.drain(ready);
+    while (ready.pop_front() != nullptr) {
+      ++received;
+    }
+  }
+  rate = n / seconds_since(start);
+  batch = static_cast<double>(n) / wakeups;
+  producer.join();
+  close(ep);
+}
+
+void evqueue_epoll_bench()
+{
+  const size_t n = 1 << 20;
+
+  deque<uint32_t> values(n, 0);
+  deque<dldlist<uint32_t>::item> items;
+  for (uint32_t& v : values) {
+    items.emplace_back(v);
+  }
+
+  cout << endl << "  " << n << " messages from one producer to an epoll loop" << endl;
+  double ev_rate(0), ev_batch(0), fd_rate(0), fd_batch(0);
+  epoll_loop<evqueue<dldlist<uint32_t>>>(items, ev_rate, ev_batch);
+  epoll_loop<fdqueue>(items, fd_rate, fd_batch);
+  cout << "    evqueue " << fixed << setprecision(3) << setw(9) << ev_rate / 1e6 << " M msgs/s (" << setprecision(1) << ev_batch << " per wakeup), eventfd per message " << setprecision(3) << setw(9) << fd_rate / 1e6 << " M msgs/s (" << setprecision(1) << fd_batch << " per wakeup)" << endl;
+}
+
+/**
+ * @brief   Minimal eagerly started coroutine type for the asyncqueue benchmark.
+ */
+struct bench_coroutine
+{
+  struct promise_type
+  {
+    bench_coroutine get_return_object() { return bench_coroutine(); }
+    suspend_never initial_suspend() { return suspend_never(); }
+    suspend_never final_suspend() noexcept { return suspend_never(); }
+    void return_void() {}
+    void unhandled_exception() { terminate(); }
+  };
+};
+
+static bench_coroutine asyncqueue_consumer(asyncqueue<uint32_t>& queue, uint64_t& sum)
+{
+  while (asyncqueue<uint32_t>::item* i = co_await queue.pop()) {
+    sum += **i;
+  }
+}
+
+/**
+ * @brief   Callback based consumer queue with type-erased continuations, as baseline for asyncqueue.
+ */
+class callbackqueue
+{
+private:
+  deque<function<void(dldlist<uint32_t>::item*)>> m_waiting;
+  deque<pair<function<void(dldlist<uint32_t>::item*)>, dldlist<uint32_t>::item*>> m_ready;
+
+public:
+  void pop(function<void(dldlist<uint32_t>::item*)> f) { m_waiting.push_back(move(f)); }
+
+  void push_back(dldlist<uint32_t>::item& i)
+  {
+    m_ready.emplace_back(move(m_waiting.front()), &i);
+    m_waiting.pop_front();
+  }
+
+  size_t dispatch()
+  {
+    size_t cnt(m_ready.size());
+    for (size_t r = 0; r < cnt; ++r) {
+      pair<function<void(dldlist<uint32_t>::item*)>, dldlist<uint32_t>::item*> p(move(m_ready.front()));
+      m_ready.pop_front();
+      p.first(p.second);
+    }
+    return cnt;
+  }
+};
+
+static void callback_consumer(callbackqueue& queue, uint64_t& sum, uint64_t& count)
+{
+  queue.pop([&queue, &sum, &count](dldlist<uint32_t>::item* i) {
+    sum += **i;
+    ++count;
+    callback_consumer(queue, sum, count);
+  });
+}
+
+void asyncqueue_dispatch_bench()
+{
+  const size_t consumers = 1024;
+  const size_t rounds = 1024;
+
+  deque<uint32_t> values;
+  for (size_t c = 0; c < consumers; ++c) {
+    values.push_back(static_cast<uint32_t>(c));
+  }
+  deque<dldlist<uint32_t>::item> items;
+  for (uint32_t& v : values) {
+    items.emplace_back(v);
+  }
+
+  cout << endl << "  " << consumers << " suspended consumers, " << rounds << " rounds of one item per consumer and one dispatch pass" << endl;
+
+  // coroutines suspended on an asyncqueue
+  double co_rate(0);
+  {
+    asyncqueue<uint32_t> queue;
+    uint64_t sum(0);
+    for (size_t c = 0; c < consumers; ++c) {
+      asyncqueue_consumer(queue, sum);
+    }
+    const bench_clock::time_point start(bench_clock::now());
+    for (size_t r = 0; r < rounds; ++r) {
+      for (dldlist<uint32_t>::item& i : items) {
+        queue.push_back(i);
+      }
+      queue.dispatch();
+    }
+    co_rate = (consumers * rounds) / seconds_since(start);
+    // let all consumers return
+    queue.cancel_all();
+    queue.dispatch();
+  }
+
+  // type-erased callbacks
+  double cb_rate(0);
+  {
+    callbackqueue queue;
+    uint64_t sum(0);
+    uint64_t count(0);
+    for (size_t c = 0; c < consumers; ++c) {
+      callback_consumer(queue, sum, count);
+    }
+    const bench_clock::time_point start(bench_clock::now());
+    for (size_t r = 0; r < rounds; ++r) {
+      for (dldlist<uint32_t>::item& i : items) {
+        queue.push_back(i);
+      }
+      queue.dispatch();
+    }
+    cb_rate = (consumers * rounds) / seconds_since(start);
+  }
+
+  cout << "    asyncqueue " << fixed << setprecision(3) << setw(9) << co_rate / 1e6 << " M resumes/s, std::function callbacks " << setw(9) << cb_rate / 1e6 << " M calls/s" << endl;
+}
+
+/**
+ * @brief   Tiny task that submits itself again until its budget is used up.
+ */
+class bench_task : public task
+{
+private:
+  executor& m_exec;
+  atomic<size_t>& m_done;
+  size_t m_remaining;
+
+public:
+  bench_task(executor& exec, atomic<size_t>& done, const size_t runs) :
+    task(), m_exec(exec), m_done(done), m_remaining(runs)
+  {}
+
+  void run()
+  {
+    if (--m_remaining > 0) {
+      m_exec.submit(*this);
+    } else {
+      m_done.fetch_add(1, memory_order_release);
+    }
+  }
+};
+
+/**
+ * @brief   Thread pool with a single mutex protected queue of std::function, as baseline for the executor.
+ */
+class functionpool
+{
+private:
+  mutex m_mutex;
+  condition_variable m_cv;
+  deque<function<void()>> m_queue;
+  vector<thread> m_threads;
+  bool m_running;
+
+public:
+  functionpool(const size_t threads) :
+    m_running(true)
+  {
+    for (size_t t = 0; t < threads; ++t) {
+      m_threads.emplace_back([this]() {
+        while (true) {
+          function<void()> f;
+          {
+            unique_lock<mutex> lock(m_mutex);
+            m_cv.wait(lock, [this]() { return !m_queue.empty() || !m_running; });
+            if (m_queue.empty()) {
+              return;
+            }
+            f = move(m_queue.front());
+            m_queue.pop_front();
+          }
+          f();
+        }
+      });
+    }
+  }
+
+  ~functionpool()
+  {
+    {
+      lock_guard<mutex> lock(m_mutex);
+      m_running = false;
+    }
+    m_cv.notify_all();
+    for (thread& t : m_threads) {
+      t.join();
+    }
+  }
+
+  void submit(function<void()> f)
+  {
+    {
+      lock_guard<mutex> lock(m_mutex);
+      m_queue.push_back(move(f));
+    }
+    m_cv.notify_one();
+  }
+};
+
+static void function_task(functionpool& pool, atomic<size_t>& done, const size_t remaining)
+{
+  if (remaining > 1) {
+    pool.submit([&pool, &done, remaining]() { function_task(pool, done, remaining - 1); });
+  } else {
+    done.fetch_add(1, memory_order_release);
+  }
+}
+
+void executor_tasks_bench()
+{
+  const size_t tasks = 1024;
+  const size_t runs = 1024;
+
+  cout << endl << "  " << tasks << " tasks submitted externally, each resubmitting itself until it ran " << runs << " times" << endl;
+  for (const unsigned int t : thread_counts()) {
+    // intrusive tasks on the executor
+    double ex_rate(0);
+    {
+      atomic<size_t> done(0);
+      executor exec(t);
+      deque<bench_task> items;
+      for (size_t i = 0; i < tasks; ++i) {
+        items.emplace_back(exec, done, runs);
+      }
+      const bench_clock::time_point start(bench_clock::now());
+      for (bench_task& i : items) {
+        exec.submit(i);
+      }
+      while (done.load(memory_order_acquire) < tasks) {
+        this_thread::yield();
+      }
+      ex_rate = (tasks * runs) / seconds_since(start);
+    }
+
+    // std::function on a mutex protected queue
+    double fn_rate(0);
+    {
+      atomic<size_t> done(0);
+      functionpool pool(t);
+      const bench_clock::time_point start(bench_clock::now());
+      for (size_t i = 0; i < tasks; ++i) {
+        pool.submit([&pool, &done, runs]() { function_task(pool, done, runs); });
+      }
+      while (done.load(memory_order_acquire) < tasks) {
+        this_thread::yield();
+      }
+      fn_rate = (tasks * runs) / seconds_since(start);
+    }
+
+    cout << "    " << setw(3) << t << " threads: executor " << fixed << setprecision(3) << setw(9) << ex_rate / 1e6 << " M tasks/s, std::function pool " << setw(9) << fn_rate / 1e6 << " M tasks/s" << endl;
+  }
+}
+
+void timerwheel_arm_bench()
+{
+  const uint64_t horizon = 1 << 20;
+  const size_t sizes[] = {10000, 1000000, 10000000};
+
+  cout << endl << "  timers with random expiry within " << horizon << " ticks, armed and expired entirely" << endl;
+  for (const size_t n : sizes) {
+    mt19937_64 rng(42);
+    uniform_int_distribution<uint64_t> dist(1, horizon);
+
+    // timer wheel: arm all timers, then advance to the horizon
+    double wheel_arm(0), wheel_expire(0);
+    {
+      deque<uint32_t> values(n, 0);
+      deque<timerwheel<uint32_t>::timer> timers;
+      for (uint32_t& v : values) {
+        timers.emplace_back(v);
+      }
+      timerwheel<uint32_t> wheel(0);
+      dldlist<uint32_t> out;
+
+      bench_clock::time_point start(bench_clock::now());
+      for (timerwheel<uint32_t>::timer& t : timers) {
+        wheel.arm(t, dist(rng));
+      }
+      wheel_arm = seconds_since(start) / n;
+
+      start = bench_clock::now();
+      wheel.advance(horizon, out);
+      wheel_expire = seconds_since(start) / n;
+      while (out.pop_front() != nullptr);
+    }
+
+    // ordered list: build the list in descending order at constant cost, then sample random arms
+    double list_arm(0), list_expire(0);
+    {
+      const size_t samples = max<size_t>(16, min<size_t>(n, 100000000 / n));
+      deque<uint64_t> expiries;
+      for (size_t e = 0; e < n; ++e) {
+        expiries.push_back(dist(rng));
+      }
+      sort(expiries.begin(), expiries.end(), greater<uint64_t>());
+      deque<dlodlist<uint64_t>::item> items;
+      for (uint64_t& e : expiries) {
+        items.emplace_back(e);
+      }
+      dlodlist<uint64_t> list;
+      for (dlodlist<uint64_t>::item& i : items) {
+        list.insert(i);
+      }
+
+      deque<uint64_t> sample_expiries;
+      for (size_t e = 0; e < samples; ++e) {
+        sample_expiries.push_back(dist(rng));
+      }
+      deque<dlodlist<uint64_t>::item> sample_items;
+      for (uint64_t& e : sample_expiries) {
+        sample_items.emplace_back(e);
+      }
+
+      bench_clock::time_point start(bench_clock::now());
+      for (dlodlist<uint64_t>::item& i : sample_items) {
+        list.insert(i);
+      }
+      list_arm = seconds_since(start) / samples;
+
+      start = bench_clock::now();
+      while (list.removeMin() != nullptr);
+      list_expire = seconds_since(start) / (n + samples);
+    }
+
+    cout << "    " << setw(8) << n << " timers: timerwheel arm " << fixed << setprecision(1) << setw(9) << wheel_arm * 1e9 << " ns, expire " << setw(9) << wheel_expire * 1e9 << " ns; dlodlist arm " << setw(12) << list_arm * 1e9 << " ns, expire " << setw(9) << list_expire * 1e9 << " ns" << endl;
+  }
+}
+
+void readyqueue_select_bench()
+{
+  const unsigned int priorities = 256;
+  const size_t threads = 16;
+  const size_t rounds = 1 << 20;
+
+  deque<uint32_t> values(threads, 0);
+
+  cout << endl << "  " << threads << " runnable items at the lowest of " << priorities << " priorities, " << rounds << " time slices of select and rotate" << endl;
+
+  // bitmap lookup
+  double bitmap_rate(0);
+  {
+    deque<readyqueue<uint32_t, priorities>::entry> entries;
+    for (uint32_t& v : values) {
+      entries.emplace_back(v);
+    }
+    readyqueue<uint32_t, priorities> queue;
+    for (readyqueue<uint32_t, priorities>::entry& e : entries) {
+      queue.insert(e, 0);
+    }
+    uint64_t sum(0);
+    const bench_clock::time_point start(bench_clock::now());
+    for (size_t r = 0; r < rounds; ++r) {
+      sum += **queue.next();
+      queue.rotate();
+    }
+    bitmap_rate = rounds / seconds_since(start);
+  }
+
+  // linear scan from the highest priority
+  double scan_rate(0);
+  {
+    deque<dlcdlist<uint32_t>::item> items;
+    for (uint32_t& v : values) {
+      items.emplace_back(v);
+    }
+    vector<dlcdlist<uint32_t>> levels(priorities);
+    for (dlcdlist<uint32_t>::item& i : items) {
+      levels[0].insert(i);
+    }
+    uint64_t sum(0);
+    const bench_clock::time_point start(bench_clock::now());
+    for (size_t r = 0; r < rounds; ++r) {
+      unsigned int p(priorities - 1);
+      while (p > 0 && levels[p].empty()) {
+        --p;
+      }
+      sum += *levels[p].eldest();
+      levels[p].rotate();
+    }
+    scan_rate = rounds / seconds_since(start);
+    while (levels[0].remove_eldest() != nullptr);
+  }
+
+  cout << "    readyqueue " << fixed << setprecision(3) << setw(9) << bitmap_rate / 1e6 << " M slices/s, linear scan " << setw(9) << scan_rate / 1e6 << " M slices/s" << endl;
+}
+
+/**
+ * @brief   Runs the hold model on an ordered queue: remove the minimum and insert it again with a random later key.
+ */
+template<typename Q>
+static double hold_model(Q& queue, deque<uint64_t>& keys, const size_t holds)
+{
+  mt19937_64 rng(7);
+  uniform_int_distribution<uint64_t> increment(0, 2 * keys.size());
+
+  deque<typename Q::item> items;
+  for (uint64_t& k : keys) {
+    items.emplace_back(k);
+  }
+  // the keys are sorted in descending order, so the ordered lists are filled at constant cost
+  for (typename Q::item& i : items) {
+    queue.insert(i);
+  }
+
+  const bench_clock::time_point start(bench_clock::now());
+  for (size_t h = 0; h < holds; ++h) {
+    typename Q::item* i(queue.removeMin());
+    **i += increment(rng);
+    queue.insert(*i);
+  }
+  const double duration(seconds_since(start) / holds);
+  while (queue.removeMin() != nullptr);
+  return duration;
+}
+
+void calendarqueue_hold_bench()
+{
+  const size_t sizes[] = {1000, 10000, 100000, 1000000};
+
+  cout << endl << "  hold model with uniformly distributed increments" << endl;
+  for (const size_t n : sizes) {
+    mt19937_64 rng(42);
+    uniform_int_distribution<uint64_t> dist(0, 2 * n);
+    deque<uint64_t> keys;
+    for (size_t k = 0; k < n; ++k) {
+      keys.push_back(dist(rng));
+    }
+    sort(keys.begin(), keys.end(), greater<uint64_t>());
+
+    deque<uint64_t> calendar_keys(keys);
+    calendarqueue<uint64_t> calendar;
+    const double calendar_hold(hold_model(calendar, calendar_keys, 1000000));
+
+    // the ordered list scans half of the pending set per hold, so fewer holds are measured
+    deque<uint64_t> list_keys(keys);
+    slodlist<uint64_t> list;
+    const double list_hold(hold_model(list, list_keys, max<size_t>(100, 100000000 / n)));
+
+    cout << "    " << setw(8) << n << " pending: calendarqueue " << fixed << setprecision(1) << setw(9) << calendar_hold * 1e9 << " ns/hold, slodlist " << setw(12) << list_hold * 1e9 << " ns/hold" << endl;
+  }
+}
+
+void pheap_hold_bench()
+{
+  const size_t sizes[] = {1000, 10000, 100000, 1000000};
+
+  cout << endl << "  hold model with uniformly distributed increments" << endl;
+  for (const size_t n : sizes) {
+    mt19937_64 rng(42);
+    uniform_int_distribution<uint64_t> dist(0, 2 * n);
+    deque<uint64_t> keys;
+    for (size_t k = 0; k < n; ++k) {
+      keys.push_back(dist(rng));
+    }
+    sort(keys.begin(), keys.end(), greater<uint64_t>());
+
+    deque<uint64_t> heap_keys(keys);
+    pheap<uint64_t> heap;
+    const double heap_hold(hold_model(heap, heap_keys, 1000000));
+
+    // the ordered list scans half of the pending set per hold, so fewer holds are measured
+    deque<uint64_t> list_keys(keys);
+    dlodlist<uint64_t> list;
+    const double list_hold(hold_model(list, list_keys, max<size_t>(100, 100000000 / n)));
+
+    cout << "    " << setw(8) << n << " pending: pheap " << fixed << setprecision(1) << setw(9) << heap_hold * 1e9 << " ns/hold, dlodlist " << setw(12) << list_hold * 1e9 << " ns/hold" << endl;
+  }
+}
+
+void lrucache_hit_bench()
+{
+  const size_t sizes[] = {1000, 10000, 100000};
+  const size_t lookups(1000000);
+
+  cout << endl << "  lookups of uniformly distributed keys, half of which are cached" << endl;
+  for (const size_t n : sizes) {
+    mt19937_64 rng(42);
+    uniform_int_distribution<uint64_t> dist(0, 2 * n - 1);
+    vector<uint64_t> keys(lookups);
+    for (uint64_t& k : keys) {
+      k = dist(rng);
+    }
+    deque<uint64_t> values;
+    for (uint64_t v = 0; v < 2 * n; ++v) {
+      values.push_back(v);
+    }
+
+    // intrusive cache: hits move the entry by unlinking it, misses reuse the evicted entry
+    deque<lrucache<uint64_t, uint64_t>::entry> entries;
+    for (size_t e = 0; e < n; ++e) {
+      entries.emplace_back(values[e]);
+    }
+    lrucache<uint64_t, uint64_t> cache(n);
+    for (size_t e = 0; e < n; ++e) {
+      cache.put(entries[e], e);
+    }
+    auto start(bench_clock::now());
+    for (const uint64_t k : keys) {
+      if (cache.get(k) == nullptr) {
+        cache.put(*cache.evict(), k);
+      }
+    }
+    const double cache_op(seconds_since(start) / lookups);
+
+    // std based cache: the map finds the item, but moving it to the front searches the list
+    deque<dlitem<uint64_t>> items;
+    for (size_t e = 0; e < n; ++e) {
+      items.emplace_back(values[e]);
+    }
+    dldlist<uint64_t> list;
+    unordered_map<uint64_t, dlitem<uint64_t>*> map;
+    for (size_t e = 0; e < n; ++e) {
+      list.push_front(items[e]);
+      map.emplace(e, &items[e]);
+    }
+    const size_t list_lookups(max<size_t>(1000, lookups * 1000 / n));
+    start = bench_clock::now();
+    for (size_t l = 0; l < list_lookups; ++l) {
+      const uint64_t k(keys[l]);
+      auto it(map.find(k));
+      if (it != map.end()) {
+        list.remove(**it->second);
+        list.push_front(*it->second);
+      } else {
+        dlitem<uint64_t>* i(list.pop_back());
+        map.erase(**i);
+        **i = k;
+        map.emplace(k, i);
+        list.push_front(*i);
+      }
+    }
+    const double list_op(seconds_since(start) / list_lookups);
+
+    cout << "    " << setw(8) << n << " entries: lrucache " << fixed << setprecision(1) << setw(9) << cache_op * 1e9 << " ns/lookup (" << cache.hits() << " hits), dldlist+unordered_map " << setw(12) << list_op * 1e9 << " ns/lookup" << endl;
+  }
+}
+
+template<typename C>
+static double cache_model(C& cache, deque<typename C::entry>& entries, const vector<uint64_t>& keys)
+{
+  // fill the cache, then reuse the evicted entry on each miss
+  for (size_t e = 0; e < entries.size(); ++e) {
+    cache.put(entries[e], keys.size() + e);
+  }
+  const auto start(bench_clock::now());
+  for (const uint64_t k : keys) {
+    if (cache.get(k) == nullptr) {
+      cache.put(*cache.evict(), k);
+    }
+  }
+  return seconds_since(start);
+}
+
+void clockcache_zipf_bench()
+{
+  const size_t sizes[] = {1000, 10000, 100000};
+  const size_t universe(1000000);
+  const size_t lookups(2000000);
+
+  const vector<uint64_t> keys(zipf_keys(universe, lookups, 0.9));
+
+  cout << endl << "  lookups of zipf distributed keys" << endl;
+  for (const size_t n : sizes) {
+    deque<uint64_t> values(n, 0);
+
+    deque<clockcache<uint64_t, uint64_t>::entry> clock_entries(values.begin(), values.end());
+    clockcache<uint64_t, uint64_t> clock(n);
+    const double clock_time(cache_model(clock, clock_entries, keys));
+
+    deque<lrucache<uint64_t, uint64_t>::entry> lru_entries(values.begin(), values.end());
+    lrucache<uint64_t, uint64_t> lru(n);
+    const double lru_time(cache_model(lru, lru_entries, keys));
+
+    cout << "    " << setw(8) << n << " entries: clockcache " << fixed << setprecision(1) << setw(6) << clock_time / lookups * 1e9 << " ns/lookup, " << setprecision(2) << setw(5) << 100.0 * clock.hits() / lookups << "% hits; lrucache " << setprecision(1) << setw(6) << lru_time / lookups * 1e9 << " ns/lookup, " << setprecision(2) << setw(5) << 100.0 * lru.hits() / lookups << "% hits" << endl;
+  }
+}
+
+void bcdlist_history_bench()
+{
+  const size_t capacities[] = {16, 256, 4096};
+  const size_t events(1000000);
+
+  cout << endl << "  recording events in a history of the latest samples" << endl;
+  for (const size_t capacity : capacities) {
+    deque<uint32_t> values;
+    for (size_t v = 0; v <= capacity; ++v) {
+      values.push_back(static_cast<uint32_t>(v));
+    }
+
+    // bounded list recycles the eldest item
+    deque<slbcdlist<uint32_t>::item> bounded_items;
+    for (uint32_t& v : values) {
+      bounded_items.emplace_back(v);
+    }
+    slbcdlist<uint32_t> bounded(capacity);
+    slbcdlist<uint32_t>::item* free_item(&bounded_items.back());
+    for (size_t i = 0; i < capacity; ++i) {
+      bounded.insert(bounded_items[i]);
+    }
+    bench_clock::time_point start(bench_clock::now());
+    for (size_t e = 0; e < events; ++e) {
+      free_item = bounded.insert(*free_item);
+    }
+    const double bounded_event(seconds_since(start) / events);
+
+    // plain circular list counts its items on every insertion
+    deque<slcdlist<uint32_t>::item> items;
+    for (uint32_t& v : values) {
+      items.emplace_back(v);
+    }
+    slcdlist<uint32_t> list;
+    slcdlist<uint32_t>::item* list_free(&items.back());
+    for (size_t i = 0; i < capacity; ++i) {
+      list.insert(items[i]);
+    }
+    const size_t list_events(max<size_t>(1000, events * 16 / capacity));
+    start = bench_clock::now();
+    for (size_t e = 0; e < list_events; ++e) {
+      list.insert(*list_free);
+      list_free = (list.size() > capacity) ? list.remove_eldest() : nullptr;
+    }
+    const double list_event(seconds_since(start) / list_events);
+
+    cout << "    " << setw(8) << capacity << " samples: slbcdlist " << fixed << setprecision(1) << setw(6) << bounded_event * 1e9 << " ns/event, slcdlist with size() " << setw(9) << list_event * 1e9 << " ns/event" << endl;
+  }
+}
+
+void ttlcdlist_purge_bench()
+{
+  const size_t sizes[] = {1000, 10000, 100000};
+  const uint64_t ttl(1000);
+  const uint64_t ticks(2000);
+
+  cout << endl << "  session tracking with " << ttl << " ticks time to live, purging every tick" << endl;
+  for (const size_t n : sizes) {
+    // each tick, some sessions are active and a few new ones replace the expired ones
+    const size_t active(n / 100 + 1);
+    mt19937_64 rng(42);
+    uniform_int_distribution<size_t> dist(0, n - 1);
+    vector<size_t> activity(ticks * active);
+    for (size_t& a : activity) {
+      a = dist(rng);
+    }
+    deque<uint32_t> values;
+    for (size_t v = 0; v < n; ++v) {
+      values.push_back(static_cast<uint32_t>(v));
+    }
+
+    // ttlcdlist unlinks the stale prefix only
+    deque<ttlcdlist<uint32_t>::entry> entries(values.begin(), values.end());
+    ttlcdlist<uint32_t> sessions(ttl);
+    dldlist<uint32_t> expired;
+    for (size_t e = 0; e < n; ++e) {
+      sessions.insert(entries[e], e * ttl / n);
+    }
+    size_t ttl_expired(0);
+    bench_clock::time_point start(bench_clock::now());
+    for (uint64_t now = ttl; now < ttl + ticks; ++now) {
+      for (size_t a = 0; a < active; ++a) {
+        ttlcdlist<uint32_t>::entry& e(entries[activity[(now - ttl) * active + a]]);
+        if (e.attached()) {
+          sessions.touch(e, now);
+        } else {
+          sessions.insert(e, now);
+        }
+      }
+      ttl_expired += sessions.expire(now, expired);
+      expired.clear();
+    }
+    const double ttl_tick(seconds_since(start) / ticks);
+
+    // dlcdlist with separate timestamps is purged by checking all sessions, rotating the live ones
+    deque<dlcdlist<uint32_t>::item> items(values.begin(), values.end());
+    vector<uint64_t> stamps(n);
+    vector<bool> tracked(n, true);
+    dlcdlist<uint32_t> list;
+    size_t count(n);
+    for (size_t e = 0; e < n; ++e) {
+      stamps[e] = e * ttl / n;
+      list.insert(items[e]);
+    }
+    size_t list_expired(0);
+    start = bench_clock::now();
+    for (uint64_t now = ttl; now < ttl + ticks; ++now) {
+      for (size_t a = 0; a < active; ++a) {
+        const size_t e(activity[(now - ttl) * active + a]);
+        if (tracked[e]) {
+          list.unlink(items[e]);
+        } else {
+          ++count;
+        }
+        stamps[e] = now;
+        tracked[e] = true;
+        list.insert(items[e]);
+      }
+      size_t remaining(count);
+      while (remaining-- > 0) {
+        dlcdlist<uint32_t>::item* i(list.remove_eldest());
+        if (stamps[**i] + ttl <= now) {
+          tracked[**i] = false;
+          --count;
+          ++list_expired;
+        } else {
+          list.insert(*i);
+        }
+      }
+    }
+    const double list_tick(seconds_since(start) / ticks);
+
+    cout << "    " << setw(8) << n << " sessions: ttlcdlist " << fixed << setprecision(1) << setw(9) << ttl_tick * 1e6 << " us/tick (" << ttl_expired << " expired), dlcdlist scan " << setw(9) << list_tick * 1e6 << " us/tick (" << list_expired << " expired)" << endl;
+  }
+}
+
+void monodeque_window_bench()
+{
+  const size_t windows[] = {16, 1024, 65536, 1048576};
+  const size_t samples(4000000);
+
+  // the sample storage is recycled once the window has moved past it
+  mt19937_64 rng(42);
+  uniform_int_distribution<uint32_t> dist;
+  deque<uint32_t> values;
+  for (size_t v = 0; v < samples; ++v) {
+    values.push_back(dist(rng));
+  }
+
+  cout << endl << "  sliding window minimum of uniformly distributed samples" << endl;
+  for (const size_t window : windows) {
+    // the rescanned list is filled without measuring, so only samples of full windows are measured
+    const size_t measured(min<size_t>(samples - window, max<size_t>(100, 100000000 / window)));
+
+    // monotonic deque
+    deque<monodeque<uint32_t>::sample> mono_samples(values.begin(), values.end());
+    monodeque<uint32_t> mono;
+    uint64_t mono_sum(0);
+    bench_clock::time_point start(bench_clock::now());
+    for (size_t s = 0; s < samples; ++s) {
+      mono.push(mono_samples[s]);
+      mono.retain(window);
+      if (s >= window && s < window + measured) {
+        mono_sum += *mono.extreme();
+      }
+    }
+    const double mono_sample(seconds_since(start) / samples);
+
+    // dldlist of the window, which is rescanned on every sample
+    deque<dldlist<uint32_t>::item> items(values.begin(), values.end());
+    dldlist<uint32_t> list;
+    for (size_t s = 0; s < window; ++s) {
+      list.push_back(items[s]);
+    }
+    uint64_t list_sum(0);
+    start = bench_clock::now();
+    for (size_t s = window; s < window + measured; ++s) {
+      list.push_back(items[s]);
+      list.pop_front();
+      uint32_t min(UINT32_MAX);
+      for (dldlist<uint32_t>::iterator it = list.front(); it.valid(); ++it) {
+        min = std::min(min, *it);
+      }
+      list_sum += min;
+    }
+    const double list_sample(seconds_since(start) / measured);
+
+    cout << "    " << setw(8) << window << " samples: monodeque " << fixed << setprecision(1) << setw(6) << mono_sample * 1e9 << " ns/sample (" << mono.size() << " queued), dldlist rescan " << setw(12) << list_sample * 1e9 << " ns/sample" << endl;
+    if (mono_sum != list_sum) {
+      cout << "    checksum mismatch" << endl;
+    }
+  }
+}
+
+void topk_stream_bench()
+{
+  const size_t ks[] = {10, 100, 1000};
+  const size_t flows(1000000);
+  const size_t packets(4000000);
+
+  // frequent flows are heavy, so most packets carry a large weight, with random low bits to break ties
+  const vector<uint64_t> ranks(zipf_keys(flows, packets, 1.1));
+  mt19937_64 rng(7);
+  deque<uint64_t> weights;
+  for (const uint64_t r : ranks) {
+    weights.push_back(((flows - r) << 20) | (rng() & 0xFFFFF));
+  }
+
+  cout << endl << "  top-k weights of a zipf distributed stream of " << packets << " packets" << endl;
+  for (const size_t k : ks) {
+    // top-k tracker rejects small candidates against the minimum
+    deque<dltopk<uint64_t>::item> topk_items(weights.begin(), weights.end());
+    dltopk<uint64_t> top(k);
+    size_t rejected(0);
+    bench_clock::time_point start(bench_clock::now());
+    for (dltopk<uint64_t>::item& i : topk_items) {
+      rejected += (top.offer(i) == &i) ? 1 : 0;
+    }
+    const double topk_packet(seconds_since(start) / packets);
+
+    // ordered list inserts each candidate and trims the minimum afterwards
+    deque<dlodlist<uint64_t>::item> items(weights.begin(), weights.end());
+    dlodlist<uint64_t> list;
+    size_t count(0);
+    start = bench_clock::now();
+    for (dlodlist<uint64_t>::item& i : items) {
+      list.insert(i);
+      if (++count > k) {
+        list.removeMin();
+        --count;
+      }
+    }
+    const double list_packet(seconds_since(start) / packets);
+
+    cout << "    k = " << setw(4) << k << ": dltopk " << fixed << setprecision(1) << setw(6) << topk_packet * 1e9 << " ns/packet (" << setprecision(2) << 100.0 * rejected / packets << "% rejected), dlodlist " << setprecision(1) << setw(9) << list_packet * 1e9 << " ns/packet" << ((*top.min() != *list.min()) ? " (mismatch)" : "") << endl;
+  }
+}
+
+void dlodlist_update_bench()
+{
+  const size_t sizes[] = {100, 1000, 10000};
+  const size_t updates(200000);
+
+  cout << endl << "  small key changes of random items in an ordered list" << endl;
+  for (const size_t n : sizes) {
+    mt19937_64 rng(42);
+    uniform_int_distribution<size_t> pick(0, n - 1);
+    uniform_int_distribution<int> delta(-8, 8);
+    vector<size_t> picks(updates);
+    vector<int> deltas(updates);
+    for (size_t u = 0; u < updates; ++u) {
+      picks[u] = pick(rng);
+      deltas[u] = delta(rng);
+    }
+    deque<uint64_t> values;
+    for (size_t v = 0; v < n; ++v) {
+      values.push_back(1000000 + 4 * v);
+    }
+
+    // repositioning moves the item locally
+    deque<uint64_t> update_values(values);
+    deque<dlodlist<uint64_t>::item> update_items(update_values.begin(), update_values.end());
+    dlodlist<uint64_t> update_list;
+    for (dlodlist<uint64_t>::item& i : update_items) {
+      update_list.insert(i);
+    }
+    bench_clock::time_point start(bench_clock::now());
+    for (size_t u = 0; u < updates; ++u) {
+      update_values[picks[u]] += deltas[u];
+      update_list.update(update_items[picks[u]]);
+    }
+    const double update_op(seconds_since(start) / updates);
+
+    // removing and inserting the item scans the list twice
+    deque<uint64_t> remove_values(values);
+    deque<dlodlist<uint64_t>::item> remove_items(remove_values.begin(), remove_values.end());
+    dlodlist<uint64_t> remove_list;
+    for (dlodlist<uint64_t>::item& i : remove_items) {
+      remove_list.insert(i);
+    }
+    start = bench_clock::now();
+    for (size_t u = 0; u < updates; ++u) {
+      remove_list.remove(remove_values[picks[u]]);
+      remove_values[picks[u]] += deltas[u];
+      remove_list.insert(remove_items[picks[u]]);
+    }
+    const double remove_op(seconds_since(start) / updates);
+
+    cout << "    " << setw(8) << n << " items: update " << fixed << setprecision(1) << setw(6) << update_op * 1e9 << " ns/change, remove and insert " << setw(9) << remove_op * 1e9 << " ns/change" << ((*update_list.min() != *remove_list.min()) ? " (mismatch)" : "") << endl;
+  }
+}
+
+void dlodlist_bound_bench()
+{
+  const size_t sizes[] = {100, 1000, 10000};
+  const size_t queries(20000);
+
+  cout << endl << "  lookup of random keys in an ordered list" << endl;
+  for (const size_t n : sizes) {
+    mt19937_64 rng(42);
+    uniform_int_distribution<uint64_t> key(0, 4 * n);
+    vector<uint64_t> keys(queries);
+    for (uint64_t& k : keys) {
+      k = key(rng);
+    }
+    deque<uint64_t> values;
+    for (size_t v = 0; v < n; ++v) {
+      values.push_back(4 * v);
+    }
+    deque<dlodlist<uint64_t>::item> items(values.begin(), values.end());
+    dlodlist<uint64_t> list;
+    for (dlodlist<uint64_t>::item& i : items) {
+      list.insert(i);
+    }
+
+    // the bound stops at the position of the key
+    size_t found(0);
+    bench_clock::time_point start(bench_clock::now());
+    for (const uint64_t k : keys) {
+      found += list.find(k).valid() ? 1 : 0;
+    }
+    const double find_query(seconds_since(start) / queries);
+
+    // a plain scan compares every item
+    size_t scanned(0);
+    start = bench_clock::now();
+    for (const uint64_t k : keys) {
+      for (dlodlist<uint64_t>::iterator it = list.min(); it.valid(); ++it) {
+        if (*it == k) {
+          ++scanned;
+        }
+      }
+    }
+    const double scan_query(seconds_since(start) / queries);
+
+    cout << "    " << setw(8) << n << " items: find " << fixed << setprecision(1) << setw(8) << find_query * 1e9 << " ns/lookup, full scan " << setw(9) << scan_query * 1e9 << " ns/lookup" << ((found != scanned) ? " (mismatch)" : "") << endl;
+  }
+}
+
+void dlodlist_expire_bench()
+{
+  const size_t deadlines(10000);
+  const size_t batches[] = {1, 16, 256};
+  const size_t rounds(20);
+
+  cout << endl << "  expiry of " << deadlines << " ordered deadlines in batches per tick" << endl;
+  for (const size_t batch : batches) {
+    deque<uint64_t> values;
+    for (size_t v = 0; v < deadlines; ++v) {
+      values.push_back(v);
+    }
+    deque<dlodlist<uint64_t>::item> items(values.begin(), values.end());
+    double extract_time(0);
+    double remove_time(0);
+    size_t extracted(0);
+    size_t removed(0);
+    for (size_t r = 0; r < rounds; ++r) {
+      // the expired prefix is unlinked at once
+      dlodlist<uint64_t> list;
+      for (size_t v = deadlines; v > 0; --v) {
+        list.insert(items[v - 1]);
+      }
+      dldlist<uint64_t> expired;
+      bench_clock::time_point start(bench_clock::now());
+      for (uint64_t now = batch; !list.empty(); now += batch) {
+        extracted += list.extract_before(now, expired);
+        expired.clear();
+      }
+      extract_time += seconds_since(start);
+
+      // every expired deadline is removed by its own call
+      for (size_t v = deadlines; v > 0; --v) {
+        list.insert(items[v - 1]);
+      }
+      start = bench_clock::now();
+      for (uint64_t now = batch; !list.empty(); now += batch) {
+        while (!list.empty() && *list.min() < now) {
+          expired.push_back(*list.removeMin());
+          ++removed;
+        }
+        expired.clear();
+      }
+      remove_time += seconds_since(start);
+    }
+
+    cout << "    " << setw(4) << batch << " per tick: extract_before " << fixed << setprecision(1) << setw(6) << extract_time / extracted * 1e9 << " ns/deadline, removeMin " << setw(6) << remove_time / removed * 1e9 << " ns/deadline" << ((extracted != removed) ? " (mismatch)" : "") << endl;
+  }
+}
+
+void dldlist_remove_if_bench()
+{
+  const size_t sizes[] = {100, 1000, 10000};
+  const size_t rounds(10);
+
+  cout << endl << "  removal of every second item from a list" << endl;
+  for (const size_t n : sizes) {
+    deque<uint64_t> values;
+    for (size_t v = 0; v < n; ++v) {
+      values.push_back(v);
+    }
+    deque<dldlist<uint64_t>::item> items(values.begin(), values.end());
+    double if_time(0);
+    double remove_time(0);
+    size_t if_removed(0);
+    size_t removed(0);
+    for (size_t r = 0; r < rounds; ++r) {
+      // all matching items are unlinked in a single pass
+      dldlist<uint64_t> list;
+      dldlist<uint64_t> out;
+      for (dldlist<uint64_t>::item& i : items) {
+        list.push_back(i);
+      }
+      bench_clock::time_point start(bench_clock::now());
+      if_removed += list.remove_if([](const uint64_t& v) { return (v % 2 == 1); }, out);
+      if_time += seconds_since(start);
+      list.clear();
+      out.clear();
+
+      // every item is searched from the front on its own
+      for (dldlist<uint64_t>::item& i : items) {
+        list.push_back(i);
+      }
+      start = bench_clock::now();
+      for (size_t v = 1; v < n; v += 2) {
+        out.push_back(*list.remove(values[v]));
+        ++removed;
+      }
+      remove_time += seconds_since(start);
+      list.clear();
+      out.clear();
+    }
+
+    cout << "    " << setw(8) << n << " items: remove_if " << fixed << setprecision(1) << setw(6) << if_time / if_removed * 1e9 << " ns/item, remove " << setw(9) << remove_time / removed * 1e9 << " ns/item" << ((if_removed != removed) ? " (mismatch)" : "") << endl;
+  }
+}
+
+/**
+ * @brief   Recycles the first item of a linear list to its back in every step.
+ */
+template<typename LIST>
+static double fifo_model(LIST& list, deque<typename LIST::item>& items, const size_t ops)
+{
+  for (typename LIST::item& i : items) {
+    list.push_back(i);
+  }
+  bench_clock::time_point start(bench_clock::now());
+  for (size_t op = 0; op < ops; ++op) {
+    list.push_back(*list.pop_front());
+  }
+  const double op_time(seconds_since(start) / ops);
+  list.clear();
+  return op_time;
+}
+
+/**
+ * @brief   Recycles the eldest item of a circular list as the latest one and rotates the list in every step.
+ */
+template<typename LIST>
+static double ring_model(LIST& list, deque<typename LIST::item>& items, const size_t ops)
+{
+  for (typename LIST::item& i : items) {
+    list.insert(i);
+  }
+  bench_clock::time_point start(bench_clock::now());
+  for (size_t op = 0; op < ops; ++op) {
+    list.insert(*list.remove_eldest());
+    list.rotate();
+  }
+  const double op_time(seconds_since(start) / ops);
+  list.clear();
+  return op_time;
+}
+
+/**
+ * @brief   Searches a payload that is not part of a filled list, so every item is visited.
+ */
+template<typename LIST>
+static double scan_model(const LIST& list, const uint64_t& missing, const size_t scans)
+{
+  // the volatile pointer keeps the compiler from proving that the payload is missing
+  const uint64_t* volatile probe(&missing);
+  size_t found(0);
+  bench_clock::time_point start(bench_clock::now());
+  for (size_t s = 0; s < scans; ++s) {
+    found += list.contains(*probe) ? 1 : 0;
+  }
+  const double scan_time(seconds_since(start) / scans);
+  return (found == 0) ? scan_time / list.size() : 0;
+}
+
+void dlist_classes_bench()
+{
+  const size_t n(1024);
+  const size_t ops(10000000);
+  const size_t scans(20000);
+  const size_t pending(64);
+  const size_t holds(1000000);
+
+  deque<uint64_t> values;
+  for (size_t v = 0; v < n; ++v) {
+    values.push_back(v);
+  }
+  const uint64_t missing(n);
+  deque<uint64_t> keys;
+  for (size_t k = pending; k > 0; --k) {
+    keys.push_back(k);
+  }
+
+  cout << endl << "  fifo cycles, ring cycles and holds on " << pending << " items, and scans per list class" << endl;
+  {
+    deque<sldlist<uint64_t>::item> items(values.begin(), values.end());
+    sldlist<uint64_t> list;
+    const double cycle(fifo_model(list, items, ops));
+    for (sldlist<uint64_t>::item& i : items) {
+      list.push_back(i);
+    }
+    const double scan(scan_model(list, missing, scans));
+    list.clear();
+    cout << "    sldlist:  " << fixed << setprecision(2) << setw(7) << cycle * 1e9 << " ns/cycle, " << setw(5) << scan * 1e9 << " ns/item scanned" << endl;
+  }
+  {
+    deque<slodlist<uint64_t>::item> items(values.begin(), values.end());
+    slodlist<uint64_t> list;
+    deque<uint64_t> hold_keys(keys);
+    const double hold(hold_model(list, hold_keys, holds));
+    for (slodlist<uint64_t>::item& i : items) {
+      list.insert(i);
+    }
+    const double scan(scan_model(list, missing, scans));
+    list.clear();
+    cout << "    slodlist: " << fixed << setprecision(2) << setw(7) << hold * 1e9 << " ns/hold,  " << setw(5) << scan * 1e9 << " ns/item scanned" << endl;
+  }
+  {
+    deque<slcdlist<uint64_t>::item> items(values.begin(), values.end());
+    slcdlist<uint64_t> list;
+    const double cycle(ring_model(list, items, ops));
+    for (slcdlist<uint64_t>::item& i : items) {
+      list.insert(i);
+    }
+    const double scan(scan_model(list, missing, scans));
+    list.clear();
+    cout << "    slcdlist: " << fixed << setprecision(2) << setw(7) << cycle * 1e9 << " ns/cycle, " << setw(5) << scan * 1e9 << " ns/item scanned" << endl;
+  }
+  {
+    deque<dldlist<uint64_t>::item> items(values.begin(), values.end());
+    dldlist<uint64_t> list;
+    const double cycle(fifo_model(list, items, ops));
+    for (dldlist<uint64_t>::item& i : items) {
+      list.push_back(i);
+    }
+    const double scan(scan_model(list, missing, scans));
+    list.clear();
+    cout << "    dldlist:  " << fixed << setprecision(2) << setw(7) << cycle * 1e9 << " ns/cycle, " << setw(5) << scan * 1e9 << " ns/item scanned" << endl;
+  }
+  {
+    deque<dlodlist<uint64_t>::item> items(values.begin(), values.end());
+    dlodlist<uint64_t> list;
+    deque<uint64_t> hold_keys(keys);
+    const double hold(hold_model(list, hold_keys, holds));
+    for (dlodlist<uint64_t>::item& i : items) {
+      list.insert(i);
+    }
+    const double scan(scan_model(list, missing, scans));
+    list.clear();
+    cout << "    dlodlist: " << fixed << setprecision(2) << setw(7) << hold * 1e9 << " ns/hold,  " << setw(5) << scan * 1e9 << " ns/item scanned" << endl;
+  }
+  {
+    deque<dlcdlist<uint64_t>::item> items(values.begin(), values.end());
+    dlcdlist<uint64_t> list;
+    const double cycle(ring_model(list, items, ops));
+    for (dlcdlist<uint64_t>::item& i : items) {
+      list.insert(i);
+    }
+    const double scan(scan_model(list, missing, scans));
+    list.clear();
+    cout << "    dlcdlist: " << fixed << setprecision(2) << setw(7) << cycle * 1e9 << " ns/cycle, " << setw(5) << scan * 1e9 << " ns/item scanned" << endl;
+  }
+}
+
+void basic_dlist_overhead_bench()
+{
+  const size_t sizes[] = {16, 1024};
+  const size_t ops(10000000);
+
+  cout << endl << "  fifo recycling through a dldlist with different policies" << endl;
+  for (const size_t n : sizes) {
+    deque<uint64_t> values(n, 0);
+    deque<dldlist<uint64_t>::item> items(values.begin(), values.end());
+
+    dldlist<uint64_t> plain;
+    const double plain_op(fifo_model(plain, items, ops));
+    basic_dlist<DOUBLY_LINKED, UNORDERED, LINEAR, uint64_t, counted> counting;
+    const double counted_op(fifo_model(counting, items, ops));
+    basic_dlist<DOUBLY_LINKED, UNORDERED, LINEAR, uint64_t, counted, spinlock> locked;
+    const double locked_op(fifo_model(locked, items, ops));
+
+    cout << "    " << setw(6) << n << " items: dldlist " << fixed << setprecision(2) << setw(5) << plain_op * 1e9 << " ns/op, counted " << setw(5) << counted_op * 1e9 << " ns/op, counted and spinlock " << setw(5) << locked_op * 1e9 << " ns/op" << endl;
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// MAIN                                                                       //
+////////////////////////////////////////////////////////////////////////////////
+
+struct benchmark
+{
+  const char* name;
+  void (*run)();
+};
+
+int main(int argc, char *argv[])
+{
+  const benchmark benchmarks[] = {
+    {"multiqueue_rank", multiqueue_rank_bench},
+    {"multiqueue_throughput", multiqueue_throughput_bench},
+    {"rcudldlist_readers", rcudldlist_readers_bench},
+    {"seqdlcdlist_history", seqdlcdlist_history_bench},
+    {"wsdeque_treewalk", wsdeque_treewalk_bench},
+    {"blockqueue_handoff", blockqueue_handoff_bench},
+    {"blockqueue_producer", blockqueue_producer_bench},
+    {"evqueue_epoll", evqueue_epoll_bench},
+    {"asyncqueue_dispatch", asyncqueue_dispatch_bench},
+    {"executor_tasks", executor_tasks_bench},
+    {"timerwheel_arm", timerwheel_arm_bench},
+    {"readyqueue_select", readyqueue_select_bench},
+    {"calendarqueue_hold", calendarqueue_hold_bench},
+    {"pheap_hold", pheap_hold_bench},
+    {"lrucache_hit", lrucache_hit_bench},
+    {"clockcache_zipf", clockcache_zipf_bench},
+    {"bcdlist_history", bcdlist_history_bench},
+    {"ttlcdlist_purge", ttlcdlist_purge_bench},
+    {"monodeque_window", monodeque_window_bench},
+    {"topk_stream", topk_stream_bench},
+    {"dlodlist_update", dlodlist_update_bench},
+    {"dlodlist_bound", dlodlist_bound_bench},
+    {"dlodlist_expire", dlodlist_expire_bench},
+    {"dldlist_remove_if", dldlist_remove_if_bench},
+    {"dlist_classes", dlist_classes_bench},
+    {"basic_dlist_overhead", basic_dlist_overhead_bench},
+  };
+
+  cout << "Welcome to the dlist library benchmark suite." << endl;
+  cout << "The version of the library is " << DLIST_VERSION_MAJOR << '-' << DLIST_VERSION_MINOR << '-'<< DLIST_VERSION_PATCH << '.' << endl;
+  cout << "Running on " << max_threads() << " hardware threads." << endl;
+
+  // run all benchmarks, or only those given as arguments
+  for (const benchmark& b : benchmarks) {
+    bool selected(argc < 2);
+    for (int a = 1; a < argc; ++a) {
+      selected |= (strcmp(argv[a], b.name) == 0);
+    }
+    if (selected) {
+      cout << endl << "benchmarking " << b.name << "..." << flush;
+      b.run();
+    }
+  }
+
+  return 0;
+}
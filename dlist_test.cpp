@@ -17,17 +17,91 @@ You should have received a copy of the GNU General Public License
 along with this program.  If not, see <http://www.gnu.org/licenses/>.
 */
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <coroutine>
+#include <deque>
+#include <exception>
 #include <iostream>
-
+#include <iterator>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include <poll.h>
+#include <sys/epoll.h>
+#include <unistd.h>
+
+#include <asyncqueue.hpp>
+#include <bcdlist.hpp>
+#include <blockqueue.hpp>
+#include <calendarqueue.hpp>
+#include <clockcache.hpp>
 #include <dlist.hpp>
+#include <evqueue.hpp>
+#include <executor.hpp>
+#include <lrucache.hpp>
+#include <monodeque.hpp>
+#include <multiqueue.hpp>
+#include <pheap.hpp>
+#include <rcudlist.hpp>
+#include <readyqueue.hpp>
+#include <seqcdlist.hpp>
+#include <spinlock.hpp>
+#include <timerwheel.hpp>
+#include <topk.hpp>
+#include <ttlcdlist.hpp>
+#include <wsdeque.hpp>
 
 using namespace std;
 using namespace dlist;
 
+/**
+ * @brief   Minimal eagerly started coroutine type for the waitlist and asyncqueue tests.
+ */
+struct coroutine
+{
+  struct promise_type
+  {
+    coroutine get_return_object() { return coroutine(); }
+    std::suspend_never initial_suspend() { return std::suspend_never(); }
+    std::suspend_never final_suspend() noexcept { return std::suspend_never(); }
+    void return_void() {}
+    void unhandled_exception() { std::terminate(); }
+  };
+};
+
 bool my_cmp(const uint32_t& a, const uint32_t& b) {
   return (a < b);
 }
 
+bool my_even(const uint32_t& a) {
+  return (a % 2 == 0);
+}
+
+template<linked_t LINKED, order_t ORDER, topology_t TOPOLOGY, typename T, typename SIZE, typename LOCK>
+size_t my_drain(basic_dlist<LINKED, ORDER, TOPOLOGY, T, SIZE, LOCK>& l) {
+  const size_t cnt(l.size());
+  assert(l.clear() == cnt);
+  assert(l.empty() == true);
+  return cnt;
+}
+
+template<typename Q>
+uint32_t* my_min(Q& q) {
+  typename Q::iterator it(q.min());
+  return it.valid() ? &*it : nullptr;
+}
+
+// the list classes carry no pointer to a virtual table
+static_assert(sizeof(sldlist<uint32_t>) == 2 * sizeof(void*), "sldlist must only hold its first and last item");
+static_assert(sizeof(slodlist<uint32_t>) == 3 * sizeof(void*), "slodlist must only hold its minimum, maximum and compare function");
+static_assert(sizeof(slcdlist<uint32_t>) == sizeof(void*), "slcdlist must only hold its latest item");
+static_assert(sizeof(dldlist<uint32_t>) == 2 * sizeof(void*), "dldlist must only hold its first and last item");
+static_assert(sizeof(dlodlist<uint32_t>) == 3 * sizeof(void*), "dlodlist must only hold its minimum, maximum and compare function");
+static_assert(sizeof(dlcdlist<uint32_t>) == sizeof(void*), "dlcdlist must only hold its latest item");
+
 void slitem_test()
 {
   uint32_t data_a = 1;
@@ -432,6 +506,79 @@ void sldlist_test()
   assert(list_a.clear() == 1);
   assert(list_a.empty() == true);
 
+  list_a.splice_back(list_b);
+  assert(list_a.empty() == true);
+  list_b.push_back(item_a);
+  list_a.splice_back(list_b);
+  assert(list_b.empty() == true);
+  assert(list_a.size() == 1);
+  list_b.push_back(item_b);
+  list_b.push_back(item_c);
+  list_a.splice_back(list_b);
+  assert(list_b.empty() == true);
+  assert(list_a.size() == 3);
+  assert(list_a.pop_back() == &item_c);
+  assert(list_a.pop_back() == &item_b);
+  assert(list_a.pop_back() == &item_a);
+  assert(list_a.empty() == true);
+
+  // matching items and ranges are removed in a single pass
+  data_a = 1;
+  data_b = 2;
+  data_c = 3;
+  list_a.push_back(item_a);
+  list_a.push_back(item_b);
+  list_a.push_back(item_c);
+  sldlist<uint32_t> removed;
+  assert(list_a.remove_if(my_even, removed) == 1);
+  assert(&*removed.front() == &data_b);
+  assert(list_a.size() == 2);
+  assert(&*list_a.front() == &data_a);
+  assert(list_a.remove_if(my_even, removed) == 0);
+  list_a.erase(list_a.front(), list_a.front(), removed);
+  assert(list_a.size() == 2);
+  list_a.erase(list_a.front(), sldlist<uint32_t>::iterator(), removed);
+  assert(list_a.empty() == true);
+  assert(removed.size() == 3);
+  assert(&*removed.back() == &data_c);
+  assert(removed.clear() == 3);
+  list_a.push_back(item_a);
+  list_a.push_back(item_b);
+  list_a.push_back(item_c);
+  sldlist<uint32_t>::iterator range_first(list_a.front());
+  ++range_first;
+  sldlist<uint32_t>::iterator range_last(range_first);
+  ++range_last;
+  list_a.erase(range_first, range_last, removed);
+  assert(removed.size() == 1);
+  assert(&*removed.front() == &data_b);
+  assert(list_a.size() == 2);
+  assert(&*list_a.front() == &data_a);
+  assert(removed.clear() == 1);
+  assert(list_a.clear() == 2);
+
+  // moving and swapping hands over the items in constant time
+  list_a.push_back(item_a);
+  list_a.push_back(item_b);
+  sldlist<uint32_t> list_c(std::move(list_a));
+  assert(list_a.empty() == true);
+  assert(list_c.size() == 2);
+  list_a.swap(list_c);
+  assert(list_c.empty() == true);
+  assert(list_a.size() == 2);
+  list_c.push_back(item_c);
+  list_c = std::move(list_a);
+  assert(list_a.empty() == true);
+  assert(list_c.size() == 2);
+  assert(list_c.contains(data_c) == false);
+  assert(list_c.contains(data_a) == true);
+  assert(list_c.clear() == 2);
+
+  // generic code works on the static base class
+  list_a.push_back(item_a);
+  list_a.push_back(item_b);
+  assert(my_drain(list_a) == 2);
+
   return;
 }
 
@@ -600,6 +747,146 @@ void slodlist_test()
   list_a.sort();
   assert((*list_a.min() <= *list_a.max()) == true);
 
+  // modified items move towards the minimum or the maximum
+  assert(list_a.clear() == 3);
+  data_a = 1;
+  data_b = 2;
+  data_c = 3;
+  list_a.insert(item_a);
+  list_a.insert(item_b);
+  list_a.insert(item_c);
+  slodlist<uint32_t>::iterator it(list_a.min());
+  ++it;
+  data_c = 0;
+  list_a.update_after(it);
+  assert(&*list_a.min() == &data_c);
+  assert(&*list_a.max() == &data_b);
+  data_c = 5;
+  list_a.update_after(slodlist<uint32_t>::iterator());
+  assert(&*list_a.min() == &data_a);
+  assert(&*list_a.max() == &data_c);
+  data_a = 4;
+  list_a.update_after(slodlist<uint32_t>::iterator());
+  assert(&*list_a.min() == &data_b);
+  it = list_a.min();
+  assert(&*(++it) == &data_a);
+  assert(list_a.size() == 3);
+  assert(list_a.removeMax() == &item_c);
+  assert(list_a.removeMin() == &item_b);
+  list_a.update_after(slodlist<uint32_t>::iterator());
+  assert(list_a.removeMin() == &item_a);
+  assert(list_a.empty() == true);
+
+  // value based lookups stop at the position of the key
+  data_a = 1;
+  data_b = 3;
+  data_c = 3;
+  list_a.insert(item_a);
+  list_a.insert(item_b);
+  list_a.insert(item_c);
+  assert(list_a.find(0).valid() == false);
+  assert(list_a.find(2).valid() == false);
+  assert(list_a.find(4).valid() == false);
+  assert(&*list_a.find(1) == &data_a);
+  assert(*list_a.find(3) == 3);
+  assert(&*list_a.lower_bound(0) == &data_a);
+  assert(&*list_a.lower_bound(1) == &data_a);
+  assert(*list_a.lower_bound(2) == 3);
+  assert(list_a.lower_bound(4).valid() == false);
+  assert(&*list_a.upper_bound(0) == &data_a);
+  assert(*list_a.upper_bound(1) == 3);
+  assert(list_a.upper_bound(3).valid() == false);
+  std::pair<slodlist<uint32_t>::iterator, slodlist<uint32_t>::iterator> range(list_a.equal_range(3));
+  size_t cnt(0);
+  for (slodlist<uint32_t>::iterator it = range.first; it != range.second; ++it) {
+    assert(*it == 3);
+    ++cnt;
+  }
+  assert(cnt == 2);
+  range = list_a.equal_range(2);
+  assert(range.first == range.second);
+  assert(list_a.clear() == 3);
+  assert(list_a.lower_bound(0).valid() == false);
+
+  // the prefix of smaller items is extracted at once
+  data_a = 1;
+  data_b = 2;
+  data_c = 3;
+  list_a.insert(item_c);
+  list_a.insert(item_a);
+  list_a.insert(item_b);
+  sldlist<uint32_t> out;
+  assert(list_a.extract_before(1, out) == 0);
+  assert(out.empty() == true);
+  assert(list_a.extract_before(3, out) == 2);
+  assert(&*out.front() == &data_a);
+  assert(&*out.back() == &data_b);
+  assert(&*list_a.min() == &data_c);
+  assert(list_a.size() == 1);
+  assert(list_a.extract_before(4, out) == 1);
+  assert(list_a.empty() == true);
+  assert(out.size() == 3);
+  assert(&*out.back() == &data_c);
+  assert(list_a.extract_before(4, out) == 0);
+  assert(out.clear() == 3);
+
+  // matching items and ranges are removed in a single pass
+  data_a = 1;
+  data_b = 2;
+  data_c = 3;
+  list_a.insert(item_a);
+  list_a.insert(item_b);
+  list_a.insert(item_c);
+  sldlist<uint32_t> removed;
+  assert(list_a.remove_if(my_even, removed) == 1);
+  assert(&*removed.front() == &data_b);
+  assert(list_a.size() == 2);
+  assert(&*list_a.min() == &data_a);
+  assert(list_a.remove_if(my_even, removed) == 0);
+  list_a.erase(list_a.min(), list_a.min(), removed);
+  assert(list_a.size() == 2);
+  list_a.erase(list_a.min(), slodlist<uint32_t>::iterator(), removed);
+  assert(list_a.empty() == true);
+  assert(removed.size() == 3);
+  assert(&*removed.back() == &data_c);
+  assert(removed.clear() == 3);
+  list_a.insert(item_a);
+  list_a.insert(item_b);
+  list_a.insert(item_c);
+  slodlist<uint32_t>::iterator range_first(list_a.min());
+  ++range_first;
+  slodlist<uint32_t>::iterator range_last(range_first);
+  ++range_last;
+  list_a.erase(range_first, range_last, removed);
+  assert(removed.size() == 1);
+  assert(&*removed.front() == &data_b);
+  assert(list_a.size() == 2);
+  assert(&*list_a.min() == &data_a);
+  assert(removed.clear() == 1);
+  assert(list_a.clear() == 2);
+
+  // moving and swapping hands over the items in constant time
+  list_a.insert(item_a);
+  list_a.insert(item_b);
+  slodlist<uint32_t> list_c(std::move(list_a));
+  assert(list_a.empty() == true);
+  assert(list_c.size() == 2);
+  list_a.swap(list_c);
+  assert(list_c.empty() == true);
+  assert(list_a.size() == 2);
+  list_c.insert(item_c);
+  list_c = std::move(list_a);
+  assert(list_a.empty() == true);
+  assert(list_c.size() == 2);
+  assert(list_c.contains(data_c) == false);
+  assert(list_c.contains(data_a) == true);
+  assert(list_c.clear() == 2);
+
+  // generic code works on the static base class
+  list_a.insert(item_a);
+  list_a.insert(item_b);
+  assert(my_drain(list_a) == 2);
+
   return;
 }
 
@@ -769,6 +1056,80 @@ void slcdlist_test()
   assert(list_a.clear() == 1);
   assert(list_a.empty() == true);
 
+  list_a.rotate();
+  assert(list_a.empty() == true);
+  list_a.insert(item_a);
+  list_a.insert(item_b);
+  list_a.insert(item_c);
+  list_a.rotate();
+  assert(&(*list_a.eldest()) == &data_b);
+  assert(&(*list_a.latest()) == &data_a);
+  list_a.rotate();
+  list_a.rotate();
+  assert(&(*list_a.eldest()) == &data_a);
+  assert(list_a.size() == 3);
+  assert(list_a.clear() == 3);
+  assert(list_a.empty() == true);
+
+  // matching items and ranges are removed in a single pass
+  data_a = 1;
+  data_b = 2;
+  data_c = 3;
+  list_a.insert(item_a);
+  list_a.insert(item_b);
+  list_a.insert(item_c);
+  sldlist<uint32_t> removed;
+  assert(list_a.remove_if(my_even, removed) == 1);
+  assert(&*removed.front() == &data_b);
+  assert(list_a.size() == 2);
+  assert(&*list_a.eldest() == &data_a);
+  assert(&*list_a.latest() == &data_c);
+  assert(list_a.remove_if(my_even, removed) == 0);
+  list_a.erase(list_a.eldest(), list_a.eldest(), removed);
+  assert(list_a.size() == 2);
+  list_a.erase(list_a.eldest(), slcdlist<uint32_t>::iterator(), removed);
+  assert(list_a.empty() == true);
+  assert(removed.size() == 3);
+  assert(&*removed.back() == &data_c);
+  assert(removed.clear() == 3);
+  list_a.insert(item_a);
+  list_a.insert(item_b);
+  list_a.insert(item_c);
+  slcdlist<uint32_t>::iterator range_first(list_a.eldest());
+  ++range_first;
+  slcdlist<uint32_t>::iterator range_last(range_first);
+  ++range_last;
+  list_a.erase(range_first, range_last, removed);
+  assert(removed.size() == 1);
+  assert(&*removed.front() == &data_b);
+  assert(list_a.size() == 2);
+  assert(&*list_a.eldest() == &data_a);
+  assert(&*list_a.latest() == &data_c);
+  assert(removed.clear() == 1);
+  assert(list_a.clear() == 2);
+
+  // moving and swapping hands over the items in constant time
+  list_a.insert(item_a);
+  list_a.insert(item_b);
+  slcdlist<uint32_t> list_c(std::move(list_a));
+  assert(list_a.empty() == true);
+  assert(list_c.size() == 2);
+  list_a.swap(list_c);
+  assert(list_c.empty() == true);
+  assert(list_a.size() == 2);
+  list_c.insert(item_c);
+  list_c = std::move(list_a);
+  assert(list_a.empty() == true);
+  assert(list_c.size() == 2);
+  assert(list_c.contains(data_c) == false);
+  assert(list_c.contains(data_a) == true);
+  assert(list_c.clear() == 2);
+
+  // generic code works on the static base class
+  list_a.insert(item_a);
+  list_a.insert(item_b);
+  assert(my_drain(list_a) == 2);
+
   return;
 }
 
@@ -805,6 +1166,8 @@ void dldlist_test()
 
   assert(list_a.empty() == false);
   assert(list_a.size() == 1);
+  assert(item_b.attached() == true);
+  assert(list_a.back().peek(-1) == nullptr);
 
   assert(list_a.contains(data_a) == false);
   assert(list_a.contains(data_b) == true);
@@ -943,6 +1306,87 @@ void dldlist_test()
   assert(list_a.clear() == 1);
   assert(list_a.empty() == true);
 
+  list_a.splice_back(list_b);
+  assert(list_a.empty() == true);
+  list_b.push_back(item_a);
+  list_a.splice_back(list_b);
+  assert(list_b.empty() == true);
+  assert(list_a.size() == 1);
+  list_b.push_back(item_b);
+  list_b.push_back(item_c);
+  list_a.splice_back(list_b);
+  assert(list_b.empty() == true);
+  assert(list_a.size() == 3);
+  assert(list_a.pop_back() == &item_c);
+  assert(list_a.pop_back() == &item_b);
+  assert(list_a.pop_back() == &item_a);
+  assert(list_a.empty() == true);
+
+  // matching items and ranges are removed in a single pass
+  data_a = 1;
+  data_b = 2;
+  data_c = 3;
+  list_a.push_back(item_a);
+  list_a.push_back(item_b);
+  list_a.push_back(item_c);
+  dldlist<uint32_t> removed;
+  assert(list_a.remove_if(my_even, removed) == 1);
+  assert(&*removed.front() == &data_b);
+  assert(list_a.size() == 2);
+  assert(&*list_a.front() == &data_a);
+  assert(list_a.remove_if(my_even, removed) == 0);
+  list_a.erase(list_a.front(), list_a.front(), removed);
+  assert(list_a.size() == 2);
+  list_a.erase(list_a.front(), dldlist<uint32_t>::iterator(), removed);
+  assert(list_a.empty() == true);
+  assert(removed.size() == 3);
+  assert(&*removed.back() == &data_c);
+  assert(removed.clear() == 3);
+  list_a.push_back(item_a);
+  list_a.push_back(item_b);
+  list_a.push_back(item_c);
+  dldlist<uint32_t>::iterator range_first(list_a.front());
+  ++range_first;
+  dldlist<uint32_t>::iterator range_last(range_first);
+  ++range_last;
+  list_a.erase(range_first, range_last, removed);
+  assert(removed.size() == 1);
+  assert(&*removed.front() == &data_b);
+  assert(list_a.size() == 2);
+  assert(&*list_a.front() == &data_a);
+  assert(removed.clear() == 1);
+  assert(list_a.clear() == 2);
+
+  // moving and swapping hands over the items in constant time
+  list_a.push_back(item_a);
+  list_a.push_back(item_b);
+  dldlist<uint32_t> list_c(std::move(list_a));
+  assert(list_a.empty() == true);
+  assert(list_c.size() == 2);
+  list_a.swap(list_c);
+  assert(list_c.empty() == true);
+  assert(list_a.size() == 2);
+  list_c.push_back(item_c);
+  list_c = std::move(list_a);
+  assert(list_a.empty() == true);
+  assert(list_c.size() == 2);
+  assert(list_c.contains(data_c) == false);
+  assert(list_c.contains(data_a) == true);
+  assert(list_c.clear() == 2);
+
+  // lists can be stored in containers that relocate them
+  vector<dldlist<uint32_t>> lists(1);
+  lists[0].push_back(item_a);
+  lists.resize(16);
+  assert(lists[0].size() == 1);
+  assert(&*lists[0].front() == &data_a);
+  assert(lists[0].clear() == 1);
+
+  // generic code works on the static base class
+  list_a.push_back(item_a);
+  list_a.push_back(item_b);
+  assert(my_drain(list_a) == 2);
+
   return;
 }
 
@@ -1124,6 +1568,150 @@ void dlodlist_test()
   list_a.sort();
   assert((*list_a.min() <= *list_a.max()) == true);
 
+  // modified items move towards the minimum or the maximum
+  assert(list_a.clear() == 3);
+  data_a = 1;
+  data_b = 2;
+  data_c = 3;
+  list_a.insert(item_a);
+  list_a.insert(item_b);
+  list_a.insert(item_c);
+  data_c = 0;
+  list_a.update(item_c);
+  assert(&*list_a.min() == &data_c);
+  assert(&*list_a.max() == &data_b);
+  data_c = 5;
+  list_a.update(item_c);
+  assert(&*list_a.min() == &data_a);
+  assert(&*list_a.max() == &data_c);
+  data_b = 6;
+  list_a.update(item_b);
+  assert(&*list_a.max() == &data_b);
+  data_a = 7;
+  list_a.update(item_a);
+  data_b = 4;
+  list_a.update(item_b);
+  dlodlist<uint32_t>::iterator it(list_a.min());
+  assert(&*it == &data_b);
+  assert(&*(++it) == &data_c);
+  assert(&*(--it) == &data_b);
+  assert(list_a.size() == 3);
+  assert(list_a.removeMin() == &item_b);
+  assert(list_a.removeMin() == &item_c);
+  list_a.update(item_a);
+  assert(list_a.removeMin() == &item_a);
+  assert(list_a.empty() == true);
+
+  // value based lookups stop at the position of the key
+  data_a = 1;
+  data_b = 3;
+  data_c = 3;
+  list_a.insert(item_a);
+  list_a.insert(item_b);
+  list_a.insert(item_c);
+  assert(list_a.find(0).valid() == false);
+  assert(list_a.find(2).valid() == false);
+  assert(list_a.find(4).valid() == false);
+  assert(&*list_a.find(1) == &data_a);
+  assert(*list_a.find(3) == 3);
+  assert(&*list_a.lower_bound(0) == &data_a);
+  assert(&*list_a.lower_bound(1) == &data_a);
+  assert(*list_a.lower_bound(2) == 3);
+  assert(list_a.lower_bound(4).valid() == false);
+  assert(&*list_a.upper_bound(0) == &data_a);
+  assert(*list_a.upper_bound(1) == 3);
+  assert(list_a.upper_bound(3).valid() == false);
+  std::pair<dlodlist<uint32_t>::iterator, dlodlist<uint32_t>::iterator> range(list_a.equal_range(3));
+  size_t cnt(0);
+  for (dlodlist<uint32_t>::iterator it = range.first; it != range.second; ++it) {
+    assert(*it == 3);
+    ++cnt;
+  }
+  assert(cnt == 2);
+  range = list_a.equal_range(2);
+  assert(range.first == range.second);
+  assert(list_a.clear() == 3);
+  assert(list_a.lower_bound(0).valid() == false);
+
+  // the prefix of smaller items is extracted at once
+  data_a = 1;
+  data_b = 2;
+  data_c = 3;
+  list_a.insert(item_c);
+  list_a.insert(item_a);
+  list_a.insert(item_b);
+  dldlist<uint32_t> out;
+  assert(list_a.extract_before(1, out) == 0);
+  assert(out.empty() == true);
+  assert(list_a.extract_before(3, out) == 2);
+  assert(&*out.front() == &data_a);
+  assert(&*out.back() == &data_b);
+  assert(&*list_a.min() == &data_c);
+  assert(list_a.size() == 1);
+  assert(list_a.extract_before(4, out) == 1);
+  assert(list_a.empty() == true);
+  assert(out.size() == 3);
+  assert(&*out.back() == &data_c);
+  assert(list_a.extract_before(4, out) == 0);
+  assert(out.clear() == 3);
+
+  // matching items and ranges are removed in a single pass
+  data_a = 1;
+  data_b = 2;
+  data_c = 3;
+  list_a.insert(item_a);
+  list_a.insert(item_b);
+  list_a.insert(item_c);
+  dldlist<uint32_t> removed;
+  assert(list_a.remove_if(my_even, removed) == 1);
+  assert(&*removed.front() == &data_b);
+  assert(list_a.size() == 2);
+  assert(&*list_a.min() == &data_a);
+  assert(list_a.remove_if(my_even, removed) == 0);
+  list_a.erase(list_a.min(), list_a.min(), removed);
+  assert(list_a.size() == 2);
+  list_a.erase(list_a.min(), dlodlist<uint32_t>::iterator(), removed);
+  assert(list_a.empty() == true);
+  assert(removed.size() == 3);
+  assert(&*removed.back() == &data_c);
+  assert(removed.clear() == 3);
+  list_a.insert(item_a);
+  list_a.insert(item_b);
+  list_a.insert(item_c);
+  dlodlist<uint32_t>::iterator range_first(list_a.min());
+  ++range_first;
+  dlodlist<uint32_t>::iterator range_last(range_first);
+  ++range_last;
+  list_a.erase(range_first, range_last, removed);
+  assert(removed.size() == 1);
+  assert(&*removed.front() == &data_b);
+  assert(list_a.size() == 2);
+  assert(&*list_a.min() == &data_a);
+  assert(removed.clear() == 1);
+  assert(list_a.clear() == 2);
+
+  // moving and swapping hands over the items in constant time
+  list_a.insert(item_a);
+  list_a.insert(item_b);
+  dlodlist<uint32_t> list_c(std::move(list_a));
+  assert(list_a.empty() == true);
+  assert(list_c.size() == 2);
+  list_a.swap(list_c);
+  assert(list_c.empty() == true);
+  assert(list_a.size() == 2);
+  list_c.insert(item_c);
+  list_c = std::move(list_a);
+  assert(list_a.empty() == true);
+  assert(list_c.size() == 2);
+  assert(list_c.contains(data_c) == false);
+  assert(list_c.contains(data_a) == true);
+  assert(list_c.clear() == 2);
+
+  // generic code works on the static base class
+  list_a.insert(item_a);
+  list_a.insert(item_b);
+  assert(my_drain(list_a) == 2);
+
   return;
 }
 
@@ -1305,6 +1893,1885 @@ void dlcdlist_test()
   assert(list_a.clear() == 1);
   assert(list_a.empty() == true);
 
+  list_a.rotate();
+  assert(list_a.empty() == true);
+  list_a.insert(item_a);
+  list_a.insert(item_b);
+  list_a.insert(item_c);
+  list_a.rotate();
+  assert(&(*list_a.eldest()) == &data_b);
+  assert(&(*list_a.latest()) == &data_a);
+
+  assert(list_a.unlink(item_a) == &item_a);
+  assert(item_a.attached() == false);
+  assert(&(*list_a.latest()) == &data_c);
+  assert(&(*list_a.eldest()) == &data_b);
+  assert(list_a.unlink(item_b) == &item_b);
+  assert(&(*list_a.latest()) == &data_c);
+  assert(&(*list_a.eldest()) == &data_c);
+  assert(list_a.unlink(item_c) == &item_c);
+  assert(list_a.empty() == true);
+
+  // matching items and ranges are removed in a single pass
+  data_a = 1;
+  data_b = 2;
+  data_c = 3;
+  list_a.insert(item_a);
+  list_a.insert(item_b);
+  list_a.insert(item_c);
+  dldlist<uint32_t> removed;
+  assert(list_a.remove_if(my_even, removed) == 1);
+  assert(&*removed.front() == &data_b);
+  assert(list_a.size() == 2);
+  assert(&*list_a.eldest() == &data_a);
+  assert(&*list_a.latest() == &data_c);
+  assert(list_a.remove_if(my_even, removed) == 0);
+  list_a.erase(list_a.eldest(), list_a.eldest(), removed);
+  assert(list_a.size() == 2);
+  list_a.erase(list_a.eldest(), dlcdlist<uint32_t>::iterator(), removed);
+  assert(list_a.empty() == true);
+  assert(removed.size() == 3);
+  assert(&*removed.back() == &data_c);
+  assert(removed.clear() == 3);
+  list_a.insert(item_a);
+  list_a.insert(item_b);
+  list_a.insert(item_c);
+  dlcdlist<uint32_t>::iterator range_first(list_a.eldest());
+  ++range_first;
+  dlcdlist<uint32_t>::iterator range_last(range_first);
+  ++range_last;
+  list_a.erase(range_first, range_last, removed);
+  assert(removed.size() == 1);
+  assert(&*removed.front() == &data_b);
+  assert(list_a.size() == 2);
+  assert(&*list_a.eldest() == &data_a);
+  assert(&*list_a.latest() == &data_c);
+  assert(removed.clear() == 1);
+  assert(list_a.clear() == 2);
+
+  // moving and swapping hands over the items in constant time
+  list_a.insert(item_a);
+  list_a.insert(item_b);
+  dlcdlist<uint32_t> list_c(std::move(list_a));
+  assert(list_a.empty() == true);
+  assert(list_c.size() == 2);
+  list_a.swap(list_c);
+  assert(list_c.empty() == true);
+  assert(list_a.size() == 2);
+  list_c.insert(item_c);
+  list_c = std::move(list_a);
+  assert(list_a.empty() == true);
+  assert(list_c.size() == 2);
+  assert(list_c.contains(data_c) == false);
+  assert(list_c.contains(data_a) == true);
+  assert(list_c.clear() == 2);
+
+  // generic code works on the static base class
+  list_a.insert(item_a);
+  list_a.insert(item_b);
+  assert(my_drain(list_a) == 2);
+
+  return;
+}
+
+void multiqueue_test()
+{
+  uint32_t data[8] = {5, 3, 7, 1, 6, 2, 8, 4};
+
+  dlodlist<uint32_t>::item item_0(data[0]);
+  dlodlist<uint32_t>::item item_1(data[1]);
+  dlodlist<uint32_t>::item item_2(data[2]);
+  dlodlist<uint32_t>::item item_3(data[3]);
+  dlodlist<uint32_t>::item item_4(data[4]);
+  dlodlist<uint32_t>::item item_5(data[5]);
+  dlodlist<uint32_t>::item item_6(data[6]);
+  dlodlist<uint32_t>::item item_7(data[7]);
+
+  // a single shard behaves exactly like a dlodlist
+  multiqueue<uint32_t> queue_a(1, 1, my_cmp);
+
+  assert(queue_a.shards() == 1);
+  assert(queue_a.empty() == true);
+  assert(queue_a.size() == 0);
+  assert(queue_a.removeMin() == nullptr);
+  assert(queue_a.clear() == 0);
+
+  queue_a.insert(item_0);
+  queue_a.insert(item_1);
+  queue_a.insert(item_2);
+  queue_a.insert(item_3);
+
+  assert(queue_a.empty() == false);
+  assert(queue_a.size() == 4);
+
+  assert(queue_a.removeMin() == &item_3);
+  assert(queue_a.removeMin() == &item_1);
+  assert(queue_a.removeMin() == &item_0);
+  assert(queue_a.removeMin() == &item_2);
+  assert(queue_a.removeMin() == nullptr);
+  assert(queue_a.empty() == true);
+
+  // multiple shards return every item exactly once
+  multiqueue<uint32_t> queue_b(4);
+
+  assert(queue_b.shards() == 8);
+
+  queue_b.insert(item_0);
+  queue_b.insert(item_1);
+  queue_b.insert(item_2);
+  queue_b.insert(item_3);
+  queue_b.insert(item_4);
+  queue_b.insert(item_5);
+  queue_b.insert(item_6);
+  queue_b.insert(item_7);
+
+  assert(queue_b.size() == 8);
+
+  uint32_t sum(0);
+  for (unsigned int i = 0; i < 8; ++i) {
+    dlodlist<uint32_t>::item* item(queue_b.removeMin());
+    assert(item != nullptr);
+    assert(item->attached() == false);
+    sum += **item;
+  }
+  assert(sum == 36);
+  assert(queue_b.removeMin() == nullptr);
+  assert(queue_b.empty() == true);
+
+  queue_b.insert(item_0);
+  queue_b.insert(item_1);
+  assert(queue_b.clear() == 2);
+  assert(queue_b.empty() == true);
+
+  // concurrent inserts and removals neither lose nor duplicate items
+  const unsigned int threads = 4;
+  const unsigned int items_per_thread = 1000;
+  multiqueue<uint32_t> queue_c(threads);
+  std::deque<uint32_t> keys;
+  std::deque<dlodlist<uint32_t>::item> items;
+  for (unsigned int i = 0; i < threads * items_per_thread; ++i) {
+    keys.push_back(i);
+  }
+  for (unsigned int i = 0; i < threads * items_per_thread; ++i) {
+    items.emplace_back(keys[i]);
+  }
+  std::vector<std::atomic<uint32_t>> removed(threads * items_per_thread);
+  std::vector<std::thread> workers;
+  for (unsigned int t = 0; t < threads; ++t) {
+    workers.emplace_back([&, t]() {
+      for (unsigned int i = 0; i < items_per_thread; ++i) {
+        queue_c.insert(items[t * items_per_thread + i]);
+        if (i % 2 == 1) {
+          // the emptiness check of removeMin() is not linearizable, so a nullpointer is tolerated
+          dlodlist<uint32_t>::item* item(queue_c.removeMin());
+          if (item != nullptr) {
+            removed[**item].fetch_add(1, std::memory_order_relaxed);
+          }
+        }
+      }
+    });
+  }
+  for (std::thread& w : workers) {
+    w.join();
+  }
+  while (dlodlist<uint32_t>::item* item = queue_c.removeMin()) {
+    ++removed[**item];
+  }
+  for (unsigned int i = 0; i < threads * items_per_thread; ++i) {
+    assert(removed[i] == 1);
+  }
+
+  return;
+}
+
+void rcudldlist_test()
+{
+  uint32_t data_a = 1;
+  uint32_t data_b = 2;
+  uint32_t data_c = 3;
+
+  rcudldlist<uint32_t>::item item_a(data_a);
+  rcudldlist<uint32_t>::item item_b(data_b);
+  rcudldlist<uint32_t>::item item_c(data_c);
+
+  rcudomain domain(4);
+  rcureader reader(domain);
+  rcudldlist<uint32_t> list_a(domain);
+
+  // the read-side iterator refers to payloads
+  static_assert(std::is_same<std::iterator_traits<rcudldlist<uint32_t>::iterator>::iterator_category, std::forward_iterator_tag>::value, "rcuiterator must be a forward iterator");
+  static_assert(std::is_same<std::iterator_traits<rcudldlist<uint32_t>::iterator>::reference, uint32_t&>::value, "rcuiterator must refer to payloads");
+
+  assert(domain.readers() == 4);
+
+  assert(list_a.empty() == true);
+  assert(list_a.size() == 0);
+  assert(list_a.front().valid() == false);
+  assert(list_a.pop_front() == nullptr);
+  assert(list_a.pop_back() == nullptr);
+  assert(list_a.remove(data_a) == nullptr);
+  assert(list_a.synchronize() == 0);
+
+  list_a.push_back(item_b);
+  list_a.push_back(item_c);
+  list_a.push_front(item_a);
+
+  assert(list_a.empty() == false);
+  assert(list_a.size() == 3);
+  assert(list_a.contains(data_a) == true);
+  assert(list_a.contains(data_b) == true);
+  assert(list_a.contains(data_c) == true);
+
+  {
+    std::lock_guard<rcureader> guard(reader);
+    rcudldlist<uint32_t>::iterator it(list_a.front());
+    assert(it.valid() == true);
+    assert(*it == data_a);
+    ++it;
+    assert(it.operator->() == &data_b);
+    ++it;
+    assert(*it == data_c);
+    ++it;
+    assert(it.valid() == false);
+  }
+
+  // an unlinked item keeps its forward link and stays attached until the grace period
+  {
+    std::lock_guard<rcureader> guard(reader);
+    rcudldlist<uint32_t>::iterator it_b(list_a.front());
+    ++it_b;
+    assert(list_a.remove(data_b) == &item_b);
+    assert(list_a.size() == 2);
+    assert(list_a.contains(data_b) == false);
+    assert(item_b.attached() == true);
+    ++it_b;
+    assert(*it_b == data_c);
+  }
+  assert(list_a.synchronize() == 1);
+  assert(item_b.attached() == false);
+
+  assert(list_a.unlink(item_c) == &item_c);
+  assert(list_a.pop_back() == &item_a);
+  assert(list_a.empty() == true);
+  assert(list_a.synchronize() == 2);
+  assert(item_a.attached() == false);
+  assert(item_c.attached() == false);
+
+  list_a.push_back(item_a);
+  list_a.push_back(item_b);
+  assert(list_a.pop_front() == &item_a);
+  list_a.push_front(item_c);
+  assert(list_a.clear() == 2);
+  assert(list_a.synchronize() == 0);
+  assert(list_a.empty() == true);
+  assert(item_a.attached() == false);
+  assert(item_b.attached() == false);
+  assert(item_c.attached() == false);
+
+  // a single item is attached, no matter from which end it has been pushed
+  list_a.push_front(item_a);
+  assert(item_a.attached() == true);
+  assert(list_a.unlink(item_a) == &item_a);
+  list_a.push_back(item_b);
+  assert(item_b.attached() == true);
+  assert(list_a.pop_front() == &item_b);
+  assert(list_a.empty() == true);
+  assert(list_a.synchronize() == 2);
+  assert(item_a.attached() == false);
+  assert(item_b.attached() == false);
+
+  // concurrent readers never observe an item that has been reused after a grace period
+  const unsigned int routes = 16;
+  std::deque<uint32_t> values;
+  std::deque<rcudldlist<uint32_t>::item> items;
+  for (unsigned int r = 0; r < routes; ++r) {
+    values.push_back(r + 1);
+  }
+  for (unsigned int r = 0; r < routes; ++r) {
+    items.emplace_back(values[r]);
+    list_a.push_back(items[r]);
+  }
+  std::atomic<bool> stop(false);
+  std::vector<std::thread> readers;
+  for (unsigned int t = 0; t < 2; ++t) {
+    readers.emplace_back([&]() {
+      rcureader local(domain);
+      while (!stop.load(std::memory_order_relaxed)) {
+        std::lock_guard<rcureader> guard(local);
+        for (rcudldlist<uint32_t>::iterator it = list_a.front(); it.valid(); ++it) {
+          assert(*it != 0);
+        }
+      }
+    });
+  }
+  for (unsigned int n = 0; n < 200; ++n) {
+    rcudldlist<uint32_t>::item* item(list_a.pop_front());
+    list_a.synchronize();
+    // poison the payload while no reader can see it, then republish it
+    uint32_t value(**item);
+    **item = 0;
+    std::this_thread::yield();
+    **item = value;
+    list_a.push_back(*item);
+  }
+  stop.store(true);
+  for (std::thread& r : readers) {
+    r.join();
+  }
+  assert(list_a.size() == routes);
+  assert(list_a.clear() == routes);
+
+  return;
+}
+
+template<typename LIST>
+void seqcdlist_test()
+{
+  uint32_t data_a = 1;
+  uint32_t data_b = 2;
+  uint32_t data_c = 3;
+  uint32_t* out[4];
+
+  typename LIST::item item_a(data_a);
+  typename LIST::item item_b(data_b);
+  typename LIST::item item_c(data_c);
+
+  LIST list_a;
+
+  assert(list_a.empty() == true);
+  assert(list_a.size() == 0);
+  assert(list_a.latest().valid() == false);
+  assert(list_a.snapshot(out, 4) == 0);
+  assert(list_a.removeLatest() == nullptr);
+  assert(list_a.remove_eldest() == nullptr);
+
+  list_a.insert(item_a);
+  list_a.insert(item_b);
+  list_a.insert(item_c);
+
+  assert(list_a.empty() == false);
+  assert(list_a.size() == 3);
+  assert(list_a.contains(data_a) == true);
+  assert(list_a.contains(data_b) == true);
+  assert(list_a.contains(data_c) == true);
+  assert(*list_a.latest() == data_c);
+  assert(*list_a.eldest() == data_a);
+
+  assert(list_a.snapshot(out, 4) == 3);
+  assert(out[0] == &data_c);
+  assert(out[1] == &data_b);
+  assert(out[2] == &data_a);
+  assert(list_a.snapshot(out, 2) == 2);
+  assert(out[0] == &data_c);
+  assert(out[1] == &data_b);
+
+  assert(list_a.remove_eldest() == &item_a);
+  assert(item_a.attached() == false);
+  assert(list_a.size() == 2);
+  assert(list_a.removeLatest() == &item_c);
+  assert(item_c.attached() == false);
+  assert(list_a.size() == 1);
+  assert(list_a.snapshot(out, 4) == 1);
+  assert(out[0] == &data_b);
+  assert(list_a.removeLatest() == &item_b);
+  assert(list_a.empty() == true);
+  assert(list_a.latest().valid() == false);
+
+  list_a.insert(item_a);
+  list_a.insert(item_b);
+  assert(list_a.clear() == 2);
+  assert(list_a.empty() == true);
+  assert(item_a.attached() == false);
+  assert(item_b.attached() == false);
+
+  // concurrent snapshots of a bounded history always contain consecutive events
+  const unsigned int capacity = 8;
+  const unsigned int pool = capacity + 1;
+  std::deque<uint32_t> values;
+  std::deque<typename LIST::item> items;
+  for (unsigned int p = 0; p < pool; ++p) {
+    values.push_back(p);
+  }
+  for (unsigned int p = 0; p < pool; ++p) {
+    items.emplace_back(values[p]);
+  }
+  std::atomic<bool> stop(false);
+  std::vector<std::thread> readers;
+  for (unsigned int t = 0; t < 2; ++t) {
+    readers.emplace_back([&]() {
+      uint32_t* history[capacity];
+      while (!stop.load(std::memory_order_relaxed)) {
+        const size_t cnt(list_a.snapshot(history, capacity));
+        for (size_t h = 1; h < cnt; ++h) {
+          assert(history[h] == &values[(history[h - 1] - &values[0] + pool - 1) % pool]);
+        }
+      }
+    });
+  }
+  for (unsigned int n = 0; n < 100000; ++n) {
+    if (list_a.size() == capacity) {
+      list_a.remove_eldest();
+    }
+    list_a.insert(items[n % pool]);
+  }
+  stop.store(true);
+  for (std::thread& r : readers) {
+    r.join();
+  }
+  assert(list_a.size() == capacity);
+  assert(list_a.clear() == capacity);
+
+  return;
+}
+
+void wsdeque_test()
+{
+  uint32_t data_a = 1;
+  uint32_t data_b = 2;
+  uint32_t data_c = 3;
+
+  wsdeque<uint32_t>::item item_a(data_a);
+  wsdeque<uint32_t>::item item_b(data_b);
+  wsdeque<uint32_t>::item item_c(data_c);
+
+  wsdeque<uint32_t> deque_a(2);
+
+  assert(deque_a.capacity() == 2);
+  assert(deque_a.empty() == true);
+  assert(deque_a.size() == 0);
+  assert(deque_a.pop_back() == nullptr);
+  assert(deque_a.pop_front() == nullptr);
+
+  // the owner works in LIFO order, thieves in FIFO order
+  deque_a.push_back(item_a);
+  deque_a.push_back(item_b);
+  deque_a.push_back(item_c);
+  assert(deque_a.capacity() == 4);
+  assert(deque_a.empty() == false);
+  assert(deque_a.size() == 3);
+  assert(deque_a.pop_back() == &item_c);
+  assert(deque_a.pop_front() == &item_a);
+  assert(deque_a.size() == 1);
+  assert(deque_a.pop_back() == &item_b);
+  assert(deque_a.empty() == true);
+  assert(deque_a.pop_back() == nullptr);
+  assert(deque_a.pop_front() == nullptr);
+
+  deque_a.push_back(item_a);
+  assert(deque_a.pop_front() == &item_a);
+  assert(deque_a.pop_back() == nullptr);
+
+  wsdeque<uint32_t, SINGLY_LINKED>::item item_d(data_a);
+  wsdeque<uint32_t, SINGLY_LINKED> deque_b;
+  deque_b.push_back(item_d);
+  assert(deque_b.pop_back() == &item_d);
+
+  // each item is either popped by the owner or stolen by exactly one thief
+  const unsigned int n = 1 << 16;
+  std::deque<uint32_t> values;
+  std::deque<wsdeque<uint32_t>::item> items;
+  for (unsigned int v = 0; v < n; ++v) {
+    values.push_back(v);
+  }
+  for (unsigned int v = 0; v < n; ++v) {
+    items.emplace_back(values[v]);
+  }
+  std::vector<std::atomic<uint32_t>> taken(n);
+  std::atomic<bool> stop(false);
+  std::vector<std::thread> thieves;
+  for (unsigned int t = 0; t < 2; ++t) {
+    thieves.emplace_back([&]() {
+      while (true) {
+        const bool done(stop.load(std::memory_order_acquire));
+        wsdeque<uint32_t>::item* i(deque_a.pop_front());
+        if (i != nullptr) {
+          ++taken[**i];
+        } else if (done) {
+          break;
+        }
+      }
+    });
+  }
+  for (unsigned int v = 0; v < n; ++v) {
+    deque_a.push_back(items[v]);
+    if (v % 3 == 0) {
+      wsdeque<uint32_t>::item* i(deque_a.pop_back());
+      if (i != nullptr) {
+        ++taken[**i];
+      }
+    }
+  }
+  stop.store(true, std::memory_order_release);
+  for (std::thread& t : thieves) {
+    t.join();
+  }
+  assert(deque_a.empty() == true);
+  for (unsigned int v = 0; v < n; ++v) {
+    assert(taken[v] == 1);
+  }
+
+  return;
+}
+
+void blockqueue_test()
+{
+  uint32_t data_a = 1;
+  uint32_t data_b = 2;
+  uint32_t data_c = 3;
+
+  blockqueue<sldlist<uint32_t>>::item item_a(data_a);
+  blockqueue<sldlist<uint32_t>>::item item_b(data_b);
+  blockqueue<sldlist<uint32_t>>::item item_c(data_c);
+
+  blockqueue<sldlist<uint32_t>> queue_a;
+  sldlist<uint32_t> list_a;
+
+  assert(queue_a.empty() == true);
+  assert(queue_a.size() == 0);
+  assert(queue_a.try_pop_front() == nullptr);
+  assert(queue_a.pop_front_for(std::chrono::milliseconds(1)) == nullptr);
+
+  queue_a.push_back(item_a);
+  queue_a.push_back(item_b);
+  queue_a.push_back(item_c);
+  assert(queue_a.empty() == false);
+  assert(queue_a.size() == 3);
+  assert(queue_a.pop_front() == &item_a);
+  assert(queue_a.pop_front_for(std::chrono::milliseconds(1)) == &item_b);
+  assert(queue_a.try_pop_front() == &item_c);
+  assert(queue_a.empty() == true);
+
+  queue_a.push_back(item_a);
+  queue_a.push_back(item_b);
+  queue_a.push_back(item_c);
+  assert(queue_a.drain(list_a, 2) == 2);
+  assert(list_a.size() == 2);
+  assert(queue_a.drain(list_a, 2) == 1);
+  assert(queue_a.empty() == true);
+  assert(list_a.pop_front() == &item_a);
+  assert(list_a.pop_front() == &item_b);
+  assert(list_a.pop_front() == &item_c);
+
+  // parked consumers receive every item exactly once
+  const unsigned int consumers = 2;
+  const unsigned int n = 1 << 14;
+  uint32_t stop = n;
+  std::deque<uint32_t> values;
+  std::deque<blockqueue<dldlist<uint32_t>>::item> items;
+  for (unsigned int v = 0; v < n; ++v) {
+    values.push_back(v);
+  }
+  for (unsigned int v = 0; v < n; ++v) {
+    items.emplace_back(values[v]);
+  }
+  std::deque<blockqueue<dldlist<uint32_t>>::item> stops;
+  for (unsigned int c = 0; c < consumers; ++c) {
+    stops.emplace_back(stop);
+  }
+  blockqueue<dldlist<uint32_t>> queue_b;
+  std::vector<std::atomic<uint32_t>> taken(n);
+  std::vector<std::thread> threads;
+  threads.emplace_back([&]() {
+    while (true) {
+      blockqueue<dldlist<uint32_t>>::item* i(queue_b.pop_front());
+      if (**i == stop) {
+        break;
+      }
+      ++taken[**i];
+    }
+  });
+  threads.emplace_back([&]() {
+    dldlist<uint32_t> batch;
+    bool done(false);
+    while (!done) {
+      queue_b.drain(batch, 16);
+      while (blockqueue<dldlist<uint32_t>>::item* i = batch.pop_front()) {
+        // hand a second stop item back to the other consumer
+        if (**i == stop) {
+          if (done) {
+            queue_b.push_back(*i);
+          }
+          done = true;
+        } else {
+          ++taken[**i];
+        }
+      }
+    }
+  });
+  for (unsigned int v = 0; v < n; ++v) {
+    queue_b.push_back(items[v]);
+    if (v % 1024 == 0) {
+      std::this_thread::sleep_for(std::chrono::microseconds(100));
+    }
+  }
+  for (unsigned int c = 0; c < consumers; ++c) {
+    queue_b.push_back(stops[c]);
+  }
+  for (std::thread& t : threads) {
+    t.join();
+  }
+  assert(queue_b.empty() == true);
+  for (unsigned int v = 0; v < n; ++v) {
+    assert(taken[v] == 1);
+  }
+
+  return;
+}
+
+void evqueue_test()
+{
+  uint32_t data_a = 1;
+  uint32_t data_b = 2;
+  uint32_t data_c = 3;
+
+  evqueue<sldlist<uint32_t>>::item item_a(data_a);
+  evqueue<sldlist<uint32_t>>::item item_b(data_b);
+  evqueue<sldlist<uint32_t>>::item item_c(data_c);
+
+  evqueue<sldlist<uint32_t>> queue_a;
+  sldlist<uint32_t> list_a;
+  struct pollfd pfd = {queue_a.fd(), POLLIN, 0};
+
+  assert(queue_a.fd() >= 0);
+  assert(queue_a.empty() == true);
+  assert(poll(&pfd, 1, 0) == 0);
+  assert(queue_a.drain(list_a) == false);
+
+  // only the first of several items raises a notification
+  queue_a.push_back(item_a);
+  queue_a.push_back(item_b);
+  assert(queue_a.empty() == false);
+  assert(poll(&pfd, 1, 0) == 1);
+  uint64_t cnt(0);
+  assert(read(queue_a.fd(), &cnt, sizeof(cnt)) == sizeof(cnt));
+  assert(cnt == 1);
+  assert(poll(&pfd, 1, 0) == 0);
+
+  queue_a.push_back(item_c);
+  assert(poll(&pfd, 1, 0) == 0);
+  assert(queue_a.drain(list_a) == true);
+  assert(queue_a.empty() == true);
+  assert(list_a.pop_front() == &item_a);
+  assert(list_a.pop_front() == &item_b);
+  assert(list_a.pop_front() == &item_c);
+
+  queue_a.push_back(item_a);
+  assert(poll(&pfd, 1, 0) == 1);
+  assert(queue_a.drain(list_a) == true);
+  assert(poll(&pfd, 1, 0) == 0);
+  assert(list_a.pop_front() == &item_a);
+
+  // an epoll loop receives every item exactly once with fewer notifications than items
+  const unsigned int n = 1 << 16;
+  std::deque<uint32_t> values;
+  std::deque<evqueue<dldlist<uint32_t>>::item> items;
+  for (unsigned int v = 0; v < n; ++v) {
+    values.push_back(v);
+  }
+  for (unsigned int v = 0; v < n; ++v) {
+    items.emplace_back(values[v]);
+  }
+  evqueue<dldlist<uint32_t>> queue_b;
+  const int ep(epoll_create1(EPOLL_CLOEXEC));
+  struct epoll_event ev;
+  ev.events = EPOLLIN;
+  ev.data.ptr = &queue_b;
+  assert(epoll_ctl(ep, EPOLL_CTL_ADD, queue_b.fd(), &ev) == 0);
+  std::thread producer([&]() {
+    for (unsigned int v = 0; v < n; ++v) {
+      queue_b.push_back(items[v]);
+    }
+  });
+  dldlist<uint32_t> batch;
+  unsigned int received(0);
+  unsigned int wakeups(0);
+  while (received < n) {
+    struct epoll_event ready;
+    if (epoll_wait(ep, &ready, 1, 1000) != 1) {
+      continue;
+    }
+    assert(ready.data.ptr == &queue_b);
+    ++wakeups;
+    queue_b.drain(batch);
+    while (evqueue<dldlist<uint32_t>>::item* i = batch.pop_front()) {
+      assert(**i == received);
+      ++received;
+    }
+  }
+  producer.join();
+  close(ep);
+  assert(wakeups < n);
+  assert(queue_b.empty() == true);
+
+  return;
+}
+
+coroutine waitlist_waiter(waitlist& list, waitlist::awaiter*& self, std::vector<int>& log, const int id)
+{
+  waitlist::awaiter w(list.wait());
+  self = &w;
+  const bool notified(co_await w);
+  log.push_back(notified ? id : -id);
+}
+
+void waitlist_test()
+{
+  waitlist list_a;
+  std::vector<int> log;
+  waitlist::awaiter* w[4];
+
+  assert(list_a.empty() == true);
+  assert(list_a.size() == 0);
+  assert(list_a.ready() == 0);
+  assert(list_a.notify_one() == false);
+  assert(list_a.notify_all() == 0);
+  assert(list_a.dispatch() == 0);
+
+  for (int c = 0; c < 4; ++c) {
+    waitlist_waiter(list_a, w[c], log, c + 1);
+  }
+  assert(list_a.empty() == false);
+  assert(list_a.size() == 4);
+  assert(log.empty() == true);
+
+  // notifications are deferred to the next dispatch
+  assert(list_a.notify_one() == true);
+  assert(list_a.size() == 3);
+  assert(list_a.ready() == 1);
+  assert(log.empty() == true);
+
+  // cancellation unlinks a waiting coroutine, but not a ready one
+  assert(list_a.cancel(*w[0]) == false);
+  assert(list_a.cancel(*w[2]) == true);
+  assert(w[2]->cancelled() == true);
+  assert(list_a.cancel(*w[2]) == false);
+  assert(list_a.size() == 2);
+  assert(list_a.ready() == 2);
+
+  assert(list_a.dispatch() == 2);
+  assert(log.size() == 2);
+  assert(log[0] == 1);
+  assert(log[1] == -3);
+
+  assert(list_a.notify_all() == 2);
+  assert(list_a.empty() == true);
+  assert(list_a.dispatch() == 2);
+  assert(log.size() == 4);
+  assert(log[2] == 2);
+  assert(log[3] == 4);
+  assert(list_a.ready() == 0);
+
+  return;
+}
+
+coroutine asyncqueue_consumer(asyncqueue<uint32_t>& queue, asyncqueue<uint32_t>::awaiter*& self, std::vector<uint32_t>& log)
+{
+  while (true) {
+    asyncqueue<uint32_t>::awaiter w(queue.pop());
+    self = &w;
+    asyncqueue<uint32_t>::item* i(co_await w);
+    if (i == nullptr) {
+      break;
+    }
+    log.push_back(**i);
+  }
+}
+
+void asyncqueue_test()
+{
+  uint32_t data_a = 1;
+  uint32_t data_b = 2;
+  uint32_t data_c = 3;
+
+  asyncqueue<uint32_t>::item item_a(data_a);
+  asyncqueue<uint32_t>::item item_b(data_b);
+  asyncqueue<uint32_t>::item item_c(data_c);
+
+  asyncqueue<uint32_t> queue_a;
+  std::vector<uint32_t> log_a;
+  std::vector<uint32_t> log_b;
+  asyncqueue<uint32_t>::awaiter* w_a(nullptr);
+  asyncqueue<uint32_t>::awaiter* w_b(nullptr);
+
+  assert(queue_a.empty() == true);
+  assert(queue_a.size() == 0);
+  assert(queue_a.waiting() == 0);
+
+  // queued items are popped without suspending
+  queue_a.push_back(item_a);
+  assert(queue_a.size() == 1);
+  asyncqueue_consumer(queue_a, w_a, log_a);
+  assert(queue_a.empty() == true);
+  assert(log_a.size() == 1);
+  assert(log_a[0] == data_a);
+  assert(queue_a.waiting() == 1);
+
+  // pushed items are handed to the waiting consumers in FIFO order
+  asyncqueue_consumer(queue_a, w_b, log_b);
+  assert(queue_a.waiting() == 2);
+  queue_a.push_back(item_b);
+  queue_a.push_back(item_c);
+  assert(queue_a.empty() == true);
+  assert(queue_a.waiting() == 0);
+  assert(log_a.size() == 1);
+  assert(queue_a.dispatch() == 2);
+  assert(log_a.size() == 2);
+  assert(log_a[1] == data_b);
+  assert(log_b.size() == 1);
+  assert(log_b[0] == data_c);
+  assert(queue_a.waiting() == 2);
+
+  // cancelled consumers resume with a nullpointer
+  assert(queue_a.cancel(*w_a) == true);
+  assert(queue_a.cancel(*w_a) == false);
+  assert(queue_a.waiting() == 1);
+  assert(queue_a.cancel_all() == 1);
+  assert(queue_a.waiting() == 0);
+  assert(queue_a.dispatch() == 2);
+  assert(log_a.size() == 2);
+  assert(log_b.size() == 1);
+
+  return;
+}
+
+/**
+ * @brief   Task that counts its runs and optionally submits children from within the executor.
+ */
+class counter_task : public task
+{
+private:
+  executor& m_exec;
+  std::atomic<size_t>& m_count;
+  std::deque<counter_task>* m_children;
+  size_t m_first;
+  size_t m_n;
+
+public:
+  counter_task(executor& exec, std::atomic<size_t>& count, std::deque<counter_task>* children = nullptr, size_t first = 0, size_t n = 0) :
+    task(), m_exec(exec), m_count(count), m_children(children), m_first(first), m_n(n)
+  {}
+
+  void run()
+  {
+    for (size_t c = m_first; c < m_first + m_n; ++c) {
+      m_exec.submit((*m_children)[c]);
+    }
+    m_count.fetch_add(1, std::memory_order_release);
+  }
+};
+
+void executor_test()
+{
+  const size_t parents = 64;
+  const size_t children = 16;
+
+  std::atomic<size_t> count(0);
+  {
+    executor exec_a(4);
+    assert(exec_a.threads() == 4);
+
+    std::deque<counter_task> child_tasks;
+    for (size_t c = 0; c < parents * children; ++c) {
+      child_tasks.emplace_back(exec_a, count);
+    }
+    std::deque<counter_task> parent_tasks;
+    for (size_t p = 0; p < parents; ++p) {
+      parent_tasks.emplace_back(exec_a, count, &child_tasks, p * children, children);
+    }
+
+    // external submissions are injected, children are submitted locally by the workers
+    for (counter_task& t : parent_tasks) {
+      exec_a.submit(t);
+    }
+    while (count.load(std::memory_order_acquire) < parents * (children + 1)) {
+      std::this_thread::yield();
+    }
+    assert(count.load() == parents * (children + 1));
+
+    // tasks can be submitted again once they have run
+    for (counter_task& t : child_tasks) {
+      exec_a.submit(t);
+    }
+    while (count.load(std::memory_order_acquire) < parents * (2 * children + 1)) {
+      std::this_thread::yield();
+    }
+    assert(count.load() == parents * (2 * children + 1));
+  }
+
+  // the destructor runs all remaining tasks
+  count.store(0);
+  {
+    executor* exec_b(new executor(2));
+    std::deque<counter_task> tasks;
+    for (size_t t = 0; t < 256; ++t) {
+      tasks.emplace_back(*exec_b, count);
+    }
+    for (counter_task& t : tasks) {
+      exec_b->submit(t);
+    }
+    delete exec_b;
+    assert(count.load() == 256);
+  }
+
+  return;
+}
+
+void timerwheel_test()
+{
+  uint32_t data[8] = {0, 1, 2, 3, 4, 5, 6, 7};
+
+  std::deque<timerwheel<uint32_t>::timer> timers;
+  for (uint32_t& d : data) {
+    timers.emplace_back(d);
+  }
+
+  timerwheel<uint32_t> wheel_a(100);
+  dldlist<uint32_t> out_a;
+
+  assert(wheel_a.empty() == true);
+  assert(wheel_a.size() == 0);
+  assert(wheel_a.now() == 100);
+
+  // arm timers on all levels, beyond the range of the wheel and in the past
+  wheel_a.arm(timers[0], 105);
+  wheel_a.arm(timers[1], 100 + 300);
+  wheel_a.arm(timers[2], 100 + 70000);
+  wheel_a.arm(timers[3], 100 + 20000000);
+  wheel_a.arm(timers[4], uint64_t(1) << 40);
+  wheel_a.arm(timers[5], 50);
+  wheel_a.arm(timers[6], 105);
+  wheel_a.arm(timers[7], 1000);
+  assert(wheel_a.size() == 8);
+  assert(timers[3].attached() == true);
+  assert(timers[3].expiry() == 100 + 20000000);
+
+  // cancelled timers never expire
+  assert(wheel_a.cancel(timers[7]) == true);
+  assert(wheel_a.cancel(timers[7]) == false);
+  assert(timers[7].attached() == false);
+  assert(wheel_a.size() == 7);
+
+  // timers in the past are due right away
+  assert(wheel_a.advance(100, out_a) == 1);
+  assert(out_a.size() == 1);
+  assert(**out_a.pop_front() == data[5]);
+  assert(timers[5].attached() == false);
+
+  // timers expire exactly at their tick and in the order of arming
+  assert(wheel_a.advance(104, out_a) == 0);
+  assert(wheel_a.advance(105, out_a) == 2);
+  assert(**out_a.pop_front() == data[0]);
+  assert(**out_a.pop_front() == data[6]);
+  assert(out_a.empty() == true);
+
+  // cascaded timers expire exactly at their tick
+  assert(wheel_a.advance(100 + 299, out_a) == 0);
+  assert(wheel_a.advance(100 + 300, out_a) == 1);
+  assert(**out_a.pop_front() == data[1]);
+  assert(wheel_a.advance(100 + 69999, out_a) == 0);
+  assert(wheel_a.advance(100 + 70000, out_a) == 1);
+  assert(**out_a.pop_front() == data[2]);
+  assert(wheel_a.advance(100 + 19999999, out_a) == 0);
+  assert(wheel_a.advance(100 + 20000000, out_a) == 1);
+  assert(**out_a.pop_front() == data[3]);
+  assert(wheel_a.size() == 1);
+
+  // timers beyond the range of the wheel are cascaded until they expire
+  assert(wheel_a.advance((uint64_t(1) << 40) - 1, out_a) == 0);
+  assert(wheel_a.advance(uint64_t(1) << 40, out_a) == 1);
+  assert(**out_a.pop_front() == data[4]);
+  assert(wheel_a.empty() == true);
+  assert(wheel_a.now() == uint64_t(1) << 40);
+
+  // cancelled timers can be armed again and a single advance expires many ticks in order
+  const uint64_t now(wheel_a.now());
+  for (size_t t = 0; t < 8; ++t) {
+    wheel_a.arm(timers[t], now + 1000 - 100 * t);
+  }
+  assert(wheel_a.cancel(timers[3]) == true);
+  assert(wheel_a.advance(now + 1000, out_a) == 7);
+  uint32_t expected(7);
+  while (dldlist<uint32_t>::item* i = out_a.pop_front()) {
+    if (expected == 3) {
+      --expected;
+    }
+    assert(**i == expected);
+    --expected;
+  }
+  assert(wheel_a.empty() == true);
+
+  return;
+}
+
+void readyqueue_test()
+{
+  uint32_t data_a = 1;
+  uint32_t data_b = 2;
+  uint32_t data_c = 3;
+  uint32_t data_d = 4;
+
+  readyqueue<uint32_t, 200>::entry entry_a(data_a);
+  readyqueue<uint32_t, 200>::entry entry_b(data_b);
+  readyqueue<uint32_t, 200>::entry entry_c(data_c);
+  readyqueue<uint32_t, 200>::entry entry_d(data_d);
+
+  readyqueue<uint32_t, 200> queue_a;
+
+  assert(queue_a.empty() == true);
+  assert(queue_a.size() == 0);
+  assert(queue_a.next() == nullptr);
+  assert(queue_a.pop() == nullptr);
+
+  // the highest priority is selected across bitmap words
+  queue_a.insert(entry_a, 3);
+  queue_a.insert(entry_b, 130);
+  queue_a.insert(entry_c, 130);
+  queue_a.insert(entry_d, 70);
+  assert(queue_a.empty() == false);
+  assert(queue_a.size() == 4);
+  assert(queue_a.top() == 130);
+  assert(queue_a.next() == &entry_b);
+  assert(entry_b.queued() == true);
+  assert(entry_b.priority() == 130);
+
+  // entries of the same priority are served round-robin
+  queue_a.rotate();
+  assert(queue_a.next() == &entry_c);
+  queue_a.rotate(130);
+  assert(queue_a.next() == &entry_b);
+
+  // priority changes move entries between levels
+  queue_a.reprioritize(entry_a, 199);
+  assert(queue_a.top() == 199);
+  assert(queue_a.next() == &entry_a);
+  assert(entry_a.priority() == 199);
+  queue_a.reprioritize(entry_a, 0);
+  assert(queue_a.top() == 130);
+
+  // removal clears the bitmap once a priority is empty
+  assert(queue_a.remove(entry_b) == true);
+  assert(queue_a.remove(entry_b) == false);
+  assert(entry_b.queued() == false);
+  assert(queue_a.size() == 3);
+  assert(queue_a.pop() == &entry_c);
+  assert(queue_a.top() == 70);
+  assert(queue_a.pop() == &entry_d);
+  assert(queue_a.top() == 0);
+  assert(queue_a.pop() == &entry_a);
+  assert(entry_a.queued() == false);
+  assert(queue_a.empty() == true);
+  assert(queue_a.size() == 0);
+
+  // unqueued entries only update their priority
+  queue_a.reprioritize(entry_a, 42);
+  assert(entry_a.priority() == 42);
+  assert(queue_a.empty() == true);
+
+  return;
+}
+
+void calendarqueue_test()
+{
+  uint32_t data_a = 5;
+  uint32_t data_b = 1000;
+  uint32_t data_c = 5;
+  uint32_t data_d = 2;
+
+  calendarqueue<uint32_t>::item item_a(data_a);
+  calendarqueue<uint32_t>::item item_b(data_b);
+  calendarqueue<uint32_t>::item item_c(data_c);
+  calendarqueue<uint32_t>::item item_d(data_d);
+
+  calendarqueue<uint32_t> queue_a;
+
+  assert(queue_a.empty() == true);
+  assert(queue_a.size() == 0);
+  assert(queue_a.buckets() == calendarqueue<uint32_t>::MIN_BUCKETS);
+  assert(queue_a.removeMin() == nullptr);
+  assert(queue_a.min().valid() == false);
+
+  // items far apart and items before the current position are found in order
+  queue_a.insert(item_a);
+  queue_a.insert(item_b);
+  queue_a.insert(item_c);
+  assert(queue_a.size() == 3);
+  assert(queue_a.contains(data_b) == true);
+  assert(queue_a.contains(data_d) == false);
+  assert(*queue_a.min() == 5);
+  assert(queue_a.removeMin() != nullptr);
+  queue_a.insert(item_d);
+  assert(*queue_a.min() == 2);
+  assert(queue_a.removeMin() == &item_d);
+  assert(queue_a.removeMin() != nullptr);
+  assert(queue_a.remove(data_b) == &item_b);
+  assert(queue_a.remove(data_b) == nullptr);
+  assert(queue_a.empty() == true);
+
+  // the calendar grows and shrinks with the number of items and keeps them in order
+  const size_t n = 1000;
+  std::deque<uint32_t> values;
+  for (size_t v = 0; v < n; ++v) {
+    values.push_back(static_cast<uint32_t>((v * 7919) % 3001));
+  }
+  std::deque<calendarqueue<uint32_t>::item> items;
+  for (uint32_t& v : values) {
+    items.emplace_back(v);
+  }
+  for (calendarqueue<uint32_t>::item& i : items) {
+    queue_a.insert(i);
+  }
+  assert(queue_a.size() == n);
+  assert(queue_a.buckets() >= n / 2);
+  assert(queue_a.width() > 1);
+
+  // hold model: remove the minimum and insert it again with a later key
+  uint32_t last(0);
+  for (size_t h = 0; h < 4 * n; ++h) {
+    calendarqueue<uint32_t>::item* i(queue_a.removeMin());
+    assert(**i >= last);
+    last = **i;
+    **i += static_cast<uint32_t>((h * 104729) % 2000);
+    queue_a.insert(*i);
+  }
+  assert(queue_a.size() == n);
+
+  while (calendarqueue<uint32_t>::item* i = queue_a.removeMin()) {
+    assert(**i >= last);
+    last = **i;
+  }
+  assert(queue_a.empty() == true);
+  assert(queue_a.buckets() == calendarqueue<uint32_t>::MIN_BUCKETS);
+
+  return;
+}
+
+void pheap_test()
+{
+  uint32_t data_a = 1;
+  uint32_t data_b = 2;
+  uint32_t data_c = 3;
+  uint32_t data_d = 4;
+
+  pheap<uint32_t>::item item_a(data_a);
+  pheap<uint32_t>::item item_b(data_b);
+  pheap<uint32_t>::item item_c(data_c);
+  pheap<uint32_t>::item item_d(data_d);
+
+  pheap<uint32_t> heap_a;
+
+  assert(heap_a.empty() == true);
+  assert(heap_a.size() == 0);
+  assert(heap_a.min().valid() == false);
+  assert(heap_a.removeMin() == nullptr);
+  assert(heap_a.contains(data_a) == false);
+
+  heap_a.insert(item_c);
+  heap_a.insert(item_a);
+  heap_a.insert(item_d);
+  heap_a.insert(item_b);
+  assert(heap_a.empty() == false);
+  assert(heap_a.size() == 4);
+  assert(item_c.attached() == true);
+  assert(heap_a.min().get() == &item_a);
+  assert(*heap_a.min() == data_a);
+
+  // min() is used the same way as for the ordered dlists
+  slodlist<uint32_t>::item list_item_a(data_a);
+  slodlist<uint32_t>::item list_item_c(data_c);
+  slodlist<uint32_t> list_a;
+  assert(my_min(list_a) == nullptr);
+  list_a.insert(list_item_c);
+  list_a.insert(list_item_a);
+  assert(my_min(heap_a) == &data_a);
+  assert(my_min(list_a) == my_min(heap_a));
+  list_a.clear();
+  assert(heap_a.contains(data_d) == true);
+
+  // decreasing a key moves the item to the top
+  data_d = 0;
+  heap_a.decrease_key(item_d);
+  assert(heap_a.min().get() == &item_d);
+  assert(heap_a.removeMin() == &item_d);
+  assert(item_d.attached() == false);
+  assert(heap_a.contains(data_d) == false);
+  data_d = 4;
+
+  // arbitrary items are removed by handle or payload
+  assert(heap_a.removeMin() == &item_a);
+  heap_a.insert(item_a);
+  heap_a.insert(item_d);
+  assert(heap_a.remove(item_b) == &item_b);
+  assert(item_b.attached() == false);
+  assert(heap_a.remove(data_b) == nullptr);
+  assert(heap_a.remove(data_c) == &item_c);
+  assert(heap_a.size() == 2);
+  assert(heap_a.remove(item_a) == &item_a);
+  assert(heap_a.min().get() == &item_d);
+  assert(heap_a.clear() == 1);
+  assert(heap_a.empty() == true);
+  assert(my_min(heap_a) == nullptr);
+
+  // many items come out in order, also after removals and decreases inside the trees
+  const size_t n = 1000;
+  std::deque<uint32_t> values;
+  for (size_t v = 0; v < n; ++v) {
+    values.push_back(static_cast<uint32_t>(1000 + (v * 7919) % 10007));
+  }
+  std::deque<pheap<uint32_t>::item> items;
+  for (uint32_t& v : values) {
+    items.emplace_back(v);
+  }
+  for (pheap<uint32_t>::item& i : items) {
+    heap_a.insert(i);
+  }
+  assert(heap_a.removeMin() != nullptr);
+  for (size_t r = 1; r < n; r += 7) {
+    assert(heap_a.remove(values[r]) == &items[r]);
+  }
+  for (size_t d = 3; d < n; d += 11) {
+    if (items[d].attached()) {
+      values[d] -= 1000;
+      heap_a.decrease_key(items[d]);
+    }
+  }
+  uint32_t last(0);
+  size_t cnt(0);
+  while (pheap<uint32_t>::item* i = heap_a.removeMin()) {
+    assert(**i >= last);
+    last = **i;
+    ++cnt;
+  }
+  assert(cnt == n - 1 - (n - 1 + 6) / 7);
+  assert(heap_a.size() == 0);
+
+  return;
+}
+
+void lrucache_test()
+{
+  uint32_t data_a = 1;
+  uint32_t data_b = 2;
+  uint32_t data_c = 3;
+  uint32_t data_d = 4;
+
+  lrucache<uint32_t, uint32_t>::entry entry_a(data_a);
+  lrucache<uint32_t, uint32_t>::entry entry_b(data_b);
+  lrucache<uint32_t, uint32_t>::entry entry_c(data_c);
+  lrucache<uint32_t, uint32_t>::entry entry_d(data_d);
+
+  lrucache<uint32_t, uint32_t> cache_a(3);
+
+  assert(cache_a.empty() == true);
+  assert(cache_a.full() == false);
+  assert(cache_a.size() == 0);
+  assert(cache_a.capacity() == 3);
+  assert(cache_a.get(10) == nullptr);
+  assert(cache_a.misses() == 1);
+  assert(cache_a.evict() == nullptr);
+
+  assert(cache_a.put(entry_a, 10) == nullptr);
+  assert(entry_a.cached() == true);
+  assert(entry_a.key() == 10);
+  assert(cache_a.size() == 1);
+  assert(cache_a.get(10) == &entry_a);
+  assert(cache_a.hits() == 1);
+  assert(cache_a.put(entry_b, 20) == nullptr);
+  assert(cache_a.put(entry_c, 30) == nullptr);
+  assert(cache_a.full() == true);
+
+  // a hit protects the entry from eviction
+  assert(cache_a.get(10) == &entry_a);
+  assert(cache_a.put(entry_d, 40) == &entry_b);
+  assert(entry_b.cached() == false);
+  assert(cache_a.evictions() == 1);
+  assert(cache_a.get(20) == nullptr);
+  assert(cache_a.peek(30) == &entry_c);
+  assert(cache_a.size() == 3);
+
+  // peek does not change the recency
+  assert(cache_a.evict() == &entry_c);
+  assert(cache_a.erase(entry_c) == false);
+  assert(cache_a.erase(entry_a) == true);
+  assert(cache_a.peek(10) == nullptr);
+  assert(cache_a.size() == 1);
+  assert(cache_a.evict() == &entry_d);
+  assert(cache_a.empty() == true);
+  assert(cache_a.hits() == 2);
+  assert(cache_a.misses() == 2);
+  assert(cache_a.evictions() == 3);
+
+  // many keys collide in the buckets and are evicted in order of their last use
+  const size_t n = 1000;
+  std::deque<uint32_t> values;
+  for (size_t v = 0; v < 2 * n; ++v) {
+    values.push_back(static_cast<uint32_t>(v));
+  }
+  std::deque<lrucache<uint32_t, uint32_t>::entry> entries;
+  for (uint32_t& v : values) {
+    entries.emplace_back(v);
+  }
+  lrucache<uint32_t, uint32_t> cache_b(n);
+  for (size_t e = 0; e < n; ++e) {
+    assert(cache_b.put(entries[e], static_cast<uint32_t>(e * 1024)) == nullptr);
+  }
+  for (size_t e = 0; e < n; e += 2) {
+    assert(cache_b.get(static_cast<uint32_t>(e * 1024)) == &entries[e]);
+  }
+  for (size_t e = 0; e < n; ++e) {
+    const size_t expected((e < n / 2) ? (2 * e + 1) : (2 * (e - n / 2)));
+    assert(cache_b.put(entries[n + e], static_cast<uint32_t>((n + e) * 1024)) == &entries[expected]);
+  }
+  for (size_t e = n; e < 2 * n; ++e) {
+    assert(cache_b.peek(static_cast<uint32_t>(e * 1024)) == &entries[e]);
+  }
+  assert(cache_b.evictions() == n);
+
+  return;
+}
+
+void clockcache_test()
+{
+  uint32_t data_a = 1;
+  uint32_t data_b = 2;
+  uint32_t data_c = 3;
+  uint32_t data_d = 4;
+
+  clockcache<uint32_t, uint32_t>::entry entry_a(data_a);
+  clockcache<uint32_t, uint32_t>::entry entry_b(data_b);
+  clockcache<uint32_t, uint32_t>::entry entry_c(data_c);
+  clockcache<uint32_t, uint32_t>::entry entry_d(data_d);
+
+  clockcache<uint32_t, uint32_t> cache_a(3);
+
+  assert(cache_a.empty() == true);
+  assert(cache_a.full() == false);
+  assert(cache_a.capacity() == 3);
+  assert(cache_a.get(10) == nullptr);
+  assert(cache_a.misses() == 1);
+  assert(cache_a.evict() == nullptr);
+
+  assert(cache_a.put(entry_a, 10) == nullptr);
+  assert(cache_a.put(entry_b, 20) == nullptr);
+  assert(cache_a.put(entry_c, 30) == nullptr);
+  assert(cache_a.full() == true);
+  assert(entry_a.cached() == true);
+  assert(entry_a.key() == 10);
+  assert(entry_a.referenced() == false);
+
+  // a hit only sets the reference bit
+  assert(cache_a.get(10) == &entry_a);
+  assert(entry_a.referenced() == true);
+  assert(cache_a.hits() == 1);
+
+  // the hand clears the bit of a referenced entry and evicts the next cold one
+  assert(cache_a.put(entry_d, 40) == &entry_b);
+  assert(entry_a.referenced() == false);
+  assert(entry_b.cached() == false);
+  assert(cache_a.peek(20) == nullptr);
+  assert(cache_a.evictions() == 1);
+
+  // if all entries are referenced, the hand sweeps one revolution
+  assert(cache_a.get(10) == &entry_a);
+  assert(cache_a.get(30) == &entry_c);
+  assert(cache_a.get(40) == &entry_d);
+  assert(cache_a.evict() == &entry_c);
+  assert(entry_a.referenced() == false);
+  assert(entry_d.referenced() == false);
+
+  assert(cache_a.erase(entry_c) == false);
+  assert(cache_a.erase(entry_d) == true);
+  assert(cache_a.peek(40) == nullptr);
+  assert(cache_a.size() == 1);
+  assert(cache_a.evict() == &entry_a);
+  assert(cache_a.empty() == true);
+  assert(cache_a.hits() == 4);
+  assert(cache_a.evictions() == 3);
+
+  // entries that are hit between two sweeps survive
+  const size_t n = 1000;
+  std::deque<uint32_t> values;
+  for (size_t v = 0; v < 2 * n; ++v) {
+    values.push_back(static_cast<uint32_t>(v));
+  }
+  std::deque<clockcache<uint32_t, uint32_t>::entry> entries;
+  for (uint32_t& v : values) {
+    entries.emplace_back(v);
+  }
+  clockcache<uint32_t, uint32_t> cache_b(n);
+  for (size_t e = 0; e < n; ++e) {
+    assert(cache_b.put(entries[e], static_cast<uint32_t>(e)) == nullptr);
+  }
+  for (size_t e = 0; e < n; e += 2) {
+    assert(cache_b.get(static_cast<uint32_t>(e)) == &entries[e]);
+  }
+  for (size_t e = 0; e < n / 2; ++e) {
+    assert(cache_b.put(entries[n + e], static_cast<uint32_t>(n + e)) == &entries[2 * e + 1]);
+  }
+  for (size_t e = 0; e < n; e += 2) {
+    assert(cache_b.peek(static_cast<uint32_t>(e)) == &entries[e]);
+  }
+  assert(cache_b.size() == n);
+
+  return;
+}
+
+void bcdlist_test()
+{
+  uint32_t data_a = 1;
+  uint32_t data_b = 2;
+  uint32_t data_c = 3;
+  uint32_t data_d = 4;
+
+  slbcdlist<uint32_t>::item slitem_a(data_a);
+  slbcdlist<uint32_t>::item slitem_b(data_b);
+  slbcdlist<uint32_t>::item slitem_c(data_c);
+  slbcdlist<uint32_t>::item slitem_d(data_d);
+
+  slbcdlist<uint32_t> sllist_a(3);
+
+  assert(sllist_a.empty() == true);
+  assert(sllist_a.full() == false);
+  assert(sllist_a.size() == 0);
+  assert(sllist_a.capacity() == 3);
+  assert(sllist_a.remove_eldest() == nullptr);
+  assert(sllist_a.removeLatest() == nullptr);
+
+  assert(sllist_a.insert(slitem_a) == nullptr);
+  assert(sllist_a.insert(slitem_b) == nullptr);
+  assert(sllist_a.insert(slitem_c) == nullptr);
+  assert(sllist_a.full() == true);
+  assert(sllist_a.size() == 3);
+  assert(*sllist_a.eldest() == data_a);
+  assert(*sllist_a.latest() == data_c);
+
+  // a full list recycles its eldest item
+  assert(sllist_a.insert(slitem_d) == &slitem_a);
+  assert(sllist_a.size() == 3);
+  assert(sllist_a.contains(data_a) == false);
+  assert(*sllist_a.eldest() == data_b);
+  assert(sllist_a.insert(slitem_a) == &slitem_b);
+  assert(*sllist_a.latest() == data_a);
+
+  sllist_a.rotate();
+  assert(*sllist_a.latest() == data_c);
+  assert(sllist_a.remove(data_d) == &slitem_d);
+  assert(sllist_a.remove(data_d) == nullptr);
+  assert(sllist_a.size() == 2);
+  assert(sllist_a.removeLatest() == &slitem_c);
+  assert(sllist_a.remove_eldest() == &slitem_a);
+  assert(sllist_a.empty() == true);
+  sllist_a.insert(slitem_a);
+  sllist_a.insert(slitem_b);
+  assert(sllist_a.clear() == 2);
+  assert(sllist_a.size() == 0);
+
+  dlbcdlist<uint32_t>::item dlitem_a(data_a);
+  dlbcdlist<uint32_t>::item dlitem_b(data_b);
+  dlbcdlist<uint32_t>::item dlitem_c(data_c);
+
+  dlbcdlist<uint32_t> dllist_a(2);
+
+  assert(dllist_a.insert(dlitem_a) == nullptr);
+  assert(dllist_a.insert(dlitem_b) == nullptr);
+  assert(dllist_a.full() == true);
+  assert(dllist_a.insert(dlitem_c) == &dlitem_a);
+  assert(dllist_a.unlink(dlitem_b) == &dlitem_b);
+  assert(dllist_a.size() == 1);
+  assert(dllist_a.full() == false);
+  assert(dllist_a.insert(dlitem_a) == nullptr);
+  assert(*dllist_a.eldest() == data_c);
+  assert(dllist_a.unlink(dlitem_c) == &dlitem_c);
+  assert(dllist_a.unlink(dlitem_a) == &dlitem_a);
+  assert(dllist_a.empty() == true);
+
+  return;
+}
+
+void ttlcdlist_test()
+{
+  uint32_t data_a = 1;
+  uint32_t data_b = 2;
+  uint32_t data_c = 3;
+  uint32_t data_d = 4;
+
+  ttlcdlist<uint32_t>::entry entry_a(data_a);
+  ttlcdlist<uint32_t>::entry entry_b(data_b);
+  ttlcdlist<uint32_t>::entry entry_c(data_c);
+  ttlcdlist<uint32_t>::entry entry_d(data_d);
+
+  ttlcdlist<uint32_t> list_a(10);
+  dldlist<uint32_t> expired;
+
+  assert(list_a.empty() == true);
+  assert(list_a.size() == 0);
+  assert(list_a.ttl() == 10);
+  assert(list_a.next_expiry() == UINT64_MAX);
+  assert(list_a.expire(100, expired) == 0);
+
+  list_a.insert(entry_a, 0);
+  list_a.insert(entry_b, 2);
+  list_a.insert(entry_c, 4);
+  list_a.insert(entry_d, 6);
+  assert(list_a.size() == 4);
+  assert(entry_a.attached() == true);
+  assert(entry_b.stamp() == 2);
+  assert(*list_a.eldest() == data_a);
+  assert(*list_a.latest() == data_d);
+  assert(list_a.next_expiry() == 10);
+
+  // touching moves an entry to latest and renews it
+  list_a.touch(entry_a, 7);
+  assert(*list_a.latest() == data_a);
+  assert(*list_a.eldest() == data_b);
+  assert(list_a.next_expiry() == 12);
+  list_a.touch(entry_a, 8);
+  assert(*list_a.latest() == data_a);
+  assert(entry_a.stamp() == 8);
+
+  // the stale prefix expires in order and the rest stays
+  assert(list_a.expire(11, expired) == 0);
+  assert(list_a.expire(14, expired) == 2);
+  assert(list_a.size() == 2);
+  assert(expired.pop_front() == &entry_b);
+  assert(entry_c.attached() == true);
+  assert(expired.pop_front() == &entry_c);
+  assert(expired.empty() == true);
+  assert(entry_b.attached() == false);
+  assert(entry_c.attached() == false);
+  assert(*list_a.eldest() == data_d);
+
+  assert(list_a.remove(entry_b) == false);
+  assert(list_a.remove(entry_d) == true);
+  assert(list_a.size() == 1);
+  assert(list_a.expire(18, expired) == 1);
+  assert(expired.pop_front() == &entry_a);
+  assert(list_a.empty() == true);
+
+  // all entries expire as one range in the order of their timestamps
+  list_a.insert(entry_a, 20);
+  list_a.insert(entry_b, 21);
+  list_a.insert(entry_c, 22);
+  assert(list_a.expire(40, expired) == 3);
+  assert(list_a.empty() == true);
+  assert(list_a.size() == 0);
+  assert(expired.pop_front() == &entry_a);
+  assert(expired.pop_front() == &entry_b);
+  assert(expired.pop_front() == &entry_c);
+  assert(expired.empty() == true);
+
+  return;
+}
+
+static bool monodeque_greater(const uint32_t& a, const uint32_t& b)
+{
+  return a > b;
+}
+
+void monodeque_test()
+{
+  uint32_t data_a = 5;
+  uint32_t data_b = 3;
+  uint32_t data_c = 4;
+  uint32_t data_d = 1;
+
+  monodeque<uint32_t>::sample sample_a(data_a);
+  monodeque<uint32_t>::sample sample_b(data_b);
+  monodeque<uint32_t>::sample sample_c(data_c);
+  monodeque<uint32_t>::sample sample_d(data_d);
+
+  monodeque<uint32_t> min_a;
+
+  assert(min_a.empty() == true);
+  assert(min_a.size() == 0);
+  assert(min_a.extreme().valid() == false);
+  assert(min_a.expire(10) == 0);
+
+  // time bounded window
+  assert(min_a.push(sample_a, 10) == 0);
+  assert(*min_a.extreme() == data_a);
+  assert(sample_a.queued() == true);
+  assert(min_a.push(sample_b, 11) == 1);
+  assert(sample_a.queued() == false);
+  assert(*min_a.extreme() == data_b);
+  assert(min_a.push(sample_c, 12) == 0);
+  assert(min_a.size() == 2);
+  assert(sample_c.stamp() == 12);
+  assert(min_a.expire(11) == 0);
+  assert(*min_a.extreme() == data_b);
+  assert(min_a.expire(12) == 1);
+  assert(sample_b.queued() == false);
+  assert(*min_a.extreme() == data_c);
+  assert(min_a.push(sample_d, 20) == 1);
+  assert(*min_a.extreme() == data_d);
+  assert(min_a.pushed() == 4);
+  assert(min_a.clear() == 1);
+  assert(min_a.empty() == true);
+  assert(sample_d.queued() == false);
+
+  // count bounded window of the maximum
+  monodeque<uint32_t> max_a(monodeque_greater);
+  max_a.push(sample_a);
+  max_a.push(sample_b);
+  max_a.push(sample_c);
+  assert(*max_a.extreme() == data_a);
+  assert(max_a.retain(3) == 0);
+  assert(max_a.retain(2) == 1);
+  assert(*max_a.extreme() == data_c);
+  max_a.push(sample_d);
+  assert(max_a.retain(2) == 0);
+  assert(*max_a.extreme() == data_c);
+  assert(max_a.retain(1) == 1);
+  assert(*max_a.extreme() == data_d);
+  assert(max_a.clear() == 1);
+
+  // the extreme matches a rescan of the window for many samples
+  const size_t n = 2000;
+  const size_t window = 37;
+  std::deque<uint32_t> values;
+  for (size_t v = 0; v < n; ++v) {
+    values.push_back(static_cast<uint32_t>((v * 7919) % 1009));
+  }
+  std::deque<monodeque<uint32_t>::sample> samples;
+  for (uint32_t& v : values) {
+    samples.emplace_back(v);
+  }
+  monodeque<uint32_t> min_b;
+  for (size_t s = 0; s < n; ++s) {
+    min_b.push(samples[s]);
+    min_b.retain(window);
+    uint32_t min(values[s]);
+    for (size_t w = (s >= window) ? (s - window + 1) : 0; w < s; ++w) {
+      min = std::min(min, values[w]);
+    }
+    assert(*min_b.extreme() == min);
+    assert(min_b.size() <= window);
+  }
+
+  return;
+}
+
+void topk_test()
+{
+  uint32_t data_a = 1;
+  uint32_t data_b = 2;
+  uint32_t data_c = 3;
+  uint32_t data_d = 4;
+
+  sltopk<uint32_t>::item slitem_a(data_a);
+  sltopk<uint32_t>::item slitem_b(data_b);
+  sltopk<uint32_t>::item slitem_c(data_c);
+  sltopk<uint32_t>::item slitem_d(data_d);
+
+  sltopk<uint32_t> sltop_a(2);
+
+  assert(sltop_a.empty() == true);
+  assert(sltop_a.full() == false);
+  assert(sltop_a.capacity() == 2);
+  assert(sltop_a.removeMin() == nullptr);
+
+  assert(sltop_a.offer(slitem_b) == nullptr);
+  assert(sltop_a.offer(slitem_c) == nullptr);
+  assert(sltop_a.full() == true);
+  assert(sltop_a.size() == 2);
+  assert(*sltop_a.min() == data_b);
+  assert(*sltop_a.max() == data_c);
+
+  // small and equal candidates are rejected, greater ones replace the minimum
+  assert(sltop_a.offer(slitem_a) == &slitem_a);
+  assert(slitem_a.attached() == false);
+  assert(sltop_a.offer(slitem_d) == &slitem_b);
+  assert(sltop_a.size() == 2);
+  assert(*sltop_a.min() == data_c);
+  assert(*sltop_a.max() == data_d);
+  assert(sltop_a.contains(data_b) == false);
+  assert(sltop_a.remove(data_c) == &slitem_c);
+  assert(sltop_a.size() == 1);
+  assert(sltop_a.offer(slitem_a) == nullptr);
+  assert(sltop_a.removeMin() == &slitem_a);
+  assert(sltop_a.clear() == 1);
+  assert(sltop_a.empty() == true);
+
+  // the greatest items of many are kept
+  const size_t n = 1000;
+  const size_t k = 17;
+  std::deque<uint32_t> values;
+  for (size_t v = 0; v < n; ++v) {
+    values.push_back(static_cast<uint32_t>((v * 7919) % 1009));
+  }
+  std::deque<dltopk<uint32_t>::item> items;
+  for (uint32_t& v : values) {
+    items.emplace_back(v);
+  }
+  dltopk<uint32_t> dltop_a(k);
+  for (dltopk<uint32_t>::item& i : items) {
+    dltopk<uint32_t>::item* out(dltop_a.offer(i));
+    assert(out == nullptr || out->attached() == false);
+  }
+  std::vector<uint32_t> sorted(values.begin(), values.end());
+  std::sort(sorted.begin(), sorted.end());
+  assert(dltop_a.size() == k);
+  for (size_t r = n - k; r < n; ++r) {
+    assert(**dltop_a.removeMin() == sorted[r]);
+  }
+
+  return;
+}
+
+void basic_dlist_test()
+{
+  uint32_t data_a = 1;
+  uint32_t data_b = 2;
+  uint32_t data_c = 3;
+
+  // the list classes are configurations of basic_dlist, and the default policies take no space
+  static_assert(std::is_same<basic_dlist<DOUBLY_LINKED, UNORDERED, LINEAR, uint32_t>, dldlist<uint32_t>>::value, "dldlist must be a basic_dlist");
+  static_assert(std::is_same<basic_dlist<SINGLY_LINKED, ORDERED, LINEAR, uint32_t, uncounted, unlocked>, slodlist<uint32_t>>::value, "slodlist must be a basic_dlist");
+  static_assert(sizeof(basic_dlist<SINGLY_LINKED, ORDERED, CIRCULAR, uint32_t>) == 2 * sizeof(void*), "ordered circular dlists must only hold their maximum and compare function");
+  static_assert(sizeof(basic_dlist<DOUBLY_LINKED, UNORDERED, LINEAR, uint32_t, counted>) == 3 * sizeof(void*), "counted dlists must only add the counter");
+
+  // doubly linked list with counted size
+  {
+    dldlist<uint32_t>::item item_a(data_a);
+    dldlist<uint32_t>::item item_b(data_b);
+    dldlist<uint32_t>::item item_c(data_c);
+    basic_dlist<DOUBLY_LINKED, UNORDERED, LINEAR, uint32_t, counted> list_a;
+    assert(list_a.empty() == true);
+    assert(list_a.size() == 0);
+    list_a.push_back(item_b);
+    list_a.push_front(item_a);
+    list_a.push_back(item_c);
+    assert(list_a.size() == 3);
+    assert(list_a.contains(data_b) == true);
+    assert(&*list_a.front() == &data_a);
+    assert(&*list_a.back() == &data_c);
+    assert(list_a.unlink(item_b) == &item_b);
+    assert(list_a.size() == 2);
+    assert(list_a.pop_back() == &item_c);
+    assert(list_a.pop_front() == &item_a);
+    assert(list_a.pop_front() == nullptr);
+    assert(list_a.empty() == true);
+    assert(list_a.size() == 0);
+  }
+
+  // ordered list with counted size and a spinlock
+  {
+    dlodlist<uint32_t>::item item_a(data_a);
+    dlodlist<uint32_t>::item item_b(data_b);
+    dlodlist<uint32_t>::item item_c(data_c);
+    basic_dlist<DOUBLY_LINKED, ORDERED, LINEAR, uint32_t, counted, spinlock> list_a(my_cmp);
+    list_a.insert(item_c);
+    list_a.insert(item_a);
+    list_a.insert(item_b);
+    assert(list_a.size() == 3);
+    assert(&*list_a.min() == &data_a);
+    assert(&*list_a.max() == &data_c);
+    assert(item_a.attached() == true);
+    basic_dlist<DOUBLY_LINKED, UNORDERED, CIRCULAR, uint32_t, counted> out;
+    assert(list_a.extract_before(2, out) == 1);
+    assert(list_a.size() == 2);
+    assert(list_a.remove_if(my_even, out) == 1);
+    assert(list_a.size() == 1);
+    assert(out.size() == 2);
+    assert(&*out.eldest() == &data_a);
+    assert(&*out.latest() == &data_b);
+    assert(list_a.removeMax() == &item_c);
+    assert(list_a.removeMin() == nullptr);
+    assert(list_a.size() == 0);
+    assert(my_drain(out) == 2);
+  }
+
+  // circular deque with counted size
+  {
+    slcdlist<uint32_t>::item item_a(data_a);
+    slcdlist<uint32_t>::item item_b(data_b);
+    slcdlist<uint32_t>::item item_c(data_c);
+    basic_dlist<SINGLY_LINKED, UNORDERED, CIRCULAR, uint32_t, counted> list_a;
+    list_a.push_back(item_b);
+    list_a.push_front(item_a);
+    list_a.push_back(item_c);
+    assert(list_a.size() == 3);
+    assert(&*list_a.front() == &data_a);
+    assert(&*list_a.back() == &data_c);
+    assert(&*list_a.latest() == &data_c);
+    assert(list_a.pop_back() == &item_c);
+    assert(&*list_a.latest() == &data_b);
+    sldlist<uint32_t> list_b;
+    list_b.push_back(item_c);
+    list_a.splice_back(list_b);
+    assert(list_b.empty() == true);
+    assert(list_a.size() == 3);
+    assert(&*list_a.back() == &data_c);
+    list_b.splice_back(list_a);
+    assert(list_a.size() == 0);
+    assert(list_b.size() == 3);
+    assert(&*list_b.front() == &data_a);
+    assert(&*list_b.back() == &data_c);
+    assert(my_drain(list_b) == 3);
+    list_a.insert(item_a);
+    list_a.insert(item_b);
+    list_a.insert(item_c);
+    list_a.rotate();
+    assert(&*list_a.latest() == &data_a);
+    assert(list_a.remove(data_b) == &item_b);
+    assert(list_a.remove(data_b) == nullptr);
+    assert(list_a.size() == 2);
+    assert(list_a.remove_eldest() == &item_c);
+    assert(list_a.removeLatest() == &item_a);
+    assert(item_a.attached() == false);
+    assert(list_a.size() == 0);
+    assert(list_a.empty() == true);
+  }
+
+  // ordered circular lists
+  {
+    slodlist<uint32_t>::item item_a(data_a);
+    slodlist<uint32_t>::item item_b(data_b);
+    slodlist<uint32_t>::item item_c(data_c);
+    basic_dlist<SINGLY_LINKED, ORDERED, CIRCULAR, uint32_t> list_a(my_cmp);
+    list_a.insert(item_b);
+    list_a.insert(item_c);
+    list_a.insert(item_a);
+    assert(list_a.size() == 3);
+    assert(&*list_a.min() == &data_a);
+    assert(&*list_a.max() == &data_c);
+    assert(&*list_a.find(2) == &data_b);
+    assert(list_a.find(4).valid() == false);
+    assert(&*list_a.upper_bound(2) == &data_c);
+    assert(list_a.upper_bound(3).valid() == false);
+    data_a = 4;
+    list_a.update_after(sliterator<uint32_t>());
+    assert(&*list_a.min() == &data_b);
+    assert(&*list_a.max() == &data_a);
+    data_a = 1;
+    list_a.sort();
+    assert(&*list_a.min() == &data_a);
+    assert(list_a.removeMax() == &item_c);
+    assert(list_a.removeMin() == &item_a);
+    assert(list_a.removeMin() == &item_b);
+    assert(list_a.removeMin() == nullptr);
+    assert(list_a.empty() == true);
+
+    dlodlist<uint32_t>::item item_d(data_a);
+    dlodlist<uint32_t>::item item_e(data_b);
+    dlodlist<uint32_t>::item item_f(data_c);
+    basic_dlist<DOUBLY_LINKED, ORDERED, CIRCULAR, uint32_t, counted> list_b;
+    list_b.insert(item_f);
+    list_b.insert(item_d);
+    list_b.insert(item_e);
+    assert(&*list_b.lower_bound(2) == &data_b);
+    data_c = 0;
+    list_b.update(item_f);
+    assert(&*list_b.min() == &data_c);
+    assert(&*list_b.max() == &data_b);
+    data_c = 3;
+    list_b.update(item_f);
+    assert(&*list_b.max() == &data_c);
+    assert(list_b.unlink(item_e) == &item_e);
+    assert(list_b.size() == 2);
+    assert(&*++list_b.min() == &data_c);
+    assert(my_drain(list_b) == 2);
+  }
+
   return;
 }
 
@@ -1345,5 +3812,89 @@ int main(int argc, char *argv[])
   dlcdlist_test();
   cout << "\tsuccess" << endl;
 
+  cout << "testing multiqueue..." << flush;
+  multiqueue_test();
+  cout << "\tsuccess" << endl;
+
+  cout << "testing rcudldlist..." << flush;
+  rcudldlist_test();
+  cout << "\tsuccess" << endl;
+
+  cout << "testing seqslcdlist..." << flush;
+  seqcdlist_test<seqslcdlist<uint32_t>>();
+  cout << "\tsuccess" << endl;
+
+  cout << "testing seqdlcdlist..." << flush;
+  seqcdlist_test<seqdlcdlist<uint32_t>>();
+  cout << "\tsuccess" << endl;
+
+  cout << "testing wsdeque..." << flush;
+  wsdeque_test();
+  cout << "\tsuccess" << endl;
+
+  cout << "testing blockqueue..." << flush;
+  blockqueue_test();
+  cout << "\tsuccess" << endl;
+
+  cout << "testing evqueue..." << flush;
+  evqueue_test();
+  cout << "\tsuccess" << endl;
+
+  cout << "testing waitlist..." << flush;
+  waitlist_test();
+  cout << "\tsuccess" << endl;
+
+  cout << "testing asyncqueue..." << flush;
+  asyncqueue_test();
+  cout << "\tsuccess" << endl;
+
+  cout << "testing executor..." << flush;
+  executor_test();
+  cout << "\tsuccess" << endl;
+
+  cout << "testing timerwheel..." << flush;
+  timerwheel_test();
+  cout << "\tsuccess" << endl;
+
+  cout << "testing readyqueue..." << flush;
+  readyqueue_test();
+  cout << "\tsuccess" << endl;
+
+  cout << "testing calendarqueue..." << flush;
+  calendarqueue_test();
+  cout << "\tsuccess" << endl;
+
+  cout << "testing pheap..." << flush;
+  pheap_test();
+  cout << "\tsuccess" << endl;
+
+  cout << "testing lrucache..." << flush;
+  lrucache_test();
+  cout << "\tsuccess" << endl;
+
+  cout << "testing clockcache..." << flush;
+  clockcache_test();
+  cout << "\tsuccess" << endl;
+
+  cout << "testing bcdlist..." << flush;
+  bcdlist_test();
+  cout << "\tsuccess" << endl;
+
+  cout << "testing ttlcdlist..." << flush;
+  ttlcdlist_test();
+  cout << "\tsuccess" << endl;
+
+  cout << "testing monodeque..." << flush;
+  monodeque_test();
+  cout << "\tsuccess" << endl;
+
+  cout << "testing topk..." << flush;
+  topk_test();
+  cout << "\tsuccess" << endl;
+
+  cout << "testing basic_dlist..." << flush;
+  basic_dlist_test();
+  cout << "\tsuccess" << endl;
+
   return 0;
 }
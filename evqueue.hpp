@@ -0,0 +1,137 @@
+/*
+The distributed list (dlist) library provides very light-weight real-time
+capable list classes with can optionally be ordered or circular.
+Copyright (C) 2017..2017  Thomas Schöpping
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef _EVQUEUE_HPP_
+#define _EVQUEUE_HPP_
+
+#include <dlist.hpp>
+#include <spinlock.hpp>
+
+namespace dlist {
+
+////////////////////////////////////////////////////////////////////////////////
+// EVENT QUEUE                                                                //
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief   FIFO queue adaptor over a sldlist or dldlist with eventfd notification.
+ *
+ * @details The queue owns a non-blocking eventfd, which can be registered in an epoll or poll loop.
+ *          Producers only write to the eventfd when they append to an empty queue, so notifications are coalesced.
+ *          The consumer moves all queued items to its own list in constant time with drain() and processes them with pop_front().
+ *
+ * @note    push_back() is thread-safe.
+ *          drain() must only be called by a single consumer thread.
+ *          The eventfd is Linux specific.
+ *
+ * @tparam LIST   Type of the underlying list, either sldlist<T> or dldlist<T>.
+ */
+template<typename LIST>
+class evqueue
+{
+public:
+  /**
+   * @brief   Alias for the item type of the underlying list.
+   */
+  typedef typename LIST::item item;
+
+private:
+  /**
+   * @brief   Lock protecting the list.
+   */
+  spinlock m_lock;
+
+  /**
+   * @brief   The underlying list.
+   */
+  LIST m_list;
+
+  /**
+   * @brief   The eventfd file descriptor.
+   */
+  const int m_fd;
+
+  /**
+   * @brief   The copy constructor is prohibited and must not be implemented.
+   */
+  evqueue(const evqueue&);
+
+  /**
+   * @brief   The copy operator is prohibited and must not be implemented.
+   */
+  evqueue& operator=(const evqueue&);
+
+public:
+  /**
+   * @brief   Default constructor, creates the eventfd.
+   */
+  evqueue();
+
+  /**
+   * @brief   Destructor, closes the eventfd.
+   *
+   * @note    Items still contained in the evqueue are not detached.
+   */
+  ~evqueue();
+
+  /**
+   * @brief   Retrieves the eventfd file descriptor.
+   *
+   * @details The descriptor becomes readable when items are available and should be registered for EPOLLIN.
+   *
+   * @return  The file descriptor.
+   */
+  int fd() const;
+
+  /**
+   * @brief   Checks whether the evqueue is empty.
+   *
+   * @note    The result is only a snapshot if other threads modify the evqueue concurrently.
+   *
+   * @return  true, if the evqueue contains no items.
+   */
+  bool empty();
+
+  /**
+   * @brief   Appends an item at the back of the evqueue.
+   *
+   * @details The eventfd is only written if the evqueue was empty.
+   *
+   * @param[in] i   The item to append.
+   */
+  void push_back(item& i);
+
+  /**
+   * @brief   Moves all items to the back of the specified list.
+   *
+   * @details The eventfd is reset before the items are taken, so an item pushed afterwards always raises a new notification.
+   *          Hence a notification may be spurious and drain() then moves no items.
+   *
+   * @param[out] out  The list to append the items to.
+   *
+   * @return  true, if any items have been moved.
+   */
+  bool drain(LIST& out);
+};
+
+} /* namespace dlist */
+
+#include "evqueue.tpp"
+
+#endif /* _EVQUEUE_HPP_ */
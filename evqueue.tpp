@@ -0,0 +1,103 @@
+/*
+The distributed list (dlist) library provides very light-weight real-time
+capable list classes with can optionally be ordered or circular.
+Copyright (C) 2017..2017  Thomas Schöpping
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef _EVQUEUE_TPP_
+#define _EVQUEUE_TPP_
+
+#include <evqueue.hpp>
+
+#include <cassert>
+#include <cstdint>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+namespace dlist
+{
+
+////////////////////////////////////////////////////////////////////////////////
+// EVENT QUEUE                                                                //
+////////////////////////////////////////////////////////////////////////////////
+
+template<typename LIST>
+evqueue<LIST>::evqueue() :
+  m_lock(), m_list(), m_fd(eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC))
+{
+  assert(this->m_fd >= 0);
+}
+
+template<typename LIST>
+evqueue<LIST>::~evqueue()
+{
+  close(this->m_fd);
+}
+
+template<typename LIST>
+inline int evqueue<LIST>::fd() const
+{
+  return this->m_fd;
+}
+
+template<typename LIST>
+bool evqueue<LIST>::empty()
+{
+  this->m_lock.lock();
+  const bool e(this->m_list.empty());
+  this->m_lock.unlock();
+  return e;
+}
+
+template<typename LIST>
+void evqueue<LIST>::push_back(item& i)
+{
+  assert(!i.attached());
+
+  this->m_lock.lock();
+  const bool notify(this->m_list.empty());
+  this->m_list.push_back(i);
+  this->m_lock.unlock();
+
+  // only the transition from empty to non-empty raises a notification
+  if (notify) {
+    const uint64_t one(1);
+    const ssize_t ret(write(this->m_fd, &one, sizeof(one)));
+    assert(ret == sizeof(one));
+    static_cast<void>(ret);
+  }
+  return;
+}
+
+template<typename LIST>
+bool evqueue<LIST>::drain(LIST& out)
+{
+  // reset the eventfd first, it is non-blocking and might not be set
+  uint64_t cnt;
+  const ssize_t ret(read(this->m_fd, &cnt, sizeof(cnt)));
+  static_cast<void>(ret);
+
+  // take all items at once
+  this->m_lock.lock();
+  const bool any(!this->m_list.empty());
+  out.splice_back(this->m_list);
+  this->m_lock.unlock();
+  return any;
+}
+
+} /* namespace dlist */
+
+#endif /* _EVQUEUE_TPP_ */
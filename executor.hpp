@@ -0,0 +1,236 @@
+/*
+The distributed list (dlist) library provides very light-weight real-time
+capable list classes with can optionally be ordered or circular.
+Copyright (C) 2017..2017  Thomas Schöpping
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef _EXECUTOR_HPP_
+#define _EXECUTOR_HPP_
+
+#include <dlist.hpp>
+#include <futex.hpp>
+
+#include <atomic>
+#include <thread>
+
+namespace dlist {
+
+////////////////////////////////////////////////////////////////////////////////
+// TASK                                                                       //
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief   Base class of all tasks run by an executor.
+ *
+ * @details The task embeds the slitem that links it into the queues of the executor, so submitting a task never allocates.
+ *          A task may submit itself again from within run().
+ *
+ * @note    A task must not be submitted again before it has been started.
+ */
+class task
+{
+friend class executor;
+
+private:
+  /**
+   * @brief   Item to link the task into the queues of an executor.
+   */
+  slitem<task> m_item;
+
+  /**
+   * @brief   The copy constructor is prohibited and must not be implemented.
+   */
+  task(const task&);
+
+  /**
+   * @brief   The copy operator is prohibited and must not be implemented.
+   */
+  task& operator=(const task&);
+
+protected:
+  /**
+   * @brief   Default constructor.
+   */
+  task();
+
+public:
+  /**
+   * @brief   Destructor.
+   */
+  virtual ~task();
+
+  /**
+   * @brief   Executes the task.
+   */
+  virtual void run() = 0;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// EXECUTOR                                                                   //
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief   Thread pool running intrusive tasks without any allocation.
+ *
+ * @details Each worker runs the tasks of its own sldlist, which is only accessed by the worker itself.
+ *          Tasks submitted by a worker are appended to its own list without any atomic operation.
+ *          Tasks submitted by other threads are distributed round-robin over the injection queues of the workers.
+ *          An injection queue is a lock-free stack of tasks, which the worker takes as a whole and reverses into its list.
+ *          Idle workers park on a futex and submitters only wake a worker that is parked.
+ *
+ * @note    submit() is thread-safe.
+ */
+class executor
+{
+private:
+  /**
+   * @brief   Alias for the item type of tasks.
+   */
+  typedef slitem<task> item;
+
+  /**
+   * @brief   State of a single worker thread.
+   */
+  struct alignas(64) worker
+  {
+    /**
+     * @brief   Top of the injection stack, written by other threads.
+     */
+    std::atomic<item*> m_injected;
+
+    /**
+     * @brief   Flag whether the worker is about to park or parked.
+     */
+    std::atomic<bool> m_sleeping;
+
+    /**
+     * @brief   Futex the worker parks on.
+     */
+    futex m_futex;
+
+    /**
+     * @brief   Tasks of the worker, only accessed by the worker thread.
+     */
+    alignas(64) sldlist<task> m_tasks;
+
+    /**
+     * @brief   The worker thread.
+     */
+    std::thread m_thread;
+
+    /**
+     * @brief   Default constructor.
+     */
+    worker();
+  };
+
+  /**
+   * @brief   Array of workers.
+   */
+  worker* m_workers;
+
+  /**
+   * @brief   Number of workers.
+   */
+  const size_t m_count;
+
+  /**
+   * @brief   Round-robin counter to distribute external submissions.
+   */
+  alignas(64) std::atomic<size_t> m_next;
+
+  /**
+   * @brief   Flag whether the workers shall keep running.
+   */
+  std::atomic<bool> m_running;
+
+  /**
+   * @brief   The copy constructor is prohibited and must not be implemented.
+   */
+  executor(const executor&);
+
+  /**
+   * @brief   The copy operator is prohibited and must not be implemented.
+   */
+  executor& operator=(const executor&);
+
+  /**
+   * @brief   Retrieves the worker of the calling thread.
+   *
+   * @return  Reference to a pointer to the worker the calling thread runs, or a nullpointer.
+   */
+  static worker*& _current();
+
+  /**
+   * @brief   Pushes a task onto the injection stack of a worker and wakes the worker if it is parked.
+   *
+   * @param[in] w   The worker.
+   * @param[in] i   The item of the task.
+   */
+  void _inject(worker& w, item& i);
+
+  /**
+   * @brief   Moves all injected tasks of a worker to its list in submission order.
+   *
+   * @param[in] w   The worker.
+   *
+   * @return  true, if any tasks have been moved.
+   */
+  bool _drain(worker& w);
+
+  /**
+   * @brief   Main loop of a worker thread.
+   *
+   * @param[in] w   The worker.
+   */
+  void _run(worker& w);
+
+public:
+  /**
+   * @brief   Standard constructor, starts the worker threads.
+   *
+   * @param[in] threads   Number of worker threads.
+   */
+  executor(const size_t threads);
+
+  /**
+   * @brief   Destructor, runs all remaining tasks and joins the worker threads.
+   */
+  ~executor();
+
+  /**
+   * @brief   Retrieves the number of worker threads.
+   *
+   * @return  Number of worker threads.
+   */
+  size_t threads() const;
+
+  /**
+   * @brief   Submits a task for execution.
+   *
+   * @details If called by a worker, the task is appended to its own list.
+   *          Otherwise it is injected into the next worker in round-robin order.
+   *
+   * @param[in] t   The task to run.
+   */
+  void submit(task& t);
+};
+
+} /* namespace dlist */
+
+#include "executor.tpp"
+
+#endif /* _EXECUTOR_HPP_ */
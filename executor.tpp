@@ -0,0 +1,182 @@
+/*
+The distributed list (dlist) library provides very light-weight real-time
+capable list classes with can optionally be ordered or circular.
+Copyright (C) 2017..2017  Thomas Schöpping
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef _EXECUTOR_TPP_
+#define _EXECUTOR_TPP_
+
+#include <executor.hpp>
+
+#include <cassert>
+#include <new>
+
+namespace dlist
+{
+
+////////////////////////////////////////////////////////////////////////////////
+// TASK                                                                       //
+////////////////////////////////////////////////////////////////////////////////
+
+inline task::task() :
+  m_item(*this)
+{}
+
+inline task::~task()
+{}
+
+////////////////////////////////////////////////////////////////////////////////
+// EXECUTOR                                                                   //
+////////////////////////////////////////////////////////////////////////////////
+
+// WORKER //////////////////////////////////////////////////////////////////////
+
+inline executor::worker::worker() :
+  m_injected(nullptr), m_sleeping(false), m_futex(), m_tasks(), m_thread()
+{}
+
+// EXECUTOR ////////////////////////////////////////////////////////////////////
+
+inline executor::executor(const size_t threads) :
+  m_workers(nullptr), m_count((threads > 0) ? threads : 1), m_next(0), m_running(true)
+{
+  // allocate cache line aligned memory for all workers and construct them in place
+  this->m_workers = static_cast<worker*>(::operator new[](this->m_count * sizeof(worker), std::align_val_t(alignof(worker))));
+  for (size_t w = 0; w < this->m_count; ++w) {
+    new (&this->m_workers[w]) worker();
+  }
+
+  // start the threads once all workers exist, since tasks might submit to any of them
+  for (size_t w = 0; w < this->m_count; ++w) {
+    worker& wk(this->m_workers[w]);
+    wk.m_thread = std::thread([this, &wk]() {
+      this->_run(wk);
+    });
+  }
+}
+
+inline executor::~executor()
+{
+  // stop all workers and wake those that are parked
+  this->m_running.store(false, std::memory_order_seq_cst);
+  for (size_t w = 0; w < this->m_count; ++w) {
+    this->m_workers[w].m_futex.wake(1);
+  }
+  for (size_t w = 0; w < this->m_count; ++w) {
+    this->m_workers[w].m_thread.join();
+    this->m_workers[w].~worker();
+  }
+  ::operator delete[](this->m_workers, std::align_val_t(alignof(worker)));
+}
+
+inline executor::worker*& executor::_current()
+{
+  static thread_local worker* current(nullptr);
+  return current;
+}
+
+inline void executor::_inject(worker& w, item& i)
+{
+  // push the task onto the stack
+  item* top(w.m_injected.load(std::memory_order_relaxed));
+  do {
+    _links::next(i) = top;
+  } while (!w.m_injected.compare_exchange_weak(top, &i, std::memory_order_release, std::memory_order_relaxed));
+
+  // wake the worker only if it is parked, which pairs with the registration in _run()
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (w.m_sleeping.load(std::memory_order_relaxed)) {
+    w.m_futex.wake(1);
+  }
+  return;
+}
+
+inline bool executor::_drain(worker& w)
+{
+  // take the whole stack at once
+  item* i(w.m_injected.exchange(nullptr, std::memory_order_acquire));
+  if (i == nullptr) {
+    return false;
+  }
+
+  // the stack holds the latest task on top, so pushing each to the front restores the submission order
+  while (i != nullptr) {
+    item* next(static_cast<item*>(_links::next(*i)));
+    _links::next(*i) = nullptr;
+    w.m_tasks.push_front(*i);
+    i = next;
+  }
+  return true;
+}
+
+inline void executor::_run(worker& w)
+{
+  _current() = &w;
+  while (true) {
+    // run the own tasks first
+    item* i(w.m_tasks.pop_front());
+    if (i != nullptr) {
+      (**i).run();
+      continue;
+    }
+
+    // then take the injected tasks
+    if (this->_drain(w)) {
+      continue;
+    }
+
+    // register as sleeping and check again, so a submitter either sees the registration or the check sees the task
+    const uint32_t seq(w.m_futex.value());
+    w.m_sleeping.store(true, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    const bool running(this->m_running.load(std::memory_order_relaxed));
+    if (w.m_injected.load(std::memory_order_relaxed) == nullptr) {
+      // leave when stopped and no tasks are left
+      if (!running) {
+        w.m_sleeping.store(false, std::memory_order_relaxed);
+        break;
+      }
+      w.m_futex.wait(seq);
+    }
+    w.m_sleeping.store(false, std::memory_order_relaxed);
+  }
+  _current() = nullptr;
+  return;
+}
+
+inline size_t executor::threads() const
+{
+  return this->m_count;
+}
+
+inline void executor::submit(task& t)
+{
+  assert(!t.m_item.attached());
+
+  // a worker appends to its own list, other threads inject round-robin
+  worker* w(_current());
+  if (w != nullptr && w >= this->m_workers && w < this->m_workers + this->m_count) {
+    w->m_tasks.push_back(t.m_item);
+  } else {
+    this->_inject(this->m_workers[this->m_next.fetch_add(1, std::memory_order_relaxed) % this->m_count], t.m_item);
+  }
+  return;
+}
+
+} /* namespace dlist */
+
+#endif /* _EXECUTOR_TPP_ */
@@ -0,0 +1,106 @@
+/*
+The distributed list (dlist) library provides very light-weight real-time
+capable list classes with can optionally be ordered or circular.
+Copyright (C) 2017..2017  Thomas Schöpping
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef _FUTEX_HPP_
+#define _FUTEX_HPP_
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+namespace dlist {
+
+////////////////////////////////////////////////////////////////////////////////
+// FUTEX                                                                      //
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief   Event counter on top of a Linux futex word.
+ *
+ * @details Threads read the counter, check their wait condition, and park only if the counter still holds the read value.
+ *          A thread that changes the condition advances the counter before waking parked threads.
+ *          Hence a wakeup between the check and parking is never lost.
+ *
+ * @note    The futex is process private and requires Linux.
+ */
+class futex
+{
+private:
+  /**
+   * @brief   The futex word.
+   */
+  std::atomic<uint32_t> m_word;
+
+  /**
+   * @brief   The copy constructor is prohibited and must not be implemented.
+   */
+  futex(const futex&);
+
+  /**
+   * @brief   The copy operator is prohibited and must not be implemented.
+   */
+  futex& operator=(const futex&);
+
+public:
+  /**
+   * @brief   Default constructor.
+   */
+  futex();
+
+  /**
+   * @brief   Reads the current value of the counter.
+   *
+   * @return  The current value.
+   */
+  uint32_t value() const;
+
+  /**
+   * @brief   Parks the calling thread as long as the counter holds the expected value.
+   *
+   * @details The function may return spuriously, so the caller must check its condition again.
+   *
+   * @param[in] expected  The value read before checking the wait condition.
+   */
+  void wait(const uint32_t expected);
+
+  /**
+   * @brief   Parks the calling thread as long as the counter holds the expected value, but at most for the specified time.
+   *
+   * @details The function may return spuriously, so the caller must check its condition again.
+   *
+   * @param[in] expected  The value read before checking the wait condition.
+   * @param[in] timeout   Maximum time to park.
+   *
+   * @return  false, if the timeout expired.
+   */
+  bool wait_for(const uint32_t expected, const std::chrono::nanoseconds timeout);
+
+  /**
+   * @brief   Advances the counter and wakes parked threads.
+   *
+   * @param[in] count   Maximum number of threads to wake.
+   */
+  void wake(const int count = 1);
+};
+
+} /* namespace dlist */
+
+#include "futex.tpp"
+
+#endif /* _FUTEX_HPP_ */
@@ -0,0 +1,74 @@
+/*
+The distributed list (dlist) library provides very light-weight real-time
+capable list classes with can optionally be ordered or circular.
+Copyright (C) 2017..2017  Thomas Schöpping
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef _FUTEX_TPP_
+#define _FUTEX_TPP_
+
+#include <futex.hpp>
+
+#include <cerrno>
+#include <ctime>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace dlist
+{
+
+////////////////////////////////////////////////////////////////////////////////
+// FUTEX                                                                      //
+////////////////////////////////////////////////////////////////////////////////
+
+static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t), "futex word must be a plain 32 bit integer");
+
+inline futex::futex() :
+  m_word(0)
+{}
+
+inline uint32_t futex::value() const
+{
+  return this->m_word.load(std::memory_order_acquire);
+}
+
+inline void futex::wait(const uint32_t expected)
+{
+  syscall(SYS_futex, reinterpret_cast<uint32_t*>(&this->m_word), FUTEX_WAIT_PRIVATE, expected, nullptr, nullptr, 0);
+  return;
+}
+
+inline bool futex::wait_for(const uint32_t expected, const std::chrono::nanoseconds timeout)
+{
+  // the timeout of FUTEX_WAIT is relative
+  struct timespec ts;
+  ts.tv_sec = static_cast<time_t>(timeout.count() / 1000000000);
+  ts.tv_nsec = static_cast<long>(timeout.count() % 1000000000);
+  const long ret(syscall(SYS_futex, reinterpret_cast<uint32_t*>(&this->m_word), FUTEX_WAIT_PRIVATE, expected, &ts, nullptr, 0));
+  return !(ret == -1 && errno == ETIMEDOUT);
+}
+
+inline void futex::wake(const int count)
+{
+  this->m_word.fetch_add(1, std::memory_order_release);
+  syscall(SYS_futex, reinterpret_cast<uint32_t*>(&this->m_word), FUTEX_WAKE_PRIVATE, count, nullptr, nullptr, 0);
+  return;
+}
+
+} /* namespace dlist */
+
+#endif /* _FUTEX_TPP_ */
@@ -0,0 +1,269 @@
+/*
+The distributed list (dlist) library provides very light-weight real-time
+capable list classes with can optionally be ordered or circular.
+Copyright (C) 2017..2017  Thomas Schöpping
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef _HASHINDEX_HPP_
+#define _HASHINDEX_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+namespace dlist {
+
+////////////////////////////////////////////////////////////////////////////////
+// STATIC FUNCTIONS                                                           //
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief   Default hash function for caches.
+ *
+ * @tparam K  Key type.
+ *
+ * @param[in] k   The key to hash.
+ *
+ * @return    The hash value according to std::hash.
+ */
+template<typename K> static inline size_t _defaultHash(const K& k);
+
+////////////////////////////////////////////////////////////////////////////////
+// FORWARD DECLARATIONS                                                       //
+////////////////////////////////////////////////////////////////////////////////
+
+template<typename K> class _hashindex;
+
+////////////////////////////////////////////////////////////////////////////////
+// HASH ITEM                                                                  //
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief   Key and link of an intrusive entry in a _hashindex.
+ *
+ * @details Cache entries derive from this class in addition to the list item they are linked into.
+ *
+ * @tparam K  Type of the keys.
+ */
+template<typename K>
+class _hashitem
+{
+friend class _hashindex<K>;
+
+private:
+  /**
+   * @brief   The key of the entry.
+   */
+  K m_key;
+
+  /**
+   * @brief   Pointer to the next entry in the same bucket.
+   */
+  _hashitem* m_chain;
+
+protected:
+  /**
+   * @brief   The only constructor.
+   */
+  _hashitem();
+
+public:
+  /**
+   * @brief   Retrieves the key of the entry.
+   *
+   * @return  The key the entry has been indexed with.
+   */
+  const K& key() const;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// HASH INDEX                                                                 //
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief   Fixed capacity chained hash index with lookup statistics, shared by the caches.
+ *
+ * @details The bucket array holds at least as many buckets as entries and is allocated once on construction, so no operation allocates any memory afterwards.
+ *          Keys are spread over the buckets by fibonacci hashing.
+ *          The index does not link the entries into any list, which is the task of the deriving cache.
+ *
+ * @note    The _hashindex is not thread-safe.
+ *
+ * @tparam K  Type of the keys.
+ */
+template<typename K>
+class _hashindex
+{
+public:
+  /**
+   * @brief   Alias for hash function.
+   */
+  typedef size_t (hash_f)(const K&);
+
+private:
+  /**
+   * @brief   Array of hash buckets.
+   */
+  _hashitem<K>** m_buckets;
+
+  /**
+   * @brief   Binary logarithm of the number of buckets.
+   */
+  unsigned int m_bits;
+
+  /**
+   * @brief   Reference to a hash function.
+   */
+  const hash_f& m_hash;
+
+  /**
+   * @brief   The copy constructor is prohibited and must not be implemented.
+   */
+  _hashindex(const _hashindex&);
+
+  /**
+   * @brief   The copy operator is prohibited and must not be implemented.
+   */
+  _hashindex& operator=(const _hashindex&);
+
+  /**
+   * @brief   Retrieves the bucket of a key.
+   *
+   * @param[in] key   The key.
+   *
+   * @return  Reference to the head of the bucket.
+   */
+  _hashitem<K>*& _bucket(const K& key) const;
+
+protected:
+  /**
+   * @brief   Maximum number of entries.
+   */
+  const size_t m_capacity;
+
+  /**
+   * @brief   Number of indexed entries.
+   */
+  size_t m_count;
+
+  /**
+   * @brief   Number of successful lookups.
+   */
+  uint64_t m_hits;
+
+  /**
+   * @brief   Number of failed lookups.
+   */
+  uint64_t m_misses;
+
+  /**
+   * @brief   Number of evicted entries.
+   */
+  uint64_t m_evictions;
+
+  /**
+   * @brief   Standard constructor.
+   *
+   * @param[in] capacity  Maximum number of entries.
+   * @param[in] hash      Reference to a hash function.
+   */
+  _hashindex(const size_t capacity, hash_f& hash);
+
+  /**
+   * @brief   Destructor.
+   */
+  ~_hashindex();
+
+  /**
+   * @brief   Looks up an entry without changing the counters.
+   *
+   * @param[in] key   The key to look up.
+   *
+   * @return  Pointer to the entry, or a nullpointer if the key is not indexed.
+   */
+  _hashitem<K>* _find(const K& key) const;
+
+  /**
+   * @brief   Links an entry into the index.
+   *
+   * @param[in] e     The entry to index, which must not be indexed yet.
+   * @param[in] key   The key of the entry, which must not be indexed yet.
+   */
+  void _chain(_hashitem<K>& e, const K& key);
+
+  /**
+   * @brief   Unlinks an entry from the index.
+   *
+   * @param[in] e   The indexed entry.
+   */
+  void _unchain(_hashitem<K>& e);
+
+public:
+  /**
+   * @brief   Checks whether the cache is empty.
+   *
+   * @return  true, if no entry is cached.
+   */
+  bool empty() const;
+
+  /**
+   * @brief   Checks whether the cache is full.
+   *
+   * @return  true, if the next put() evicts an entry.
+   */
+  bool full() const;
+
+  /**
+   * @brief   Retrieves the number of cached entries in constant time.
+   *
+   * @return  Number of cached entries.
+   */
+  size_t size() const;
+
+  /**
+   * @brief   Retrieves the maximum number of entries.
+   *
+   * @return  The capacity of the cache.
+   */
+  size_t capacity() const;
+
+  /**
+   * @brief   Retrieves the number of successful lookups by get().
+   *
+   * @return  Number of hits.
+   */
+  uint64_t hits() const;
+
+  /**
+   * @brief   Retrieves the number of failed lookups by get().
+   *
+   * @return  Number of misses.
+   */
+  uint64_t misses() const;
+
+  /**
+   * @brief   Retrieves the number of entries evicted by put() or evict().
+   *
+   * @return  Number of evictions.
+   */
+  uint64_t evictions() const;
+};
+
+} /* namespace dlist */
+
+#include "hashindex.tpp"
+
+#endif /* _HASHINDEX_HPP_ */
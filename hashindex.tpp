@@ -0,0 +1,165 @@
+/*
+The distributed list (dlist) library provides very light-weight real-time
+capable list classes with can optionally be ordered or circular.
+Copyright (C) 2017..2017  Thomas Schöpping
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef _HASHINDEX_TPP_
+#define _HASHINDEX_TPP_
+
+#include <hashindex.hpp>
+
+#include <cassert>
+
+namespace dlist
+{
+
+////////////////////////////////////////////////////////////////////////////////
+// STATIC FUNCTIONS                                                           //
+////////////////////////////////////////////////////////////////////////////////
+
+template<typename K>
+static inline size_t _defaultHash(const K& k)
+{
+  return std::hash<K>()(k);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// HASH ITEM                                                                  //
+////////////////////////////////////////////////////////////////////////////////
+
+template<typename K>
+_hashitem<K>::_hashitem() :
+  m_key(), m_chain(nullptr)
+{}
+
+template<typename K>
+inline const K& _hashitem<K>::key() const
+{
+  return this->m_key;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// HASH INDEX                                                                 //
+////////////////////////////////////////////////////////////////////////////////
+
+template<typename K>
+_hashindex<K>::_hashindex(const size_t capacity, hash_f& hash) :
+  m_buckets(nullptr), m_bits(0), m_hash(hash), m_capacity(capacity), m_count(0), m_hits(0), m_misses(0), m_evictions(0)
+{
+  assert(capacity > 0);
+
+  // use at least as many buckets as entries, so the chains stay short
+  while ((size_t(1) << this->m_bits) < capacity) {
+    ++this->m_bits;
+  }
+  this->m_buckets = new _hashitem<K>*[size_t(1) << this->m_bits]();
+}
+
+template<typename K>
+_hashindex<K>::~_hashindex()
+{
+  delete[] this->m_buckets;
+}
+
+template<typename K>
+inline _hashitem<K>*& _hashindex<K>::_bucket(const K& key) const
+{
+  // spread the hash over all bits by fibonacci hashing
+  const uint64_t h(static_cast<uint64_t>(this->m_hash(key)) * UINT64_C(0x9E3779B97F4A7C15));
+  return this->m_buckets[(this->m_bits > 0) ? (h >> (64 - this->m_bits)) : 0];
+}
+
+template<typename K>
+inline _hashitem<K>* _hashindex<K>::_find(const K& key) const
+{
+  _hashitem<K>* e(this->_bucket(key));
+  while (e != nullptr && !(e->m_key == key)) {
+    e = e->m_chain;
+  }
+  return e;
+}
+
+template<typename K>
+inline void _hashindex<K>::_chain(_hashitem<K>& e, const K& key)
+{
+  e.m_key = key;
+  _hashitem<K>*& head(this->_bucket(key));
+  e.m_chain = head;
+  head = &e;
+  ++this->m_count;
+  return;
+}
+
+template<typename K>
+void _hashindex<K>::_unchain(_hashitem<K>& e)
+{
+  // unlink the entry from its bucket
+  _hashitem<K>** link(&this->_bucket(e.m_key));
+  while (*link != &e) {
+    link = &(*link)->m_chain;
+  }
+  *link = e.m_chain;
+  e.m_chain = nullptr;
+  --this->m_count;
+  return;
+}
+
+template<typename K>
+inline bool _hashindex<K>::empty() const
+{
+  return (this->m_count == 0);
+}
+
+template<typename K>
+inline bool _hashindex<K>::full() const
+{
+  return (this->m_count >= this->m_capacity);
+}
+
+template<typename K>
+inline size_t _hashindex<K>::size() const
+{
+  return this->m_count;
+}
+
+template<typename K>
+inline size_t _hashindex<K>::capacity() const
+{
+  return this->m_capacity;
+}
+
+template<typename K>
+inline uint64_t _hashindex<K>::hits() const
+{
+  return this->m_hits;
+}
+
+template<typename K>
+inline uint64_t _hashindex<K>::misses() const
+{
+  return this->m_misses;
+}
+
+template<typename K>
+inline uint64_t _hashindex<K>::evictions() const
+{
+  return this->m_evictions;
+}
+
+} /* namespace dlist */
+
+#endif /* _HASHINDEX_TPP_ */
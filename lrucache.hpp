@@ -0,0 +1,149 @@
+/*
+The distributed list (dlist) library provides very light-weight real-time
+capable list classes with can optionally be ordered or circular.
+Copyright (C) 2017..2017  Thomas Schöpping
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef _LRUCACHE_HPP_
+#define _LRUCACHE_HPP_
+
+#include <dlist.hpp>
+#include <hashindex.hpp>
+
+namespace dlist {
+
+////////////////////////////////////////////////////////////////////////////////
+// LRU CACHE                                                                  //
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief   Fixed capacity least recently used cache of intrusive entries.
+ *
+ * @details Each entry is a dlitem in a dldlist ordered from the most to the least recently used entry, and is linked into a _hashindex by its key.
+ *          Lookups take constant time on average, a hit moves the entry to the front by unlinking it, and eviction pops the back of the list.
+ *
+ * @note    The lrucache is not thread-safe.
+ *
+ * @tparam K  Type of the keys.
+ * @tparam T  Type of the data stored in the lrucache.
+ */
+template<typename K, typename T>
+class lrucache : public _hashindex<K>
+{
+public:
+  /**
+   * @brief   Doubly linked item with a key and a link in the hash index.
+   */
+  class entry : public dlitem<T>, public _hashitem<K>
+  {
+  public:
+    /**
+     * @brief   The only constructor with payload as argument.
+     *
+     * @param[in] d   The payload to set for the entry.
+     */
+    entry(T& d);
+
+    /**
+     * @brief   Checks whether the entry is cached.
+     *
+     * @return  true, if the entry is linked in a lrucache.
+     */
+    bool cached() const;
+  };
+
+  /**
+   * @brief   Alias for hash function.
+   */
+  typedef typename _hashindex<K>::hash_f hash_f;
+
+private:
+  /**
+   * @brief   Entries from the most to the least recently used one.
+   */
+  dldlist<T> m_list;
+
+  /**
+   * @brief   The copy constructor is prohibited and must not be implemented.
+   */
+  lrucache(const lrucache&);
+
+  /**
+   * @brief   The copy operator is prohibited and must not be implemented.
+   */
+  lrucache& operator=(const lrucache&);
+
+public:
+  /**
+   * @brief   Standard constructor.
+   *
+   * @param[in] capacity  Maximum number of entries.
+   * @param[in] hash      Reference to a hash function.
+   */
+  lrucache(const size_t capacity, hash_f& hash = _defaultHash);
+
+  /**
+   * @brief   Looks up an entry and marks it as the most recently used one.
+   *
+   * @param[in] key   The key to look up.
+   *
+   * @return  Pointer to the entry, or a nullpointer if the key is not cached.
+   */
+  entry* get(const K& key);
+
+  /**
+   * @brief   Looks up an entry without changing its recency or the counters.
+   *
+   * @param[in] key   The key to look up.
+   *
+   * @return  Pointer to the entry, or a nullpointer if the key is not cached.
+   */
+  entry* peek(const K& key) const;
+
+  /**
+   * @brief   Caches an entry as the most recently used one.
+   *
+   * @details If the lrucache is full, the least recently used entry is evicted first.
+   *
+   * @param[in] e     The entry to cache, which must not be cached yet.
+   * @param[in] key   The key of the entry, which must not be cached yet.
+   *
+   * @return  Pointer to the evicted entry, or a nullpointer if no entry has been evicted.
+   */
+  entry* put(entry& e, const K& key);
+
+  /**
+   * @brief   Evicts the least recently used entry.
+   *
+   * @return  Pointer to the evicted entry, or a nullpointer if the lrucache is empty.
+   */
+  entry* evict();
+
+  /**
+   * @brief   Removes a specific entry.
+   *
+   * @param[in] e   The entry to remove.
+   *
+   * @return  true, if the entry was cached and has been removed.
+   */
+  bool erase(entry& e);
+};
+
+} /* namespace dlist */
+
+#include "lrucache.tpp"
+
+#endif /* _LRUCACHE_HPP_ */
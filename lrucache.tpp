@@ -0,0 +1,124 @@
+/*
+The distributed list (dlist) library provides very light-weight real-time
+capable list classes with can optionally be ordered or circular.
+Copyright (C) 2017..2017  Thomas Schöpping
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef _LRUCACHE_TPP_
+#define _LRUCACHE_TPP_
+
+#include <lrucache.hpp>
+
+#include <cassert>
+
+namespace dlist
+{
+
+////////////////////////////////////////////////////////////////////////////////
+// LRU CACHE                                                                  //
+////////////////////////////////////////////////////////////////////////////////
+
+// ENTRY ///////////////////////////////////////////////////////////////////////
+
+template<typename K, typename T>
+lrucache<K, T>::entry::entry(T& d) :
+  dlitem<T>(d), _hashitem<K>()
+{}
+
+template<typename K, typename T>
+inline bool lrucache<K, T>::entry::cached() const
+{
+  return this->attached();
+}
+
+// LRUCACHE ////////////////////////////////////////////////////////////////////
+
+template<typename K, typename T>
+lrucache<K, T>::lrucache(const size_t capacity, hash_f& hash) :
+  _hashindex<K>(capacity, hash), m_list()
+{}
+
+template<typename K, typename T>
+typename lrucache<K, T>::entry* lrucache<K, T>::get(const K& key)
+{
+  entry* e(this->peek(key));
+  // if the key is not cached, count the miss
+  if (e == nullptr) {
+    ++this->m_misses;
+  }
+  // move the entry to the front
+  else {
+    ++this->m_hits;
+    this->m_list.unlink(*e);
+    this->m_list.push_front(*e);
+  }
+  return e;
+}
+
+template<typename K, typename T>
+typename lrucache<K, T>::entry* lrucache<K, T>::peek(const K& key) const
+{
+  return static_cast<entry*>(this->_find(key));
+}
+
+template<typename K, typename T>
+typename lrucache<K, T>::entry* lrucache<K, T>::put(entry& e, const K& key)
+{
+  assert(!e.attached());
+  assert(this->peek(key) == nullptr);
+
+  // make room for the new entry
+  entry* evicted((this->full()) ? this->evict() : nullptr);
+
+  this->_chain(e, key);
+  this->m_list.push_front(e);
+  return evicted;
+}
+
+template<typename K, typename T>
+typename lrucache<K, T>::entry* lrucache<K, T>::evict()
+{
+  // if the lrucache is empty, return immediately
+  if (this->empty()) {
+    return nullptr;
+  }
+  // remove the least recently used entry
+  else {
+    entry* e(static_cast<entry*>(this->m_list.pop_back()));
+    this->_unchain(*e);
+    ++this->m_evictions;
+    return e;
+  }
+}
+
+template<typename K, typename T>
+bool lrucache<K, T>::erase(entry& e)
+{
+  // if the entry is not cached, there is nothing to do
+  if (!e.attached()) {
+    return false;
+  }
+  // remove the entry
+  else {
+    this->m_list.unlink(e);
+    this->_unchain(e);
+    return true;
+  }
+}
+
+} /* namespace dlist */
+
+#endif /* _LRUCACHE_TPP_ */
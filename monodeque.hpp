@@ -0,0 +1,221 @@
+/*
+The distributed list (dlist) library provides very light-weight real-time
+capable list classes with can optionally be ordered or circular.
+Copyright (C) 2017..2017  Thomas Schöpping
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef _MONODEQUE_HPP_
+#define _MONODEQUE_HPP_
+
+#include <dlist.hpp>
+
+#include <cstdint>
+
+namespace dlist {
+
+////////////////////////////////////////////////////////////////////////////////
+// MONOTONIC DEQUE                                                            //
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief   Monotonic deque of stamped samples, which maintains the extreme of a sliding window.
+ *
+ * @details The samples are kept in a counted doubly linked dlist, which is ordered by the compare function from front to back and by the stamps from back to front.
+ *          A new sample is pushed to the back after all samples that cannot become the extreme anymore have been popped from the back.
+ *          Samples that left the window are popped from the front, which is always the extreme of the window.
+ *          Thus each sample is pushed and popped at most once, which takes amortized constant time per sample.
+ *          Windows are either bounded by time, using stamps provided by the caller, or by count, using the number of pushed samples as stamps.
+ *
+ * @note    The monodeque is not thread-safe.
+ *          Samples that have been popped are no longer referenced and can be reused as soon as queued() returns false.
+ *
+ * @tparam T  Type of the data stored in the monodeque.
+ */
+template<typename T>
+class monodeque
+{
+public:
+  /**
+   * @brief   Alias for doubly linked dlist item type with according payload type.
+   */
+  typedef typename dldlist<T>::item item;
+
+  /**
+   * @brief   Alias for doubly linked dlist iterator type with according payload type.
+   */
+  typedef typename dldlist<T>::iterator iterator;
+
+  /**
+   * @brief   Doubly linked item with a stamp.
+   */
+  class sample : public item
+  {
+  friend class monodeque;
+
+  private:
+    /**
+     * @brief   Time or sequence number of the sample.
+     */
+    uint64_t m_stamp;
+
+  public:
+    /**
+     * @brief   The only constructor with payload as argument.
+     *
+     * @param[in] d   The payload to set for the sample.
+     */
+    sample(T& d);
+
+    /**
+     * @brief   Retrieves the stamp of the sample.
+     *
+     * @return  Time or sequence number the sample has been pushed with.
+     */
+    uint64_t stamp() const;
+
+    /**
+     * @brief   Checks whether the sample is queued.
+     *
+     * @return  true, if the sample is a candidate for the extreme of the window.
+     */
+    bool queued() const;
+  };
+
+  /**
+   * @brief   Alias for compare function.
+   *
+   * @details The compare function takes two objects as arguments and returns a bool.
+   *          By definition, the function shall return true if the first argumend is considered smaller than the second argument.
+   *          The monodeque maintains the minimum with respect to the compare function, so a greater-than function yields the maximum.
+   */
+  typedef bool (cmp_f)(const T&, const T&);
+
+private:
+  /**
+   * @brief   Candidates for the extreme from the front to the back.
+   */
+  basic_dlist<DOUBLY_LINKED, UNORDERED, LINEAR, T, counted> m_list;
+
+  /**
+   * @brief   Number of pushed samples.
+   */
+  uint64_t m_pushed;
+
+  /**
+   * @brief   Reference to a compare function.
+   */
+  const cmp_f& m_cmp;
+
+  /**
+   * @brief   The copy constructor is prohibited and must not be implemented.
+   */
+  monodeque(const monodeque&);
+
+  /**
+   * @brief   The copy operator is prohibited and must not be implemented.
+   */
+  monodeque& operator=(const monodeque&);
+
+public:
+  /**
+   * @brief   Standard constructor.
+   *
+   * @param[in] cmp   Reference to a compare function.
+   */
+  monodeque(cmp_f& cmp = _defaultCmp);
+
+  /**
+   * @brief   Checks whether the monodeque is empty.
+   *
+   * @return  true, if no sample is queued.
+   */
+  bool empty() const;
+
+  /**
+   * @brief   Retrieves the number of queued samples in constant time.
+   *
+   * @details Only candidates for the extreme are queued, so this is at most the size of the window.
+   *
+   * @return  Number of queued samples.
+   */
+  size_t size() const;
+
+  /**
+   * @brief   Retrieves the number of samples pushed so far.
+   *
+   * @return  Number of pushed samples.
+   */
+  uint64_t pushed() const;
+
+  /**
+   * @brief   Retrieves the extreme of the window in constant time.
+   *
+   * @return  Iterator pointing to the minimum with respect to the compare function, or an invalid iterator if the monodeque is empty.
+   */
+  iterator extreme() const;
+
+  /**
+   * @brief   Pushes a sample with a time stamp.
+   *
+   * @param[in] s       The sample to push, which must not be queued.
+   * @param[in] stamp   The time of the sample, which must not be before the time of the previous sample.
+   *
+   * @return  The number of samples popped from the back.
+   */
+  size_t push(sample& s, const uint64_t stamp);
+
+  /**
+   * @brief   Pushes a sample stamped with its sequence number.
+   *
+   * @param[in] s   The sample to push, which must not be queued.
+   *
+   * @return  The number of samples popped from the back.
+   */
+  size_t push(sample& s);
+
+  /**
+   * @brief   Pops all samples stamped before the specified time from the front.
+   *
+   * @param[in] stamp   The beginning of a time bounded window.
+   *
+   * @return  The number of popped samples.
+   */
+  size_t expire(const uint64_t stamp);
+
+  /**
+   * @brief   Pops all samples but the latest ones from the front.
+   *
+   * @details This requires the samples to be stamped with their sequence numbers.
+   *
+   * @param[in] count   The size of a count bounded window.
+   *
+   * @return  The number of popped samples.
+   */
+  size_t retain(const size_t count);
+
+  /**
+   * @brief   Pops all samples.
+   *
+   * @return  The number of popped samples.
+   */
+  size_t clear();
+};
+
+} /* namespace dlist */
+
+#include "monodeque.tpp"
+
+#endif /* _MONODEQUE_HPP_ */
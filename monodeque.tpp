@@ -0,0 +1,134 @@
+/*
+The distributed list (dlist) library provides very light-weight real-time
+capable list classes with can optionally be ordered or circular.
+Copyright (C) 2017..2017  Thomas Schöpping
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef _MONODEQUE_TPP_
+#define _MONODEQUE_TPP_
+
+#include <monodeque.hpp>
+
+#include <cassert>
+
+namespace dlist
+{
+
+////////////////////////////////////////////////////////////////////////////////
+// MONOTONIC DEQUE                                                            //
+////////////////////////////////////////////////////////////////////////////////
+
+// SAMPLE //////////////////////////////////////////////////////////////////////
+
+template<typename T>
+monodeque<T>::sample::sample(T& d) :
+  item(d), m_stamp(0)
+{}
+
+template<typename T>
+inline uint64_t monodeque<T>::sample::stamp() const
+{
+  return this->m_stamp;
+}
+
+template<typename T>
+inline bool monodeque<T>::sample::queued() const
+{
+  return this->attached();
+}
+
+// MONODEQUE ///////////////////////////////////////////////////////////////////
+
+template<typename T>
+monodeque<T>::monodeque(cmp_f& cmp) :
+  m_list(), m_pushed(0), m_cmp(cmp)
+{}
+
+template<typename T>
+inline bool monodeque<T>::empty() const
+{
+  return this->m_list.empty();
+}
+
+template<typename T>
+inline size_t monodeque<T>::size() const
+{
+  return this->m_list.size();
+}
+
+template<typename T>
+inline uint64_t monodeque<T>::pushed() const
+{
+  return this->m_pushed;
+}
+
+template<typename T>
+inline typename monodeque<T>::iterator monodeque<T>::extreme() const
+{
+  return this->m_list.front();
+}
+
+template<typename T>
+size_t monodeque<T>::push(sample& s, const uint64_t stamp)
+{
+  assert(!s.attached());
+  assert(this->empty() || static_cast<sample*>(this->m_list.back().get())->m_stamp <= stamp);
+
+  size_t cnt(0);
+  // pop all samples that are not smaller than the new one, since they leave the window earlier
+  while (!this->empty() && !this->m_cmp(**this->m_list.back().get(), *s)) {
+    this->m_list.pop_back();
+    ++cnt;
+  }
+  s.m_stamp = stamp;
+  this->m_list.push_back(s);
+  ++this->m_pushed;
+  return cnt;
+}
+
+template<typename T>
+inline size_t monodeque<T>::push(sample& s)
+{
+  return this->push(s, this->m_pushed);
+}
+
+template<typename T>
+size_t monodeque<T>::expire(const uint64_t stamp)
+{
+  size_t cnt(0);
+  // pop samples from the front until one is within the window
+  while (!this->empty() && static_cast<sample*>(this->m_list.front().get())->m_stamp < stamp) {
+    this->m_list.pop_front();
+    ++cnt;
+  }
+  return cnt;
+}
+
+template<typename T>
+inline size_t monodeque<T>::retain(const size_t count)
+{
+  return (this->m_pushed > count) ? this->expire(this->m_pushed - count) : 0;
+}
+
+template<typename T>
+size_t monodeque<T>::clear()
+{
+  return this->m_list.clear();
+}
+
+} /* namespace dlist */
+
+#endif /* _MONODEQUE_TPP_ */
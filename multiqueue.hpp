@@ -0,0 +1,201 @@
+/*
+The distributed list (dlist) library provides very light-weight real-time
+capable list classes with can optionally be ordered or circular.
+Copyright (C) 2017..2017  Thomas Schöpping
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef _MULTIQUEUE_HPP_
+#define _MULTIQUEUE_HPP_
+
+#include <dlist.hpp>
+#include <spinlock.hpp>
+
+namespace dlist {
+
+////////////////////////////////////////////////////////////////////////////////
+// MULTIQUEUE                                                                 //
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief   Relaxed concurrent priority queue composed of sharded dlodlists.
+ *
+ * @details The multiqueue holds a number of independent dlodlist shards, each protected by a try-lock.
+ *          Items are inserted into a randomly chosen shard.
+ *          removeMin() locks two random shards and removes the smaller of their minimum items.
+ *          Hence the removed item is only approximately the global minimum, but the expected rank error is bounded by the number of shards and threads scale without contending on a single list.
+ *
+ * @note    All functions are thread-safe.
+ *
+ * @tparam T  Type of the data stored in the multiqueue.
+ */
+template<typename T>
+class multiqueue
+{
+public:
+  /**
+   * @brief   Alias for doubly linked dlist item type with according payload type.
+   */
+  typedef typename dlodlist<T>::item item;
+
+  /**
+   * @brief   Alias for compare function.
+   *
+   * @details The compare function takes two objects as arguments and returns a bool.
+   *          By definition, the function shall return true if the first argumend is considered smaller than the second argument.
+   */
+  typedef typename dlodlist<T>::cmp_f cmp_f;
+
+private:
+  /**
+   * @brief   A single shard of the multiqueue.
+   *
+   * @details Shards are aligned to cache lines so that threads working on different shards do not interfere.
+   */
+  struct alignas(64) shard
+  {
+    /**
+     * @brief   Lock protecting the list of the shard.
+     */
+    spinlock m_lock;
+
+    /**
+     * @brief   Ordered list of the shard.
+     */
+    dlodlist<T> m_list;
+
+    /**
+     * @brief   Constructor.
+     *
+     * @param[in] cmp   Reference to a compare function.
+     */
+    shard(cmp_f& cmp);
+  };
+
+  /**
+   * @brief   Array of shards.
+   */
+  shard* m_shards;
+
+  /**
+   * @brief   Number of shards.
+   */
+  const size_t m_count;
+
+  /**
+   * @brief   Reference to a compare function.
+   */
+  const cmp_f& m_cmp;
+
+  /**
+   * @brief   The copy constructor is prohibited and must not be implemented.
+   */
+  multiqueue(const multiqueue&);
+
+  /**
+   * @brief   The copy operator is prohibited and must not be implemented.
+   */
+  multiqueue& operator=(const multiqueue&);
+
+  /**
+   * @brief   Retrieves a pseudo random shard index.
+   *
+   * @details Each thread uses its own xorshift generator, so no shared state is modified.
+   *
+   * @return  Random number in the range [0, m_count).
+   */
+  size_t _random() const;
+
+  /**
+   * @brief   Removes the minimum item of the first non-empty shard.
+   *
+   * @details This is the fallback of removeMin() if two sampled shards were empty.
+   *          It locks all shards in turn and thus guarantees to find an item if there is any.
+   *
+   * @return  Pointer to the removed item, or a nullpointer if all shards were empty.
+   */
+  item* _sweep();
+
+public:
+  /**
+   * @brief   Standard constructor.
+   *
+   * @param[in] threads   Number of threads expected to access the multiqueue concurrently.
+   * @param[in] c         Number of shards per thread.
+   * @param[in] cmp       Reference to a compare function.
+   */
+  multiqueue(const size_t threads, const size_t c = 2, cmp_f& cmp = _defaultCmp);
+
+  /**
+   * @brief   Destructor.
+   *
+   * @note    Items still contained in the multiqueue are not detached.
+   */
+  ~multiqueue();
+
+  /**
+   * @brief   Retrieves the number of shards.
+   *
+   * @return  Number of shards.
+   */
+  size_t shards() const;
+
+  /**
+   * @brief   Checks whether the multiqueue is empty.
+   *
+   * @note    The result is only a snapshot if other threads modify the multiqueue concurrently.
+   *
+   * @return  true, if none of the shards contains any items.
+   */
+  bool empty();
+
+  /**
+   * @brief   Retrieves the size of the multiqueue.
+   *
+   * @note    The result is only a snapshot if other threads modify the multiqueue concurrently.
+   *
+   * @return  Number of items in all shards.
+   */
+  size_t size();
+
+  /**
+   * @brief   Removes all items from the multiqueue.
+   *
+   * @return  The number of removed items.
+   */
+  size_t clear();
+
+  /**
+   * @brief   Inserts the specified item in a random shard.
+   *
+   * @param[in] i   The item to be inserted.
+   */
+  void insert(item& i);
+
+  /**
+   * @brief   Removes an approximately minimal item from the multiqueue.
+   *
+   * @details The minimum items of two random shards are compared and the smaller one is removed.
+   *
+   * @return  Pointer to the removed item, or a nullpointer if the multiqueue was empty.
+   */
+  item* removeMin();
+};
+
+} /* namespace dlist */
+
+#include "multiqueue.tpp"
+
+#endif /* _MULTIQUEUE_HPP_ */
@@ -0,0 +1,198 @@
+/*
+The distributed list (dlist) library provides very light-weight real-time
+capable list classes with can optionally be ordered or circular.
+Copyright (C) 2017..2017  Thomas Schöpping
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef _MULTIQUEUE_TPP_
+#define _MULTIQUEUE_TPP_
+
+#include <multiqueue.hpp>
+
+#include <cassert>
+#include <cstdint>
+#include <new>
+
+namespace dlist
+{
+
+////////////////////////////////////////////////////////////////////////////////
+// MULTIQUEUE                                                                 //
+////////////////////////////////////////////////////////////////////////////////
+
+// SHARD ///////////////////////////////////////////////////////////////////////
+
+template<typename T>
+multiqueue<T>::shard::shard(cmp_f& cmp) :
+  m_lock(), m_list(cmp)
+{}
+
+// MULTIQUEUE //////////////////////////////////////////////////////////////////
+
+template<typename T>
+multiqueue<T>::multiqueue(const size_t threads, const size_t c, cmp_f& cmp) :
+  m_shards(nullptr), m_count((threads * c > 0) ? threads * c : 1), m_cmp(cmp)
+{
+  // allocate cache line aligned memory for all shards and construct them in place
+  this->m_shards = static_cast<shard*>(::operator new[](this->m_count * sizeof(shard), std::align_val_t(alignof(shard))));
+  for (size_t s = 0; s < this->m_count; ++s) {
+    new (&this->m_shards[s]) shard(cmp);
+  }
+}
+
+template<typename T>
+multiqueue<T>::~multiqueue()
+{
+  for (size_t s = 0; s < this->m_count; ++s) {
+    this->m_shards[s].~shard();
+  }
+  ::operator delete[](this->m_shards, std::align_val_t(alignof(shard)));
+}
+
+template<typename T>
+inline size_t multiqueue<T>::_random() const
+{
+  // xorshift64* generator with a per-thread state, seeded from the address of the state
+  static thread_local uint64_t state(0);
+  if (state == 0) {
+    state = reinterpret_cast<uintptr_t>(&state) | 1;
+  }
+  state ^= state >> 12;
+  state ^= state << 25;
+  state ^= state >> 27;
+  return static_cast<size_t>((state * UINT64_C(0x2545F4914F6CDD1D)) >> 32) % this->m_count;
+}
+
+template<typename T>
+typename multiqueue<T>::item* multiqueue<T>::_sweep()
+{
+  // lock all shards in turn and remove the minimum of the first non-empty one
+  for (size_t s = 0; s < this->m_count; ++s) {
+    shard& sh(this->m_shards[s]);
+    sh.m_lock.lock();
+    item* i(sh.m_list.removeMin());
+    sh.m_lock.unlock();
+    if (i != nullptr) {
+      return i;
+    }
+  }
+  return nullptr;
+}
+
+template<typename T>
+inline size_t multiqueue<T>::shards() const
+{
+  return this->m_count;
+}
+
+template<typename T>
+bool multiqueue<T>::empty()
+{
+  for (size_t s = 0; s < this->m_count; ++s) {
+    shard& sh(this->m_shards[s]);
+    sh.m_lock.lock();
+    const bool e(sh.m_list.empty());
+    sh.m_lock.unlock();
+    if (!e) {
+      return false;
+    }
+  }
+  return true;
+}
+
+template<typename T>
+size_t multiqueue<T>::size()
+{
+  size_t cnt(0);
+  for (size_t s = 0; s < this->m_count; ++s) {
+    shard& sh(this->m_shards[s]);
+    sh.m_lock.lock();
+    cnt += sh.m_list.size();
+    sh.m_lock.unlock();
+  }
+  return cnt;
+}
+
+template<typename T>
+size_t multiqueue<T>::clear()
+{
+  size_t cnt(0);
+  for (size_t s = 0; s < this->m_count; ++s) {
+    shard& sh(this->m_shards[s]);
+    sh.m_lock.lock();
+    cnt += sh.m_list.clear();
+    sh.m_lock.unlock();
+  }
+  return cnt;
+}
+
+template<typename T>
+void multiqueue<T>::insert(item& i)
+{
+  assert(!i.attached());
+
+  // pick random shards until one can be locked
+  while (true) {
+    shard& sh(this->m_shards[this->_random()]);
+    if (sh.m_lock.try_lock()) {
+      sh.m_list.insert(i);
+      sh.m_lock.unlock();
+      return;
+    }
+  }
+}
+
+template<typename T>
+typename multiqueue<T>::item* multiqueue<T>::removeMin()
+{
+  while (true) {
+    // pick two distinct random shards
+    shard* a(&this->m_shards[this->_random()]);
+    shard* b(&this->m_shards[this->_random()]);
+    if (a == b && this->m_count > 1) {
+      b = &this->m_shards[(static_cast<size_t>(b - this->m_shards) + 1) % this->m_count];
+    }
+
+    // try to lock both shards, retry with other shards on contention
+    if (!a->m_lock.try_lock()) {
+      continue;
+    }
+    if (b != a && !b->m_lock.try_lock()) {
+      a->m_lock.unlock();
+      continue;
+    }
+
+    // compare the minimums of both shards and remove the smaller one
+    shard* min(a->m_list.empty() ? nullptr : a);
+    if (!b->m_list.empty() && (min == nullptr || this->m_cmp(*b->m_list.min(), *a->m_list.min()))) {
+      min = b;
+    }
+    item* i((min != nullptr) ? min->m_list.removeMin() : nullptr);
+
+    // release the locks
+    if (b != a) {
+      b->m_lock.unlock();
+    }
+    a->m_lock.unlock();
+
+    // if both shards were empty, fall back to a sweep over all shards
+    return (i != nullptr) ? i : this->_sweep();
+  }
+}
+
+} /* namespace dlist */
+
+#endif /* _MULTIQUEUE_TPP_ */
@@ -0,0 +1,392 @@
+/*
+The distributed list (dlist) library provides very light-weight real-time
+capable list classes with can optionally be ordered or circular.
+Copyright (C) 2017..2017  Thomas Schöpping
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef _PHEAP_HPP_
+#define _PHEAP_HPP_
+
+#include <dlist.hpp>
+
+namespace dlist {
+
+////////////////////////////////////////////////////////////////////////////////
+// FORWARD DECLARATIONS                                                       //
+////////////////////////////////////////////////////////////////////////////////
+
+template<typename T> class pheap;
+
+////////////////////////////////////////////////////////////////////////////////
+// ITEMS                                                                      //
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief   Pairing heap item class.
+ *
+ * @details Each item links to its first child and its right sibling.
+ *          The back link points to the left sibling, or to the parent for a first child, or to the item itself for the root.
+ *
+ * @tparam T  Data type of content/payload.
+ */
+template<typename T>
+class phitem : public _item<T>
+{
+friend class pheap<T>;
+
+private:
+  /**
+   * @brief   Pointer to the first child.
+   */
+  phitem* m_child;
+
+  /**
+   * @brief   Pointer to the right sibling.
+   */
+  phitem* m_next;
+
+  /**
+   * @brief   Pointer to the left sibling, the parent, or the item itself.
+   */
+  phitem* m_prev;
+
+  /**
+   * @brief   The default constructor is prohibited and must not be implemented.
+   */
+  phitem();
+
+  /**
+   * @brief   The copy constructor is prohibited and must not be implemented.
+   */
+  phitem(const phitem&);
+
+  /**
+   * @brief   The copy operator is prohibited and must not be implemented.
+   */
+  phitem& operator=(const phitem&);
+
+public:
+  /**
+   * @brief   The only constructor with payload as argument.
+   *
+   * @param[in] d   The payload to set for the phitem.
+   */
+  phitem(T& d);
+
+  /**
+   * @brief   Checks whether the item is attached to a pheap.
+   *
+   * @return  true, if the item is attached to a pheap.
+   */
+  bool attached() const;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// ITERATORS                                                                  //
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief   Pairing heap iterator class.
+ *
+ * @details The iterator is a handle to a single item with the interface of the dlist iterators, so min() can be used the same way as for the ordered dlists.
+ *          Since the items of a pheap are not ordered beyond the minimum, the iterator provides no increment.
+ *
+ * @tparam T  Data type of content/payload.
+ */
+template<typename T>
+class phiterator
+{
+public:
+  /**
+   * @brief   Alias for pairing heap item type with according payload type.
+   */
+  typedef phitem<T> item;
+
+private:
+  /**
+   * @brief   Pointer to the associated phitem or a nullpointer.
+   */
+  item* m_item;
+
+public:
+  /**
+   * @brief   Default constructor.
+   */
+  phiterator();
+
+  /**
+   * @brief   Copy constructor.
+   *
+   * @param[in] it  Iterator to be copied.
+   */
+  phiterator(const phiterator& it);
+
+  /**
+   * @brief   Constructor associating the iterator to an item.
+   *
+   * @param[in] i   The phitem to associate or a nullpointer.
+   */
+  explicit phiterator(item* i);
+
+  /**
+   * @brief   Copy operator.
+   *
+   * @param[in] it  Iterator to be copied.
+   *
+   * @return  Reference to the resulting iterator.
+   */
+  phiterator& operator=(const phiterator& it);
+
+  /**
+   * @brief   Equality operator.
+   *
+   * @param[in] it  The phiterator to compare.
+   *
+   * @return    true, if the phiterators are equal.
+   */
+  bool operator==(const phiterator& it) const;
+
+  /**
+   * @brief   Unequality operator.
+   *
+   * @param[in] it  The phiterator to compare.
+   *
+   * @return    true, if the phiterators are not equal.
+   */
+  bool operator!=(const phiterator& it) const;
+
+  /**
+   * @brief   Indirection operator.
+   *
+   * @note    Function call will fail if no item is associated to the phiterator.
+   *
+   * @return  Reference to the payload of the associated phitem.
+   */
+  T& operator*();
+
+  /**
+   * @brief   Dereference iterator.
+   *
+   * @return  Pointer to the the payload of the associated phitem or a nullpointer of no item is associated.
+   */
+  T* operator->();
+
+  /**
+   * @brief   Checks whether the iterator is pointing to an item.
+   *
+   * @return  true, if an item is associated to the iterator.
+   */
+  bool valid() const;
+
+  /**
+   * @brief   Retrieves the associated item.
+   *
+   * @return  Pointer to the associated phitem or a nullpointer.
+   */
+  item* get() const;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// PAIRING HEAP                                                               //
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief   Intrusive pairing heap with the min-queue interface of the ordered dlists.
+ *
+ * @details insert() and decrease_key() meld a single tree with the root in constant time.
+ *          removeMin() and the removal of arbitrary items combine the children of the removed item in two passes, which takes amortized logarithmic time.
+ *          No operation allocates any memory.
+ *
+ * @tparam T  Type of the data stored in the pheap.
+ */
+template<typename T>
+class pheap
+{
+public:
+  /**
+   * @brief   Alias for pairing heap item type with according payload type.
+   */
+  typedef phitem<T> item;
+
+  /**
+   * @brief   Alias for pairing heap iterator type with according payload type.
+   */
+  typedef phiterator<T> iterator;
+
+  /**
+   * @brief   Alias for compare function.
+   *
+   * @details The compare function takes two objects as arguments and returns a bool.
+   *          By definition, the function shall return true if the first argumend is considered smaller than the second argument.
+   */
+  typedef bool (cmp_f)(const T&, const T&);
+
+private:
+  /**
+   * @brief   Pointer to the minimum item.
+   */
+  item* m_root;
+
+  /**
+   * @brief   Number of items in the pheap.
+   */
+  size_t m_count;
+
+  /**
+   * @brief   Reference to a compare function.
+   */
+  const cmp_f& m_cmp;
+
+  /**
+   * @brief   The copy constructor is prohibited and must not be implemented.
+   */
+  pheap(const pheap&);
+
+  /**
+   * @brief   The copy operator is prohibited and must not be implemented.
+   */
+  pheap& operator=(const pheap&);
+
+  /**
+   * @brief   Links the tree with the greater root as first child of the other one.
+   *
+   * @param[in] a   Root of the first tree.
+   * @param[in] b   Root of the second tree.
+   *
+   * @return  Root of the melded tree, whose back link is left unset.
+   */
+  item* _meld(item* a, item* b);
+
+  /**
+   * @brief   Melds a list of sibling trees in two passes.
+   *
+   * @param[in] first   The first sibling or a nullpointer.
+   *
+   * @return  Root of the resulting tree, or a nullpointer.
+   */
+  item* _combine(item* first);
+
+  /**
+   * @brief   Detaches the subtree of a non-root item from its parent and siblings.
+   *
+   * @param[in] i   The item to detach.
+   */
+  void _cut(item& i);
+
+  /**
+   * @brief   Melds a detached tree with the heap.
+   *
+   * @param[in] i   Root of the tree.
+   */
+  void _push(item* i);
+
+  /**
+   * @brief   Searches the item pointing to a payload object.
+   *
+   * @param[in] d   The payload object.
+   *
+   * @return  Pointer to the item, or a nullpointer if no item points to d.
+   */
+  item* _find(const T& d) const;
+
+public:
+  /**
+   * @brief   Standard constructor.
+   *
+   * @param[in] cmp   Reference to a compare function.
+   */
+  pheap(cmp_f& cmp = _defaultCmp);
+
+  /**
+   * @brief   Checks whether the pheap is empty.
+   *
+   * @return  true, if the pheap contains no items.
+   */
+  bool empty() const;
+
+  /**
+   * @brief   Retrieves the number of items in constant time.
+   *
+   * @return  Number of items in the pheap.
+   */
+  size_t size() const;
+
+  /**
+   * @brief   Checks whether the pheap contains the specified item.
+   *
+   * @return  true, if the specified item is part of the pheap.
+   */
+  bool contains(const T& d) const;
+
+  /**
+   * @brief   Removes all items from the pheap.
+   *
+   * @return  The number of removed items.
+   */
+  size_t clear();
+
+  /**
+   * @brief   Removes a specific object from the pheap.
+   *
+   * @param[in] rm  The payload object to remove.
+   *
+   * @return  Pointer to the removed item or a nullpointer if the pheap does not contain the specified object.
+   */
+  item* remove(const T &rm);
+
+  /**
+   * @brief   Removes a specific item from the pheap without searching it.
+   *
+   * @param[in] i   The item to remove, which must be part of the pheap.
+   *
+   * @return  Pointer to the removed item.
+   */
+  item* remove(item& i);
+
+  /**
+   * @brief   Retrieves the minimum item in constant time.
+   *
+   * @return  Iterator to the minimum item, which is invalid if the pheap is empty.
+   */
+  iterator min() const;
+
+  /**
+   * @brief   Inserts the specified item in the pheap in constant time.
+   *
+   * @param[in] i   The item to be insterted.
+   */
+  void insert(item& i);
+
+  /**
+   * @brief   Removes the minimum item from the pheap.
+   *
+   * @return  Pointer to the removed item, or a nullpointer if the pheap was empty.
+   */
+  item* removeMin();
+
+  /**
+   * @brief   Restores the heap order after the payload of an item has been decreased.
+   *
+   * @param[in] i   The item, which must be part of the pheap.
+   */
+  void decrease_key(item& i);
+};
+
+} /* namespace dlist */
+
+#include "pheap.tpp"
+
+#endif /* _PHEAP_HPP_ */
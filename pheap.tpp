@@ -0,0 +1,355 @@
+/*
+The distributed list (dlist) library provides very light-weight real-time
+capable list classes with can optionally be ordered or circular.
+Copyright (C) 2017..2017  Thomas Schöpping
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef _PHEAP_TPP_
+#define _PHEAP_TPP_
+
+#include <pheap.hpp>
+
+#include <cassert>
+
+namespace dlist
+{
+
+////////////////////////////////////////////////////////////////////////////////
+// ITEMS                                                                      //
+////////////////////////////////////////////////////////////////////////////////
+
+// PHITEM //////////////////////////////////////////////////////////////////////
+
+template<typename T>
+phitem<T>::phitem(T& d) :
+  _item<T>(d), m_child(nullptr), m_next(nullptr), m_prev(nullptr)
+{}
+
+template<typename T>
+inline bool phitem<T>::attached() const
+{
+  return (this->m_prev != nullptr);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// ITERATORS                                                                  //
+////////////////////////////////////////////////////////////////////////////////
+
+// PHITERATOR //////////////////////////////////////////////////////////////////
+
+template<typename T>
+phiterator<T>::phiterator() :
+  m_item(nullptr)
+{}
+
+template<typename T>
+phiterator<T>::phiterator(const phiterator& it) :
+  m_item(it.m_item)
+{}
+
+template<typename T>
+phiterator<T>::phiterator(item* i) :
+  m_item(i)
+{}
+
+template<typename T>
+inline phiterator<T>& phiterator<T>::operator=(const phiterator& it)
+{
+  this->m_item = it.m_item;
+  return *this;
+}
+
+template<typename T>
+inline bool phiterator<T>::operator==(const phiterator& it) const
+{
+  return (this->m_item == it.m_item);
+}
+
+template<typename T>
+inline bool phiterator<T>::operator!=(const phiterator& it) const
+{
+  return (this->m_item != it.m_item);
+}
+
+template<typename T>
+inline T& phiterator<T>::operator*()
+{
+  return **this->m_item;
+}
+
+template<typename T>
+inline T* phiterator<T>::operator->()
+{
+  return (this->m_item != nullptr) ? &(**this->m_item) : nullptr;
+}
+
+template<typename T>
+inline bool phiterator<T>::valid() const
+{
+  return (this->m_item != nullptr);
+}
+
+template<typename T>
+inline typename phiterator<T>::item* phiterator<T>::get() const
+{
+  return this->m_item;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// PAIRING HEAP                                                               //
+////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+pheap<T>::pheap(cmp_f& cmp) :
+  m_root(nullptr), m_count(0), m_cmp(cmp)
+{}
+
+template<typename T>
+inline typename pheap<T>::item* pheap<T>::_meld(item* a, item* b)
+{
+  // the greater root becomes the first child of the smaller one
+  if (this->m_cmp(**b, **a)) {
+    item* tmp(a);
+    a = b;
+    b = tmp;
+  }
+  b->m_next = a->m_child;
+  if (a->m_child != nullptr) {
+    a->m_child->m_prev = b;
+  }
+  b->m_prev = a;
+  a->m_child = b;
+  return a;
+}
+
+template<typename T>
+typename pheap<T>::item* pheap<T>::_combine(item* first)
+{
+  // if there are no trees, return immediately
+  if (first == nullptr) {
+    return nullptr;
+  }
+
+  // first pass: meld pairs from left to right and chain the results in reverse order
+  item* pairs(nullptr);
+  while (first != nullptr) {
+    item* a(first);
+    item* b(a->m_next);
+    if (b == nullptr) {
+      a->m_next = pairs;
+      pairs = a;
+      break;
+    }
+    first = b->m_next;
+    a->m_next = nullptr;
+    b->m_next = nullptr;
+    item* melded(this->_meld(a, b));
+    melded->m_next = pairs;
+    pairs = melded;
+  }
+
+  // second pass: meld the results from right to left
+  item* root(pairs);
+  pairs = pairs->m_next;
+  root->m_next = nullptr;
+  while (pairs != nullptr) {
+    item* next(pairs->m_next);
+    pairs->m_next = nullptr;
+    root = this->_meld(root, pairs);
+    pairs = next;
+  }
+  return root;
+}
+
+template<typename T>
+inline void pheap<T>::_cut(item& i)
+{
+  // a first child is referenced by its parent, any other item by its left sibling
+  if (i.m_prev->m_child == &i) {
+    i.m_prev->m_child = i.m_next;
+  } else {
+    i.m_prev->m_next = i.m_next;
+  }
+  if (i.m_next != nullptr) {
+    i.m_next->m_prev = i.m_prev;
+  }
+  i.m_next = nullptr;
+  i.m_prev = nullptr;
+  return;
+}
+
+template<typename T>
+inline void pheap<T>::_push(item* i)
+{
+  this->m_root = (this->m_root == nullptr) ? i : this->_meld(this->m_root, i);
+  this->m_root->m_prev = this->m_root;
+  return;
+}
+
+template<typename T>
+typename pheap<T>::item* pheap<T>::_find(const T& d) const
+{
+  // if the pheap is empty, return immediately
+  if (this->empty()) {
+    return nullptr;
+  }
+
+  // traverse the tree depth first without a stack
+  item* current(this->m_root);
+  while (true) {
+    // test for d
+    if (&(**current) == &d) {
+      return current;
+    }
+    // descend to the first child
+    else if (current->m_child != nullptr) {
+      current = current->m_child;
+    }
+    // otherwise continue with the next sibling of the item or of its closest ancestor
+    else {
+      while (current != this->m_root && current->m_next == nullptr) {
+        // walk back to the first sibling, whose back link points to the parent
+        while (current->m_prev->m_child != current) {
+          current = current->m_prev;
+        }
+        current = current->m_prev;
+      }
+      if (current == this->m_root) {
+        return nullptr;
+      }
+      current = current->m_next;
+    }
+  }
+}
+
+template<typename T>
+inline bool pheap<T>::empty() const
+{
+  return (this->m_root == nullptr);
+}
+
+template<typename T>
+inline size_t pheap<T>::size() const
+{
+  return this->m_count;
+}
+
+template<typename T>
+inline bool pheap<T>::contains(const T& d) const
+{
+  return (this->_find(d) != nullptr);
+}
+
+template<typename T>
+size_t pheap<T>::clear()
+{
+  size_t cnt(0);
+  // remove all elements
+  while (this->removeMin() != nullptr) {
+    ++cnt;
+  }
+  return cnt;
+}
+
+template<typename T>
+typename pheap<T>::item* pheap<T>::remove(const T& rm)
+{
+  item* i(this->_find(rm));
+  // if no item points to rm, return immediately
+  if (i == nullptr) {
+    return nullptr;
+  }
+  // remove the found item
+  else {
+    return this->remove(*i);
+  }
+}
+
+template<typename T>
+typename pheap<T>::item* pheap<T>::remove(item& i)
+{
+  assert(i.attached());
+
+  // the root is removed as minimum
+  if (&i == this->m_root) {
+    return this->removeMin();
+  }
+  // detach the subtree and meld the children of the item with the heap
+  else {
+    this->_cut(i);
+    item* children(this->_combine(i.m_child));
+    i.m_child = nullptr;
+    if (children != nullptr) {
+      this->_push(children);
+    }
+    --this->m_count;
+    return &i;
+  }
+}
+
+template<typename T>
+inline typename pheap<T>::iterator pheap<T>::min() const
+{
+  return iterator(this->m_root);
+}
+
+template<typename T>
+void pheap<T>::insert(item& i)
+{
+  assert(!i.attached());
+
+  this->_push(&i);
+  ++this->m_count;
+  return;
+}
+
+template<typename T>
+typename pheap<T>::item* pheap<T>::removeMin()
+{
+  // if the pheap is empty, return immediately
+  if (this->empty()) {
+    return nullptr;
+  }
+  // replace the root by the combination of its children
+  else {
+    item* i(this->m_root);
+    this->m_root = this->_combine(i->m_child);
+    if (this->m_root != nullptr) {
+      this->m_root->m_prev = this->m_root;
+    }
+    i->m_child = nullptr;
+    i->m_prev = nullptr;
+    --this->m_count;
+    return i;
+  }
+}
+
+template<typename T>
+void pheap<T>::decrease_key(item& i)
+{
+  assert(i.attached());
+
+  // the root stays the minimum, any other item is cut and melded with the root
+  if (&i != this->m_root) {
+    this->_cut(i);
+    this->_push(&i);
+  }
+  return;
+}
+
+} /* namespace dlist */
+
+#endif /* _PHEAP_TPP_ */
@@ -0,0 +1,516 @@
+/*
+The distributed list (dlist) library provides very light-weight real-time
+capable list classes with can optionally be ordered or circular.
+Copyright (C) 2017..2017  Thomas Schöpping
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef _RCUDLIST_HPP_
+#define _RCUDLIST_HPP_
+
+#include <dlist.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+
+namespace dlist {
+
+////////////////////////////////////////////////////////////////////////////////
+// FORWARD DECLARATIONS                                                       //
+////////////////////////////////////////////////////////////////////////////////
+
+class rcudomain;
+class rcureader;
+template<typename T> class rcudldlist;
+
+////////////////////////////////////////////////////////////////////////////////
+// RCU DOMAIN                                                                 //
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief   Epoch based read-copy-update domain.
+ *
+ * @details The domain holds a global epoch and one slot per reader thread.
+ *          Readers publish the epoch they entered their read-side critical section in their own slot.
+ *          A writer waits for a grace period by advancing the epoch and waiting until no slot holds an older epoch.
+ *          Each slot occupies its own cache line, so readers never write to memory shared with other threads.
+ */
+class rcudomain
+{
+friend class rcureader;
+
+private:
+  /**
+   * @brief   Per-reader slot.
+   */
+  struct alignas(64) slot
+  {
+    /**
+     * @brief   Epoch of the current read-side critical section, or 0 if the reader is quiescent.
+     */
+    std::atomic<uint64_t> m_epoch;
+
+    /**
+     * @brief   Flag whether the slot is claimed by a reader.
+     */
+    std::atomic<bool> m_used;
+
+    /**
+     * @brief   Default constructor.
+     */
+    slot();
+  };
+
+  /**
+   * @brief   The global epoch.
+   */
+  alignas(64) std::atomic<uint64_t> m_epoch;
+
+  /**
+   * @brief   Array of reader slots.
+   */
+  slot* m_slots;
+
+  /**
+   * @brief   Number of reader slots.
+   */
+  const size_t m_count;
+
+  /**
+   * @brief   The copy constructor is prohibited and must not be implemented.
+   */
+  rcudomain(const rcudomain&);
+
+  /**
+   * @brief   The copy operator is prohibited and must not be implemented.
+   */
+  rcudomain& operator=(const rcudomain&);
+
+public:
+  /**
+   * @brief   Standard constructor.
+   *
+   * @param[in] readers   Maximum number of concurrently registered readers.
+   */
+  rcudomain(const size_t readers);
+
+  /**
+   * @brief   Destructor.
+   *
+   * @note    All readers must have been destroyed before.
+   */
+  ~rcudomain();
+
+  /**
+   * @brief   Retrieves the maximum number of concurrently registered readers.
+   *
+   * @return  Number of reader slots.
+   */
+  size_t readers() const;
+
+  /**
+   * @brief   Waits for a grace period.
+   *
+   * @details When the function returns, all read-side critical sections that were active when the function was called have been left.
+   *          Hence no reader can hold a reference to anything that had been unlinked before the call.
+   */
+  void synchronize();
+};
+
+/**
+ * @brief   Reader registration of a thread in an rcudomain.
+ *
+ * @details The reader claims a slot of the domain for its lifetime.
+ *          It satisfies the BasicLockable requirements, so std::lock_guard can be used to delimit read-side critical sections.
+ *
+ * @note    A reader must only be used by a single thread and read-side critical sections must not be nested.
+ */
+class rcureader
+{
+private:
+  /**
+   * @brief   Reference to the associated domain.
+   */
+  rcudomain& m_domain;
+
+  /**
+   * @brief   Pointer to the claimed slot.
+   */
+  rcudomain::slot* m_slot;
+
+  /**
+   * @brief   The copy constructor is prohibited and must not be implemented.
+   */
+  rcureader(const rcureader&);
+
+  /**
+   * @brief   The copy operator is prohibited and must not be implemented.
+   */
+  rcureader& operator=(const rcureader&);
+
+public:
+  /**
+   * @brief   Standard constructor.
+   *
+   * @note    The domain must provide a free slot.
+   *
+   * @param[in] domain  The domain to register in.
+   */
+  rcureader(rcudomain& domain);
+
+  /**
+   * @brief   Destructor, releases the slot.
+   */
+  ~rcureader();
+
+  /**
+   * @brief   Enters a read-side critical section.
+   */
+  void lock();
+
+  /**
+   * @brief   Leaves a read-side critical section.
+   */
+  void unlock();
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// RCU ITERATOR                                                               //
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief   Read-side iterator of an rcudldlist.
+ *
+ * @details Links are read with acquire semantics, so the iterator never observes a partially initialized item.
+ *
+ * @note    The iterator must only be used within a read-side critical section.
+ *          It only supports forward iteration, since writers do not publish changes of the backward links.
+ *
+ * @tparam T  Data type of content/payload.
+ */
+template<typename T>
+class rcuiterator
+{
+friend class rcudldlist<T>;
+
+public:
+  /**
+   * @brief   Iterator category, since only forward iteration is supported.
+   */
+  typedef std::forward_iterator_tag iterator_category;
+
+  /**
+   * @brief   Type of the payload the iterator refers to.
+   */
+  typedef T value_type;
+
+  /**
+   * @brief   Type of the distance between two iterators.
+   */
+  typedef std::ptrdiff_t difference_type;
+
+  /**
+   * @brief   Pointer to the payload.
+   */
+  typedef T* pointer;
+
+  /**
+   * @brief   Reference to the payload.
+   */
+  typedef T& reference;
+
+  /**
+   * @brief   Alias for doubly linked dlist item type with according payload type.
+   */
+  typedef dlitem<T> item;
+
+private:
+  /**
+   * @brief   Pointer to the associated dlitem or a nullpointer.
+   */
+  item* m_item;
+
+  /**
+   * @brief   Constructor with an item to associate.
+   *
+   * @param[in] i   Pointer to the item to associate or a nullpointer.
+   */
+  rcuiterator(item* i);
+
+public:
+  /**
+   * @brief   Default constructor.
+   */
+  rcuiterator();
+
+  /**
+   * @brief   Equality operator.
+   *
+   * @param[in] it  The rcuiterator to compare.
+   *
+   * @return    true, if the rcuiterators are equal.
+   */
+  bool operator==(const rcuiterator& it) const;
+
+  /**
+   * @brief   Unequality operator.
+   *
+   * @param[in] it  The rcuiterator to compare.
+   *
+   * @return    true, if the rcuiterators are not equal.
+   */
+  bool operator!=(const rcuiterator& it) const;
+
+  /**
+   * @brief   Increment operator.
+   * @details The pointer to the associated item m_item is altered to point to the next item in the rcudldlist.
+   *          If there is no next item in the list, m_item will become a nullpointer.
+   *          If m_item is a nullpointer, the iterator will remain unchainged.
+   *
+   * @return  Reference to the resulting iterator.
+   */
+  rcuiterator& operator++();
+
+  /**
+   * @brief   Indirection operator.
+   *
+   * @note    Function call will fail if no item is associated to the rcuiterator.
+   *
+   * @return  Refeerence to the payload of the associated dlitem.
+   */
+  T& operator*();
+
+  /**
+   * @brief   Dereference iterator.
+   *
+   * @return  Pointer to the the payload of the associated dlitem or a nullpointer of no item is associated.
+   */
+  T* operator->();
+
+  /**
+   * @brief   Checks whether the iterator is pointing to an item.
+   *
+   * @return  true, if an item is associated to the iterator.
+   */
+  bool valid() const;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// RCU DLIST                                                                  //
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief   Doubly linked dlist with RCU protected concurrent readers.
+ *
+ * @details Any number of readers can traverse the list concurrently to a writer without locks and without writing to shared memory.
+ *          The writer publishes all link changes with release stores.
+ *          Unlinked items keep their forward link, so readers currently visiting them can continue their traversal.
+ *          Such items remain attached until the next call of synchronize(), which waits for a grace period and detaches them.
+ *          Only then they may be reused or destroyed.
+ *
+ * @note    All modifying functions must be serialized by the caller (typically there is only one writer thread).
+ *          Readers must only use front(), empty(), and the returned rcuiterators within a read-side critical section.
+ *
+ * @tparam T  Type of the data stored in the rcudldlist.
+ */
+template<typename T>
+class rcudldlist
+{
+public:
+  /**
+   * @brief   Alias for doubly linked dlist item type with according payload type.
+   */
+  typedef dlitem<T> item;
+
+  /**
+   * @brief   Alias for read-side iterator type with according payload type.
+   */
+  typedef rcuiterator<T> iterator;
+
+private:
+  /**
+   * @brief   Pointer to the first item, read concurrently by readers.
+   */
+  std::atomic<item*> m_first;
+
+  /**
+   * @brief   Pointer to the last item.
+   */
+  item* m_last;
+
+  /**
+   * @brief   Chain of unlinked items waiting for a grace period.
+   *
+   * @details The chain is linked via the m_prev pointers of the items, which are never read by readers.
+   *          It is terminated by m_sentinel, so pending items do not appear detached.
+   */
+  _dlitem* m_pending;
+
+  /**
+   * @brief   Terminator of the pending chain.
+   */
+  _dlitem m_sentinel;
+
+  /**
+   * @brief   Reference to the domain of the readers.
+   */
+  rcudomain& m_domain;
+
+  /**
+   * @brief   The copy constructor is prohibited and must not be implemented.
+   */
+  rcudldlist(const rcudldlist&);
+
+  /**
+   * @brief   The copy operator is prohibited and must not be implemented.
+   */
+  rcudldlist& operator=(const rcudldlist&);
+
+  /**
+   * @brief   Publishes a new value of a forward link.
+   *
+   * @param[in] link  The link to set.
+   * @param[in] i     The new value of the link.
+   */
+  static void _publish(_dlitem*& link, _dlitem* i);
+
+  /**
+   * @brief   Unlinks an item and appends it to the pending chain.
+   *
+   * @param[in] i   The item to unlink.
+   */
+  void _unlink(item& i);
+
+public:
+  /**
+   * @brief   Standard constructor.
+   *
+   * @param[in] domain  The domain of the readers.
+   */
+  rcudldlist(rcudomain& domain);
+
+  /**
+   * @brief   Checks whether the rcudldlist is empty.
+   *
+   * @return  true, if the rcudldlist contains no items.
+   */
+  bool empty() const;
+
+  /**
+   * @brief   Retrieves the size of the rcudldlist.
+   *
+   * @note    Must only be called by the writer.
+   *
+   * @return  Number of items in the rcudldlist.
+   */
+  size_t size() const;
+
+  /**
+   * @brief   Checks whether the rcudldlist contains the specified item.
+   *
+   * @note    Must only be called by the writer.
+   *
+   * @return  true, if the specified item is part of the rcudldlist.
+   */
+  bool contains(const T& d) const;
+
+  /**
+   * @brief   Removes all items from the rcudldlist and waits for a grace period.
+   *
+   * @return  The number of removed items.
+   */
+  size_t clear();
+
+  /**
+   * @brief   Retrieves a read-side iterator to the first element in the rcudldlist.
+   *
+   * @return  Iterator pointing to the first element in the rcudldlist.
+   */
+  iterator front() const;
+
+  /**
+   * @brief   Appends an item at the front of the rcudldlist.
+   *
+   * @param[in] i   The item to append.
+   */
+  void push_front(item& i);
+
+  /**
+   * @brief   Appends an item at the back of the rcudldlist.
+   *
+   * @param[in] i   The item to append.
+   */
+  void push_back(item& i);
+
+  /**
+   * @brief   Unlinks the first item from the rcudldlist.
+   *
+   * @note    The item must not be reused before synchronize() has been called.
+   *
+   * @return  Pointer to the unlinked item, or a nullpointer if the rcudldlist was empty.
+   */
+  item* pop_front();
+
+  /**
+   * @brief   Unlinks the last item from the rcudldlist.
+   *
+   * @note    The item must not be reused before synchronize() has been called.
+   *
+   * @return  Pointer to the unlinked item, or a nullpointer if the rcudldlist was empty.
+   */
+  item* pop_back();
+
+  /**
+   * @brief   Unlinks a specific object from the rcudldlist.
+   *
+   * @note    The item must not be reused before synchronize() has been called.
+   *
+   * @param[in] rm  The payload object to remove.
+   *
+   * @return  Pointer to the unlinked item or a nullpointer if the list does not contain the specified object.
+   */
+  item* remove(const T& rm);
+
+  /**
+   * @brief   Unlinks the specified item from the rcudldlist in constant time.
+   *
+   * @note    The item must be part of this rcudldlist.
+   *          It must not be reused before synchronize() has been called.
+   *          Debug builds only check that the neighbours of the item link back to it.
+   *          Membership in this rcudldlist is thus verified for the first and the last item only.
+   *
+   * @param[in] i   The item to unlink.
+   *
+   * @return  Pointer to the unlinked item.
+   */
+  item* unlink(item& i);
+
+  /**
+   * @brief   Waits for a grace period and detaches all items unlinked before.
+   *
+   * @details Unlinking several items and calling synchronize() once amortizes the grace period.
+   *
+   * @return  The number of detached items.
+   */
+  size_t synchronize();
+};
+
+} /* namespace dlist */
+
+#include "rcudlist.tpp"
+
+#endif /* _RCUDLIST_HPP_ */
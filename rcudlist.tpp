@@ -0,0 +1,372 @@
+/*
+The distributed list (dlist) library provides very light-weight real-time
+capable list classes with can optionally be ordered or circular.
+Copyright (C) 2017..2017  Thomas Schöpping
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef _RCUDLIST_TPP_
+#define _RCUDLIST_TPP_
+
+#include <rcudlist.hpp>
+
+#include <cassert>
+#include <new>
+#include <thread>
+
+namespace dlist
+{
+
+////////////////////////////////////////////////////////////////////////////////
+// RCU DOMAIN                                                                 //
+////////////////////////////////////////////////////////////////////////////////
+
+// SLOT ////////////////////////////////////////////////////////////////////////
+
+inline rcudomain::slot::slot() :
+  m_epoch(0), m_used(false)
+{}
+
+// RCUDOMAIN ///////////////////////////////////////////////////////////////////
+
+inline rcudomain::rcudomain(const size_t readers) :
+  m_epoch(1), m_slots(nullptr), m_count(readers)
+{
+  // allocate cache line aligned memory for all slots and construct them in place
+  this->m_slots = static_cast<slot*>(::operator new[](this->m_count * sizeof(slot), std::align_val_t(alignof(slot))));
+  for (size_t s = 0; s < this->m_count; ++s) {
+    new (&this->m_slots[s]) slot();
+  }
+}
+
+inline rcudomain::~rcudomain()
+{
+  for (size_t s = 0; s < this->m_count; ++s) {
+    assert(!this->m_slots[s].m_used.load(std::memory_order_relaxed));
+    this->m_slots[s].~slot();
+  }
+  ::operator delete[](this->m_slots, std::align_val_t(alignof(slot)));
+}
+
+inline size_t rcudomain::readers() const
+{
+  return this->m_count;
+}
+
+inline void rcudomain::synchronize()
+{
+  // order all preceding unlinks before the epoch update and the inspection of the slots
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  const uint64_t target(this->m_epoch.fetch_add(1, std::memory_order_seq_cst) + 1);
+
+  // wait until each reader is either quiescent or has entered its critical section after the update
+  for (size_t s = 0; s < this->m_count; ++s) {
+    while (true) {
+      const uint64_t epoch(this->m_slots[s].m_epoch.load(std::memory_order_acquire));
+      if (epoch == 0 || epoch >= target) {
+        break;
+      }
+      std::this_thread::yield();
+    }
+  }
+  return;
+}
+
+// RCUREADER ///////////////////////////////////////////////////////////////////
+
+inline rcureader::rcureader(rcudomain& domain) :
+  m_domain(domain), m_slot(nullptr)
+{
+  // claim the first free slot
+  for (size_t s = 0; s < domain.m_count; ++s) {
+    bool used(false);
+    if (domain.m_slots[s].m_used.compare_exchange_strong(used, true, std::memory_order_acquire)) {
+      this->m_slot = &domain.m_slots[s];
+      break;
+    }
+  }
+
+  assert(this->m_slot != nullptr);
+}
+
+inline rcureader::~rcureader()
+{
+  assert(this->m_slot->m_epoch.load(std::memory_order_relaxed) == 0);
+
+  this->m_slot->m_used.store(false, std::memory_order_release);
+}
+
+inline void rcureader::lock()
+{
+  assert(this->m_slot->m_epoch.load(std::memory_order_relaxed) == 0);
+
+  // announce the current epoch and order it before any subsequent read of the list
+  this->m_slot->m_epoch.store(this->m_domain.m_epoch.load(std::memory_order_relaxed), std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  return;
+}
+
+inline void rcureader::unlock()
+{
+  this->m_slot->m_epoch.store(0, std::memory_order_release);
+  return;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// RCU ITERATOR                                                               //
+////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+rcuiterator<T>::rcuiterator() :
+  m_item(nullptr)
+{}
+
+template<typename T>
+rcuiterator<T>::rcuiterator(item* i) :
+  m_item(i)
+{}
+
+template<typename T>
+inline bool rcuiterator<T>::operator==(const rcuiterator& it) const
+{
+  return (this->m_item == it.m_item);
+}
+
+template<typename T>
+inline bool rcuiterator<T>::operator!=(const rcuiterator& it) const
+{
+  return (this->m_item != it.m_item);
+}
+
+template<typename T>
+inline rcuiterator<T>& rcuiterator<T>::operator++()
+{
+  if (this->m_item != nullptr) {
+    this->m_item = static_cast<item*>(std::atomic_ref<_dlitem*>(_links::next(*this->m_item)).load(std::memory_order_acquire));
+  }
+  return *this;
+}
+
+template<typename T>
+inline T& rcuiterator<T>::operator*()
+{
+  return **this->m_item;
+}
+
+template<typename T>
+inline T* rcuiterator<T>::operator->()
+{
+  return (this->m_item != nullptr) ? &(**this->m_item) : nullptr;
+}
+
+template<typename T>
+inline bool rcuiterator<T>::valid() const
+{
+  return (this->m_item != nullptr);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// RCU DLIST                                                                  //
+////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+rcudldlist<T>::rcudldlist(rcudomain& domain) :
+  m_first(nullptr), m_last(nullptr), m_pending(&m_sentinel), m_sentinel(), m_domain(domain)
+{}
+
+template<typename T>
+inline void rcudldlist<T>::_publish(_dlitem*& link, _dlitem* i)
+{
+  std::atomic_ref<_dlitem*>(link).store(i, std::memory_order_release);
+}
+
+template<typename T>
+void rcudldlist<T>::_unlink(item& i)
+{
+  _dlitem* prev(_links::prev(i));
+  item* next(static_cast<item*>(_links::next(i)));
+
+  // bypass the item in forward direction, which is what readers follow
+  if (prev == _links::head()) {
+    this->m_first.store(next, std::memory_order_release);
+  } else {
+    _publish(_links::next(*prev), next);
+  }
+  // fix the backward direction, which is private to the writer
+  if (next == nullptr) {
+    this->m_last = (prev != _links::head()) ? static_cast<item*>(prev) : nullptr;
+  } else {
+    _links::prev(*next) = prev;
+  }
+
+  // keep m_next for readers still visiting the item and chain it into the pending items
+  _links::prev(i) = this->m_pending;
+  this->m_pending = &i;
+  return;
+}
+
+template<typename T>
+inline bool rcudldlist<T>::empty() const
+{
+  return (this->m_first.load(std::memory_order_acquire) == nullptr);
+}
+
+template<typename T>
+size_t rcudldlist<T>::size() const
+{
+  size_t cnt(0);
+  for (item* i = this->m_first.load(std::memory_order_relaxed); i != nullptr; i = static_cast<item*>(_links::next(*i))) {
+    ++cnt;
+  }
+  return cnt;
+}
+
+template<typename T>
+bool rcudldlist<T>::contains(const T& d) const
+{
+  for (item* i = this->m_first.load(std::memory_order_relaxed); i != nullptr; i = static_cast<item*>(_links::next(*i))) {
+    if (&(**i) == &d) {
+      return true;
+    }
+  }
+  return false;
+}
+
+template<typename T>
+size_t rcudldlist<T>::clear()
+{
+  size_t cnt(0);
+  // unlink all elements
+  while (this->pop_front() != nullptr) {
+    ++cnt;
+  }
+  this->synchronize();
+  return cnt;
+}
+
+template<typename T>
+inline typename rcudldlist<T>::iterator rcudldlist<T>::front() const
+{
+  return iterator(this->m_first.load(std::memory_order_acquire));
+}
+
+template<typename T>
+void rcudldlist<T>::push_front(item& i)
+{
+  assert(!i.attached());
+
+  // initialize the item before it becomes visible to readers
+  item* first(this->m_first.load(std::memory_order_relaxed));
+  _links::next(i) = first;
+  _links::prev(i) = _links::head();
+  if (first == nullptr) {
+    this->m_last = &i;
+  } else {
+    _links::prev(*first) = &i;
+  }
+  this->m_first.store(&i, std::memory_order_release);
+  return;
+}
+
+template<typename T>
+void rcudldlist<T>::push_back(item& i)
+{
+  assert(!i.attached());
+
+  // initialize the item before it becomes visible to readers
+  // the first item links back to the terminator
+  _links::prev(i) = (this->m_last != nullptr) ? this->m_last : _links::head();
+  if (this->m_last == nullptr) {
+    this->m_first.store(&i, std::memory_order_release);
+  } else {
+    _publish(_links::next(*this->m_last), &i);
+  }
+  this->m_last = &i;
+  return;
+}
+
+template<typename T>
+typename rcudldlist<T>::item* rcudldlist<T>::pop_front()
+{
+  item* i(this->m_first.load(std::memory_order_relaxed));
+  if (i != nullptr) {
+    this->_unlink(*i);
+  }
+  return i;
+}
+
+template<typename T>
+typename rcudldlist<T>::item* rcudldlist<T>::pop_back()
+{
+  item* i(this->m_last);
+  if (i != nullptr) {
+    this->_unlink(*i);
+  }
+  return i;
+}
+
+template<typename T>
+typename rcudldlist<T>::item* rcudldlist<T>::remove(const T& rm)
+{
+  // iterate through the list and unlink the first item pointing to rm
+  for (item* i = this->m_first.load(std::memory_order_relaxed); i != nullptr; i = static_cast<item*>(_links::next(*i))) {
+    if (&(**i) == &rm) {
+      this->_unlink(*i);
+      return i;
+    }
+  }
+  return nullptr;
+}
+
+template<typename T>
+inline typename rcudldlist<T>::item* rcudldlist<T>::unlink(item& i)
+{
+  // check the links of the item only, so that unlinking remains constant in time
+  assert(i.attached());
+  assert((_links::prev(i) == _links::head()) ? (this->m_first.load(std::memory_order_relaxed) == &i) : (_links::next(*_links::prev(i)) == &i));
+  assert((_links::next(i) == nullptr) ? (this->m_last == &i) : (_links::prev(*_links::next(i)) == &i));
+
+  this->_unlink(i);
+  return &i;
+}
+
+template<typename T>
+size_t rcudldlist<T>::synchronize()
+{
+  // nothing to wait for if no items have been unlinked
+  if (this->m_pending == &this->m_sentinel) {
+    return 0;
+  }
+
+  // detach the pending chain and wait for all readers that might still visit one of its items
+  _dlitem* pending(this->m_pending);
+  this->m_pending = &this->m_sentinel;
+  this->m_domain.synchronize();
+
+  // no reader can reach the items anymore, so they can be detached
+  size_t cnt(0);
+  while (pending != &this->m_sentinel) {
+    item* i(static_cast<item*>(pending));
+    pending = _links::prev(*i);
+    _links::prev(*i) = nullptr;
+    _links::next(*i) = nullptr;
+    ++cnt;
+  }
+  return cnt;
+}
+
+} /* namespace dlist */
+
+#endif /* _RCUDLIST_TPP_ */
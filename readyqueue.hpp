@@ -0,0 +1,231 @@
+/*
+The distributed list (dlist) library provides very light-weight real-time
+capable list classes with can optionally be ordered or circular.
+Copyright (C) 2017..2017  Thomas Schöpping
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef _READYQUEUE_HPP_
+#define _READYQUEUE_HPP_
+
+#include <dlist.hpp>
+
+#include <cstdint>
+
+namespace dlist {
+
+////////////////////////////////////////////////////////////////////////////////
+// READY QUEUE                                                                //
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief   Fixed priority round-robin ready queue with one dlcdlist per priority.
+ *
+ * @details A two-level bitmap tracks the non-empty priorities, so the highest one is found with two count-leading-zeros operations.
+ *          Within a priority, entries are served in round-robin order from the eldest to the latest.
+ *          All operations take bounded constant time, independent of the number of entries and priorities.
+ *          Higher values denote higher priorities.
+ *
+ * @note    The readyqueue is not thread-safe.
+ *
+ * @tparam T            Type of the data stored in the readyqueue.
+ * @tparam PRIORITIES   Number of priorities, at most 4096.
+ */
+template<typename T, unsigned int PRIORITIES = 256>
+class readyqueue
+{
+  static_assert(PRIORITIES > 0 && PRIORITIES <= 64 * 64, "readyqueue supports 1 to 4096 priorities");
+
+public:
+  /**
+   * @brief   Alias for doubly linked dlist item type with according payload type.
+   */
+  typedef typename dlcdlist<T>::item item;
+
+  /**
+   * @brief   Doubly linked item with a priority.
+   */
+  class entry : public item
+  {
+  friend class readyqueue;
+
+  private:
+    /**
+     * @brief   The priority of the entry.
+     */
+    unsigned int m_priority;
+
+  public:
+    /**
+     * @brief   The only constructor with payload as argument.
+     *
+     * @param[in] d   The payload to set for the entry.
+     */
+    entry(T& d);
+
+    /**
+     * @brief   Retrieves the priority of the entry.
+     *
+     * @return  The priority the entry has been inserted with.
+     */
+    unsigned int priority() const;
+
+    /**
+     * @brief   Checks whether the entry is linked in a readyqueue.
+     *
+     * @return  true, if the entry is queued.
+     */
+    bool queued() const;
+  };
+
+private:
+  /**
+   * @brief   Number of bitmap words.
+   */
+  static const unsigned int WORDS = (PRIORITIES + 63) / 64;
+
+  /**
+   * @brief   One circular list per priority.
+   */
+  dlcdlist<T> m_levels[PRIORITIES];
+
+  /**
+   * @brief   Bitmap of the non-empty priorities.
+   */
+  uint64_t m_bitmap[WORDS];
+
+  /**
+   * @brief   Bitmap of the non-zero words of m_bitmap.
+   */
+  uint64_t m_summary;
+
+  /**
+   * @brief   Number of queued entries.
+   */
+  size_t m_count;
+
+  /**
+   * @brief   The copy constructor is prohibited and must not be implemented.
+   */
+  readyqueue(const readyqueue&);
+
+  /**
+   * @brief   The copy operator is prohibited and must not be implemented.
+   */
+  readyqueue& operator=(const readyqueue&);
+
+  /**
+   * @brief   Marks a priority as non-empty.
+   *
+   * @param[in] priority  The priority to mark.
+   */
+  void _set(const unsigned int priority);
+
+  /**
+   * @brief   Marks a priority as empty.
+   *
+   * @param[in] priority  The priority to clear.
+   */
+  void _clear(const unsigned int priority);
+
+public:
+  /**
+   * @brief   Default constructor.
+   */
+  readyqueue();
+
+  /**
+   * @brief   Checks whether the readyqueue contains any entries.
+   *
+   * @return  true, if the readyqueue contains no entries.
+   */
+  bool empty() const;
+
+  /**
+   * @brief   Retrieves the number of queued entries in constant time.
+   *
+   * @return  Number of queued entries.
+   */
+  size_t size() const;
+
+  /**
+   * @brief   Retrieves the highest priority of all queued entries.
+   *
+   * @note    The readyqueue must not be empty.
+   *
+   * @return  The highest non-empty priority.
+   */
+  unsigned int top() const;
+
+  /**
+   * @brief   Retrieves the entry to run next without removing it.
+   *
+   * @return  Pointer to the eldest entry of the highest priority, or a nullpointer if the readyqueue is empty.
+   */
+  entry* next() const;
+
+  /**
+   * @brief   Inserts an entry as the latest of its priority.
+   *
+   * @param[in] e         The entry to insert.
+   * @param[in] priority  The priority of the entry.
+   */
+  void insert(entry& e, const unsigned int priority);
+
+  /**
+   * @brief   Removes the entry to run next.
+   *
+   * @return  Pointer to the eldest entry of the highest priority, or a nullpointer if the readyqueue is empty.
+   */
+  entry* pop();
+
+  /**
+   * @brief   Removes a specific entry.
+   *
+   * @param[in] e   The entry to remove.
+   *
+   * @return  true, if the entry was queued and has been removed.
+   */
+  bool remove(entry& e);
+
+  /**
+   * @brief   Moves the eldest entry of the highest priority to the latest position, e.g. when its time slice is used up.
+   */
+  void rotate();
+
+  /**
+   * @brief   Moves the eldest entry of a priority to the latest position.
+   *
+   * @param[in] priority  The priority to rotate.
+   */
+  void rotate(const unsigned int priority);
+
+  /**
+   * @brief   Changes the priority of an entry.
+   *
+   * @details A queued entry is moved to the latest position of the new priority.
+   *          Otherwise only its priority is updated.
+   *
+   * @param[in] e         The entry to change.
+   * @param[in] priority  The new priority.
+   */
+  void reprioritize(entry& e, const unsigned int priority);
+};
+
+} /* namespace dlist */
+
+#include "readyqueue.tpp"
+
+#endif /* _READYQUEUE_HPP_ */
@@ -0,0 +1,201 @@
+/*
+The distributed list (dlist) library provides very light-weight real-time
+capable list classes with can optionally be ordered or circular.
+Copyright (C) 2017..2017  Thomas Schöpping
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef _READYQUEUE_TPP_
+#define _READYQUEUE_TPP_
+
+#include <readyqueue.hpp>
+
+#include <bit>
+#include <cassert>
+
+namespace dlist
+{
+
+////////////////////////////////////////////////////////////////////////////////
+// READY QUEUE                                                                //
+////////////////////////////////////////////////////////////////////////////////
+
+// ENTRY ///////////////////////////////////////////////////////////////////////
+
+template<typename T, unsigned int PRIORITIES>
+readyqueue<T, PRIORITIES>::entry::entry(T& d) :
+  item(d), m_priority(0)
+{}
+
+template<typename T, unsigned int PRIORITIES>
+inline unsigned int readyqueue<T, PRIORITIES>::entry::priority() const
+{
+  return this->m_priority;
+}
+
+template<typename T, unsigned int PRIORITIES>
+inline bool readyqueue<T, PRIORITIES>::entry::queued() const
+{
+  return this->attached();
+}
+
+// READYQUEUE //////////////////////////////////////////////////////////////////
+
+template<typename T, unsigned int PRIORITIES>
+readyqueue<T, PRIORITIES>::readyqueue() :
+  m_levels(), m_bitmap(), m_summary(0), m_count(0)
+{}
+
+template<typename T, unsigned int PRIORITIES>
+inline void readyqueue<T, PRIORITIES>::_set(const unsigned int priority)
+{
+  this->m_bitmap[priority / 64] |= (uint64_t(1) << (priority % 64));
+  this->m_summary |= (uint64_t(1) << (priority / 64));
+  return;
+}
+
+template<typename T, unsigned int PRIORITIES>
+inline void readyqueue<T, PRIORITIES>::_clear(const unsigned int priority)
+{
+  this->m_bitmap[priority / 64] &= ~(uint64_t(1) << (priority % 64));
+  // clear the summary bit once the whole word is empty
+  if (this->m_bitmap[priority / 64] == 0) {
+    this->m_summary &= ~(uint64_t(1) << (priority / 64));
+  }
+  return;
+}
+
+template<typename T, unsigned int PRIORITIES>
+inline bool readyqueue<T, PRIORITIES>::empty() const
+{
+  return (this->m_summary == 0);
+}
+
+template<typename T, unsigned int PRIORITIES>
+inline size_t readyqueue<T, PRIORITIES>::size() const
+{
+  return this->m_count;
+}
+
+template<typename T, unsigned int PRIORITIES>
+inline unsigned int readyqueue<T, PRIORITIES>::top() const
+{
+  assert(!this->empty());
+
+  const unsigned int word(63 - std::countl_zero(this->m_summary));
+  return (word * 64) + (63 - std::countl_zero(this->m_bitmap[word]));
+}
+
+template<typename T, unsigned int PRIORITIES>
+inline typename readyqueue<T, PRIORITIES>::entry* readyqueue<T, PRIORITIES>::next() const
+{
+  // if the readyqueue is empty, return immediately
+  if (this->empty()) {
+    return nullptr;
+  }
+  // select the eldest entry of the highest priority
+  else {
+    return static_cast<entry*>(this->m_levels[this->top()].eldest().get());
+  }
+}
+
+template<typename T, unsigned int PRIORITIES>
+void readyqueue<T, PRIORITIES>::insert(entry& e, const unsigned int priority)
+{
+  assert(!e.attached());
+  assert(priority < PRIORITIES);
+
+  e.m_priority = priority;
+  this->m_levels[priority].insert(e);
+  this->_set(priority);
+  ++this->m_count;
+  return;
+}
+
+template<typename T, unsigned int PRIORITIES>
+typename readyqueue<T, PRIORITIES>::entry* readyqueue<T, PRIORITIES>::pop()
+{
+  // if the readyqueue is empty, return immediately
+  if (this->empty()) {
+    return nullptr;
+  }
+  // remove the eldest entry of the highest priority
+  else {
+    const unsigned int priority(this->top());
+    entry* e(static_cast<entry*>(this->m_levels[priority].remove_eldest()));
+    if (this->m_levels[priority].empty()) {
+      this->_clear(priority);
+    }
+    --this->m_count;
+    return e;
+  }
+}
+
+template<typename T, unsigned int PRIORITIES>
+bool readyqueue<T, PRIORITIES>::remove(entry& e)
+{
+  // if the entry is not queued, there is nothing to do
+  if (!e.attached()) {
+    return false;
+  }
+  // unlink the entry from its priority
+  else {
+    this->m_levels[e.m_priority].unlink(e);
+    if (this->m_levels[e.m_priority].empty()) {
+      this->_clear(e.m_priority);
+    }
+    --this->m_count;
+    return true;
+  }
+}
+
+template<typename T, unsigned int PRIORITIES>
+inline void readyqueue<T, PRIORITIES>::rotate()
+{
+  if (!this->empty()) {
+    this->m_levels[this->top()].rotate();
+  }
+  return;
+}
+
+template<typename T, unsigned int PRIORITIES>
+inline void readyqueue<T, PRIORITIES>::rotate(const unsigned int priority)
+{
+  assert(priority < PRIORITIES);
+
+  this->m_levels[priority].rotate();
+  return;
+}
+
+template<typename T, unsigned int PRIORITIES>
+void readyqueue<T, PRIORITIES>::reprioritize(entry& e, const unsigned int priority)
+{
+  assert(priority < PRIORITIES);
+
+  // move a queued entry to the new priority
+  if (e.attached()) {
+    this->remove(e);
+    this->insert(e, priority);
+  }
+  // otherwise only update the priority
+  else {
+    e.m_priority = priority;
+  }
+  return;
+}
+
+} /* namespace dlist */
+
+#endif /* _READYQUEUE_TPP_ */
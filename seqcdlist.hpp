@@ -0,0 +1,374 @@
+/*
+The distributed list (dlist) library provides very light-weight real-time
+capable list classes with can optionally be ordered or circular.
+Copyright (C) 2017..2017  Thomas Schöpping
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef _SEQCDLIST_HPP_
+#define _SEQCDLIST_HPP_
+
+#include <dlist.hpp>
+
+#include <atomic>
+#include <cstdint>
+
+namespace dlist {
+
+////////////////////////////////////////////////////////////////////////////////
+// SEQLOCK CIRCULAR DLIST BASE CLASS                                          //
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief   Circular dlist with seqlock protected concurrent snapshots.
+ *
+ * @details The single writer modifies the list like the underlying circular dlist and never blocks.
+ *          Each modification is enclosed by two increments of a sequence counter and all link changes are atomic stores.
+ *          Readers take snapshots of the most recent items without writing to any shared memory.
+ *          They only retry if the sequence counter indicates a concurrent modification.
+ *
+ * @note    All functions but snapshot() must be serialized by the caller (typically there is only one writer thread).
+ *          Removed items may still be visited by readers, which retry afterwards.
+ *          Hence their memory must remain valid while snapshots are taken, e.g. by recycling items from a pool.
+ *
+ * @tparam LIST   Type of the underlying circular dlist, which defines the item and iterator types.
+ * @tparam T      Type of the data stored in the list.
+ */
+template<typename LIST, typename T>
+class _seqcdlist
+{
+public:
+  /**
+   * @brief   Alias for item type of the underlying circular dlist.
+   */
+  typedef typename LIST::item item;
+
+  /**
+   * @brief   Alias for iterator type of the underlying circular dlist.
+   */
+  typedef typename LIST::iterator iterator;
+
+protected:
+  /**
+   * @brief   Function type to collect the payloads of a snapshot.
+   *
+   * @param[in]  latest   The latest item.
+   * @param[in]  n        Number of items in the list.
+   * @param[out] out      Array to store the payload pointers to, beginning with the latest one.
+   * @param[in]  cnt      Number of payload pointers to store.
+   *
+   * @return  The number of stored payload pointers, which is less than cnt only if the list was modified concurrently.
+   */
+  typedef size_t collect_f(item* latest, const size_t n, T** out, const size_t cnt);
+
+  /**
+   * @brief   Sequence counter, which is odd while the writer modifies the list.
+   */
+  alignas(64) std::atomic<uint64_t> m_seq;
+
+  /**
+   * @brief   Pointer to the most recently inserted item.
+   */
+  std::atomic<item*> m_latest;
+
+  /**
+   * @brief   Number of items in the list.
+   */
+  std::atomic<size_t> m_count;
+
+  /**
+   * @brief   Default constructor.
+   */
+  _seqcdlist();
+
+  /**
+   * @brief   Starts a modification by making the sequence counter odd.
+   */
+  void _begin();
+
+  /**
+   * @brief   Finishes a modification by making the sequence counter even again.
+   */
+  void _end();
+
+  /**
+   * @brief   Sets a link so that concurrent readers do not race with the writer.
+   *
+   * @param[in] link  The link to set.
+   * @param[in] i     The new value of the link.
+   */
+  static void _store(_slitem*& link, _slitem* i);
+
+  /**
+   * @brief   Sets a link so that concurrent readers do not race with the writer.
+   *
+   * @param[in] link  The link to set.
+   * @param[in] i     The new value of the link.
+   */
+  static void _store(_dlitem*& link, _dlitem* i);
+
+  /**
+   * @brief   Reads a link that might be modified concurrently.
+   *
+   * @param[in] link  The link to read.
+   *
+   * @return  The value of the link.
+   */
+  static item* _load(_slitem*& link);
+
+  /**
+   * @brief   Reads a link that might be modified concurrently.
+   *
+   * @param[in] link  The link to read.
+   *
+   * @return  The value of the link.
+   */
+  static item* _load(_dlitem*& link);
+
+  /**
+   * @brief   Collects payloads until no concurrent modification interfered.
+   *
+   * @param[out] out      Array to store at most k payload pointers to.
+   * @param[in]  k        Maximum number of payload pointers to store.
+   * @param[in]  collect  Function to collect the payloads.
+   *
+   * @return  The number of stored payload pointers.
+   */
+  size_t _read(T** out, const size_t k, collect_f* collect) const;
+
+private:
+  /**
+   * @brief   The copy constructor is prohibited and must not be implemented.
+   */
+  _seqcdlist(const _seqcdlist&);
+
+  /**
+   * @brief   The copy operator is prohibited and must not be implemented.
+   */
+  _seqcdlist& operator=(const _seqcdlist&);
+
+public:
+  /**
+   * @brief   Checks whether the list is empty.
+   *
+   * @return  true, if the list contains no items.
+   */
+  bool empty() const;
+
+  /**
+   * @brief   Retrieves the size of the list in constant time.
+   *
+   * @return  Number of items in the list.
+   */
+  size_t size() const;
+
+  /**
+   * @brief   Checks whether the list contains the specified item.
+   *
+   * @note    Must only be called by the writer.
+   *
+   * @return  true, if the specified item is part of the list.
+   */
+  bool contains(const T& d) const;
+
+  /**
+   * @brief   Retrieves an iterator to the latest element in the list.
+   *
+   * @note    Must only be called by the writer.
+   *
+   * @return  Iterator pointing to the most recently added element in the list.
+   */
+  iterator latest() const;
+
+  /**
+   * @brief   Retrieves an iterator to the eldest element in the list.
+   *
+   * @note    Must only be called by the writer.
+   *
+   * @return  Iterator pointing to the oldest element in the list.
+   */
+  iterator eldest() const;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// SINGLY LINKED SEQLOCK CIRCULAR DLIST                                       //
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief   Singly linked circular dlist with seqlock protected concurrent snapshots.
+ *
+ * @tparam T  Type of the data stored in the seqslcdlist.
+ */
+template<typename T>
+class seqslcdlist : public _seqcdlist<slcdlist<T>, T>
+{
+public:
+  /**
+   * @brief   Alias for singly linked dlist item type with according payload type.
+   */
+  typedef typename _seqcdlist<slcdlist<T>, T>::item item;
+
+private:
+  /**
+   * @brief   Stores the cnt latest of n payloads, walking from the eldest item.
+   *
+   * @param[in]  latest   The latest item.
+   * @param[in]  n        Number of items in the list.
+   * @param[out] out      Array to store the payload pointers to, beginning with the latest one.
+   * @param[in]  cnt      Number of payload pointers to store.
+   *
+   * @return  The number of stored payload pointers.
+   */
+  static size_t _collect(item* latest, const size_t n, T** out, const size_t cnt);
+
+public:
+  /**
+   * @brief   Default constructor.
+   */
+  seqslcdlist();
+
+  /**
+   * @brief   Removes all items from the seqslcdlist.
+   *
+   * @return  The number of removed items.
+   */
+  size_t clear();
+
+  /**
+   * @brief   Inserts the specified item in the seqslcdlist.
+   *
+   * @param[in] i   The item to be insterted.
+   */
+  void insert(item& i);
+
+  /**
+   * @brief   Removes the latest item from the seqslcdlist.
+   *
+   * @return  Pointer to the removed item, or a nullpointer if the seqslcdlist was empty.
+   */
+  item* removeLatest();
+
+  /**
+   * @brief   Removes the oldest item from the seqslcdlist.
+   *
+   * @return  Pointer to the removed item, or a nullpointer if the seqslcdlist was empty.
+   */
+  item* remove_eldest();
+
+  /**
+   * @brief   Takes a consistent snapshot of the most recent payloads.
+   *
+   * @details The function can be called by any thread concurrently to the writer.
+   *          Since the list is singly linked, it walks from the eldest item and skips all but the k latest ones.
+   *
+   * @param[out] out  Array to store at most k payload pointers to, beginning with the latest one.
+   * @param[in]  k    Maximum number of payload pointers to store.
+   *
+   * @return  The number of stored payload pointers.
+   */
+  size_t snapshot(T** out, const size_t k) const;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// DOUBLY LINKED SEQLOCK CIRCULAR DLIST                                       //
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief   Doubly linked circular dlist with seqlock protected concurrent snapshots.
+ *
+ * @tparam T  Type of the data stored in the seqdlcdlist.
+ */
+template<typename T>
+class seqdlcdlist : public _seqcdlist<dlcdlist<T>, T>
+{
+public:
+  /**
+   * @brief   Alias for doubly linked dlist item type with according payload type.
+   */
+  typedef typename _seqcdlist<dlcdlist<T>, T>::item item;
+
+private:
+  /**
+   * @brief   Unlinks an item from the ring, which must contain further items.
+   *
+   * @param[in] i   The item to unlink.
+   */
+  void _unlink(item& i);
+
+  /**
+   * @brief   Stores the cnt latest payloads, walking backwards from the latest item.
+   *
+   * @param[in]  latest   The latest item.
+   * @param[in]  n        Number of items in the list, which bounds the walk.
+   * @param[out] out      Array to store the payload pointers to, beginning with the latest one.
+   * @param[in]  cnt      Number of payload pointers to store.
+   *
+   * @return  The number of stored payload pointers.
+   */
+  static size_t _collect(item* latest, const size_t n, T** out, const size_t cnt);
+
+public:
+  /**
+   * @brief   Default constructor.
+   */
+  seqdlcdlist();
+
+  /**
+   * @brief   Removes all items from the seqdlcdlist.
+   *
+   * @return  The number of removed items.
+   */
+  size_t clear();
+
+  /**
+   * @brief   Inserts the specified item in the seqdlcdlist.
+   *
+   * @param[in] i   The item to be insterted.
+   */
+  void insert(item& i);
+
+  /**
+   * @brief   Removes the latest item from the seqdlcdlist.
+   *
+   * @return  Pointer to the removed item, or a nullpointer if the seqdlcdlist was empty.
+   */
+  item* removeLatest();
+
+  /**
+   * @brief   Removes the oldest item from the seqdlcdlist.
+   *
+   * @return  Pointer to the removed item, or a nullpointer if the seqdlcdlist was empty.
+   */
+  item* remove_eldest();
+
+  /**
+   * @brief   Takes a consistent snapshot of the most recent payloads.
+   *
+   * @details The function can be called by any thread concurrently to the writer.
+   *          It walks backwards from the latest item and thus visits only the k latest items.
+   *
+   * @param[out] out  Array to store at most k payload pointers to, beginning with the latest one.
+   * @param[in]  k    Maximum number of payload pointers to store.
+   *
+   * @return  The number of stored payload pointers.
+   */
+  size_t snapshot(T** out, const size_t k) const;
+};
+
+} /* namespace dlist */
+
+#include "seqcdlist.tpp"
+
+#endif /* _SEQCDLIST_HPP_ */
@@ -0,0 +1,401 @@
+/*
+The distributed list (dlist) library provides very light-weight real-time
+capable list classes with can optionally be ordered or circular.
+Copyright (C) 2017..2017  Thomas Schöpping
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef _SEQCDLIST_TPP_
+#define _SEQCDLIST_TPP_
+
+#include <seqcdlist.hpp>
+
+#include <cassert>
+#include <thread>
+
+namespace dlist
+{
+
+////////////////////////////////////////////////////////////////////////////////
+// SEQLOCK CIRCULAR DLIST BASE CLASS                                          //
+////////////////////////////////////////////////////////////////////////////////
+
+template<typename LIST, typename T>
+_seqcdlist<LIST, T>::_seqcdlist() :
+  m_seq(0), m_latest(nullptr), m_count(0)
+{}
+
+template<typename LIST, typename T>
+inline void _seqcdlist<LIST, T>::_begin()
+{
+  // make the counter odd and order it before all following link changes
+  this->m_seq.store(this->m_seq.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  return;
+}
+
+template<typename LIST, typename T>
+inline void _seqcdlist<LIST, T>::_end()
+{
+  this->m_seq.store(this->m_seq.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+  return;
+}
+
+template<typename LIST, typename T>
+inline void _seqcdlist<LIST, T>::_store(_slitem*& link, _slitem* i)
+{
+  std::atomic_ref<_slitem*>(link).store(i, std::memory_order_relaxed);
+}
+
+template<typename LIST, typename T>
+inline void _seqcdlist<LIST, T>::_store(_dlitem*& link, _dlitem* i)
+{
+  std::atomic_ref<_dlitem*>(link).store(i, std::memory_order_relaxed);
+}
+
+template<typename LIST, typename T>
+inline typename _seqcdlist<LIST, T>::item* _seqcdlist<LIST, T>::_load(_slitem*& link)
+{
+  return static_cast<item*>(std::atomic_ref<_slitem*>(link).load(std::memory_order_relaxed));
+}
+
+template<typename LIST, typename T>
+inline typename _seqcdlist<LIST, T>::item* _seqcdlist<LIST, T>::_load(_dlitem*& link)
+{
+  return static_cast<item*>(std::atomic_ref<_dlitem*>(link).load(std::memory_order_relaxed));
+}
+
+template<typename LIST, typename T>
+size_t _seqcdlist<LIST, T>::_read(T** out, const size_t k, collect_f* collect) const
+{
+  while (true) {
+    // wait for the writer to leave its critical section
+    const uint64_t seq(this->m_seq.load(std::memory_order_acquire));
+    if (seq & 1) {
+      std::this_thread::yield();
+      continue;
+    }
+
+    item* latest(this->m_latest.load(std::memory_order_relaxed));
+    const size_t n(this->m_count.load(std::memory_order_relaxed));
+    const size_t cnt((n < k) ? n : k);
+    const size_t stored((latest != nullptr) ? collect(latest, n, out, cnt) : 0);
+
+    // the snapshot is consistent if the writer did not modify the list in the meantime
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (this->m_seq.load(std::memory_order_relaxed) == seq) {
+      assert(stored == cnt);
+      return cnt;
+    }
+  }
+}
+
+template<typename LIST, typename T>
+inline bool _seqcdlist<LIST, T>::empty() const
+{
+  return (this->m_count.load(std::memory_order_relaxed) == 0);
+}
+
+template<typename LIST, typename T>
+inline size_t _seqcdlist<LIST, T>::size() const
+{
+  return this->m_count.load(std::memory_order_relaxed);
+}
+
+template<typename LIST, typename T>
+bool _seqcdlist<LIST, T>::contains(const T& d) const
+{
+  // if the list is empty, return immediately
+  if (this->empty()) {
+    return false;
+  }
+  // iterate through the list and search for d
+  else {
+    item* latest(this->m_latest.load(std::memory_order_relaxed));
+    item* i(latest);
+    do {
+      if (&(**i) == &d) {
+        return true;
+      }
+      i = static_cast<item*>(_links::next(*i));
+    } while (i != latest);
+    return false;
+  }
+}
+
+template<typename LIST, typename T>
+inline typename _seqcdlist<LIST, T>::iterator _seqcdlist<LIST, T>::latest() const
+{
+  return iterator(this->m_latest.load(std::memory_order_relaxed));
+}
+
+template<typename LIST, typename T>
+inline typename _seqcdlist<LIST, T>::iterator _seqcdlist<LIST, T>::eldest() const
+{
+  iterator it(this->latest());
+  ++it;
+  return it;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// SINGLY LINKED SEQLOCK CIRCULAR DLIST                                       //
+////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+seqslcdlist<T>::seqslcdlist() :
+  _seqcdlist<slcdlist<T>, T>()
+{}
+
+template<typename T>
+size_t seqslcdlist<T>::_collect(item* latest, const size_t n, T** out, const size_t cnt)
+{
+  // skip all but the cnt latest items, beginning with the eldest
+  item* i(seqslcdlist::_load(_links::next(*latest)));
+  for (size_t s = cnt; s < n && i != nullptr; ++s) {
+    i = seqslcdlist::_load(_links::next(*i));
+  }
+  // store the remaining items from the back of the output, so that it begins with the latest
+  size_t stored(0);
+  while (stored < cnt && i != nullptr) {
+    out[cnt - 1 - stored] = &(**i);
+    i = seqslcdlist::_load(_links::next(*i));
+    ++stored;
+  }
+  return stored;
+}
+
+template<typename T>
+size_t seqslcdlist<T>::clear()
+{
+  size_t cnt(0);
+  // remove all elements
+  while (this->remove_eldest() != nullptr) {
+    ++cnt;
+  }
+  return cnt;
+}
+
+template<typename T>
+void seqslcdlist<T>::insert(item& i)
+{
+  assert(!i.attached());
+
+  item* latest(this->m_latest.load(std::memory_order_relaxed));
+  this->_begin();
+  // if the list is empty, the item forms the ring on its own
+  if (latest == nullptr) {
+    this->_store(_links::next(i), &i);
+  }
+  // insert the item behind the m_latest
+  else {
+    this->_store(_links::next(i), _links::next(*latest));
+    this->_store(_links::next(*latest), &i);
+  }
+  this->m_latest.store(&i, std::memory_order_relaxed);
+  this->m_count.store(this->m_count.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+  this->_end();
+  return;
+}
+
+template<typename T>
+typename seqslcdlist<T>::item* seqslcdlist<T>::removeLatest()
+{
+  item* i(this->m_latest.load(std::memory_order_relaxed));
+  // if the list is empty, return immediately
+  if (i == nullptr) {
+    return nullptr;
+  }
+
+  // search for the second latest item before entering the critical section
+  item* second_latest(i);
+  while (_links::next(*second_latest) != i) {
+    second_latest = static_cast<item*>(_links::next(*second_latest));
+  }
+
+  this->_begin();
+  // if the last item will be removed, the list becomes empty
+  if (second_latest == i) {
+    this->m_latest.store(nullptr, std::memory_order_relaxed);
+  }
+  // bypass the latest and decrement m_latest
+  else {
+    this->_store(_links::next(*second_latest), _links::next(*i));
+    this->m_latest.store(second_latest, std::memory_order_relaxed);
+  }
+  this->_store(_links::next(*i), nullptr);
+  this->m_count.store(this->m_count.load(std::memory_order_relaxed) - 1, std::memory_order_relaxed);
+  this->_end();
+  return i;
+}
+
+template<typename T>
+typename seqslcdlist<T>::item* seqslcdlist<T>::remove_eldest()
+{
+  item* latest(this->m_latest.load(std::memory_order_relaxed));
+  // if the list is empty, return immediately
+  if (latest == nullptr) {
+    return nullptr;
+  }
+
+  item* i(static_cast<item*>(_links::next(*latest)));
+  this->_begin();
+  // if the last item will be removed, the list becomes empty
+  if (i == latest) {
+    this->m_latest.store(nullptr, std::memory_order_relaxed);
+  }
+  // bypass the eldest
+  else {
+    this->_store(_links::next(*latest), _links::next(*i));
+  }
+  this->_store(_links::next(*i), nullptr);
+  this->m_count.store(this->m_count.load(std::memory_order_relaxed) - 1, std::memory_order_relaxed);
+  this->_end();
+  return i;
+}
+
+template<typename T>
+inline size_t seqslcdlist<T>::snapshot(T** out, const size_t k) const
+{
+  return this->_read(out, k, &seqslcdlist::_collect);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// DOUBLY LINKED SEQLOCK CIRCULAR DLIST                                       //
+////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+seqdlcdlist<T>::seqdlcdlist() :
+  _seqcdlist<dlcdlist<T>, T>()
+{}
+
+template<typename T>
+void seqdlcdlist<T>::_unlink(item& i)
+{
+  this->_store(_links::next(*_links::prev(i)), _links::next(i));
+  this->_store(_links::prev(*_links::next(i)), _links::prev(i));
+  return;
+}
+
+template<typename T>
+size_t seqdlcdlist<T>::_collect(item* latest, const size_t n, T** out, const size_t cnt)
+{
+  // walk backwards from the latest item, but never farther than the snapshot of the size, even if the links are torn
+  item* i(latest);
+  size_t stored(0);
+  while (stored < cnt && stored < n && i != nullptr) {
+    out[stored] = &(**i);
+    i = seqdlcdlist::_load(_links::prev(*i));
+    ++stored;
+  }
+  return stored;
+}
+
+template<typename T>
+size_t seqdlcdlist<T>::clear()
+{
+  size_t cnt(0);
+  // remove all elements
+  while (this->remove_eldest() != nullptr) {
+    ++cnt;
+  }
+  return cnt;
+}
+
+template<typename T>
+void seqdlcdlist<T>::insert(item& i)
+{
+  assert(!i.attached());
+
+  item* latest(this->m_latest.load(std::memory_order_relaxed));
+  this->_begin();
+  // if the list is empty, the item forms the ring on its own
+  if (latest == nullptr) {
+    this->_store(_links::prev(i), &i);
+    this->_store(_links::next(i), &i);
+  }
+  // insert the item behind the m_latest
+  else {
+    this->_store(_links::prev(i), latest);
+    this->_store(_links::next(i), _links::next(*latest));
+    this->_store(_links::prev(*_links::next(*latest)), &i);
+    this->_store(_links::next(*latest), &i);
+  }
+  this->m_latest.store(&i, std::memory_order_relaxed);
+  this->m_count.store(this->m_count.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+  this->_end();
+  return;
+}
+
+template<typename T>
+typename seqdlcdlist<T>::item* seqdlcdlist<T>::removeLatest()
+{
+  item* i(this->m_latest.load(std::memory_order_relaxed));
+  // if the list is empty, return immediately
+  if (i == nullptr) {
+    return nullptr;
+  }
+
+  this->_begin();
+  // if the last item will be removed, the list becomes empty
+  if (_links::next(*i) == i) {
+    this->m_latest.store(nullptr, std::memory_order_relaxed);
+  }
+  // unlink the latest and decrement m_latest
+  else {
+    this->m_latest.store(static_cast<item*>(_links::prev(*i)), std::memory_order_relaxed);
+    this->_unlink(*i);
+  }
+  this->_store(_links::prev(*i), nullptr);
+  this->_store(_links::next(*i), nullptr);
+  this->m_count.store(this->m_count.load(std::memory_order_relaxed) - 1, std::memory_order_relaxed);
+  this->_end();
+  return i;
+}
+
+template<typename T>
+typename seqdlcdlist<T>::item* seqdlcdlist<T>::remove_eldest()
+{
+  item* latest(this->m_latest.load(std::memory_order_relaxed));
+  // if the list is empty, return immediately
+  if (latest == nullptr) {
+    return nullptr;
+  }
+
+  item* i(static_cast<item*>(_links::next(*latest)));
+  this->_begin();
+  // if the last item will be removed, the list becomes empty
+  if (i == latest) {
+    this->m_latest.store(nullptr, std::memory_order_relaxed);
+  }
+  // unlink the eldest
+  else {
+    this->_unlink(*i);
+  }
+  this->_store(_links::prev(*i), nullptr);
+  this->_store(_links::next(*i), nullptr);
+  this->m_count.store(this->m_count.load(std::memory_order_relaxed) - 1, std::memory_order_relaxed);
+  this->_end();
+  return i;
+}
+
+template<typename T>
+inline size_t seqdlcdlist<T>::snapshot(T** out, const size_t k) const
+{
+  return this->_read(out, k, &seqdlcdlist::_collect);
+}
+
+} /* namespace dlist */
+
+#endif /* _SEQCDLIST_TPP_ */
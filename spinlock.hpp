@@ -0,0 +1,92 @@
+/*
+The distributed list (dlist) library provides very light-weight real-time
+capable list classes with can optionally be ordered or circular.
+Copyright (C) 2017..2017  Thomas Schöpping
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef _SPINLOCK_HPP_
+#define _SPINLOCK_HPP_
+
+#include <atomic>
+
+namespace dlist {
+
+////////////////////////////////////////////////////////////////////////////////
+// SPINLOCK                                                                   //
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief   Minimal test-and-test-and-set spinlock.
+ *
+ * @details The lock satisfies the Lockable requirements and can thus be used with std::lock_guard and std::unique_lock.
+ *          It is intended to protect the very short critical sections of dlist operations, which never block.
+ */
+class spinlock
+{
+private:
+  /**
+   * @brief   Lock flag, true while the lock is held.
+   */
+  std::atomic<bool> m_locked;
+
+  /**
+   * @brief   The copy constructor is prohibited and must not be implemented.
+   */
+  spinlock(const spinlock&);
+
+  /**
+   * @brief   The copy operator is prohibited and must not be implemented.
+   */
+  spinlock& operator=(const spinlock&);
+
+public:
+  /**
+   * @brief   Default constructor.
+   */
+  spinlock();
+
+  /**
+   * @brief   Acquires the lock, spinning until it becomes available.
+   */
+  void lock();
+
+  /**
+   * @brief   Tries to acquire the lock without spinning.
+   *
+   * @return  true, if the lock has been acquired.
+   */
+  bool try_lock();
+
+  /**
+   * @brief   Releases the lock.
+   */
+  void unlock();
+
+  /**
+   * @brief   Checks whether the lock is currently held by any thread.
+   *
+   * @note    The result is only a snapshot and may be outdated immediately.
+   *
+   * @return  true, if the lock is held.
+   */
+  bool locked() const;
+};
+
+} /* namespace dlist */
+
+#include "spinlock.tpp"
+
+#endif /* _SPINLOCK_HPP_ */
@@ -0,0 +1,75 @@
+/*
+The distributed list (dlist) library provides very light-weight real-time
+capable list classes with can optionally be ordered or circular.
+Copyright (C) 2017..2017  Thomas Schöpping
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef _SPINLOCK_TPP_
+#define _SPINLOCK_TPP_
+
+#include <spinlock.hpp>
+
+#include <thread>
+
+namespace dlist
+{
+
+////////////////////////////////////////////////////////////////////////////////
+// SPINLOCK                                                                   //
+////////////////////////////////////////////////////////////////////////////////
+
+inline spinlock::spinlock() :
+  m_locked(false)
+{}
+
+inline void spinlock::lock()
+{
+  while (true) {
+    // try to grab the lock
+    if (!this->m_locked.exchange(true, std::memory_order_acquire)) {
+      return;
+    }
+    // spin on a plain load so the cache line is not bounced while the lock is held
+    unsigned int spins(0);
+    while (this->m_locked.load(std::memory_order_relaxed)) {
+      if (++spins > 64) {
+        std::this_thread::yield();
+        spins = 0;
+      }
+    }
+  }
+}
+
+inline bool spinlock::try_lock()
+{
+  // test first to avoid a write on a contended lock
+  return !this->m_locked.load(std::memory_order_relaxed) &&
+         !this->m_locked.exchange(true, std::memory_order_acquire);
+}
+
+inline void spinlock::unlock()
+{
+  this->m_locked.store(false, std::memory_order_release);
+}
+
+inline bool spinlock::locked() const
+{
+  return this->m_locked.load(std::memory_order_relaxed);
+}
+
+} /* namespace dlist */
+
+#endif /* _SPINLOCK_TPP_ */
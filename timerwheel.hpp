@@ -0,0 +1,239 @@
+/*
+The distributed list (dlist) library provides very light-weight real-time
+capable list classes with can optionally be ordered or circular.
+Copyright (C) 2017..2017  Thomas Schöpping
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef _TIMERWHEEL_HPP_
+#define _TIMERWHEEL_HPP_
+
+#include <dlist.hpp>
+
+#include <cstdint>
+
+namespace dlist {
+
+////////////////////////////////////////////////////////////////////////////////
+// TIMER WHEEL                                                                //
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief   Hierarchical timing wheel of doubly linked timers.
+ *
+ * @details The wheel consists of LEVELS levels of SLOTS buckets each, where every bucket is a dldlist.
+ *          Level 0 holds timers that expire within the next SLOTS ticks, one bucket per tick.
+ *          Each further level covers SLOTS times the range of the level below.
+ *          When the time reaches the range of a higher level bucket, its timers are cascaded to the lower levels.
+ *          Thus arming and cancelling a timer take constant time and advancing takes amortized constant time per tick and timer.
+ *          Ticks without any timer to expire or cascade are skipped.
+ *          Timers further in the future than the range of the wheel are parked in the highest level and cascaded repeatedly.
+ *
+ * @note    The timerwheel is not thread-safe.
+ *
+ * @tparam T  Type of the data stored in the timerwheel.
+ */
+template<typename T>
+class timerwheel
+{
+public:
+  /**
+   * @brief   Alias for doubly linked dlist item type with according payload type.
+   */
+  typedef typename dldlist<T>::item item;
+
+  /**
+   * @brief   Doubly linked item with an expiry time.
+   *
+   * @details Expired timers are handed back as items of a dldlist and can be casted back to timers.
+   */
+  class timer : public item
+  {
+  friend class timerwheel;
+
+  private:
+    /**
+     * @brief   Tick at which the timer expires.
+     */
+    uint64_t m_expiry;
+
+    /**
+     * @brief   Level of the bucket holding the timer, or LEVELS for the list of due timers.
+     */
+    uint8_t m_level;
+
+    /**
+     * @brief   Slot of the bucket holding the timer.
+     */
+    uint8_t m_slot;
+
+  public:
+    /**
+     * @brief   The only constructor with payload as argument.
+     *
+     * @param[in] d   The payload to set for the timer.
+     */
+    timer(T& d);
+
+    /**
+     * @brief   Retrieves the tick at which the timer expires or has expired.
+     *
+     * @return  Expiry tick of the timer.
+     */
+    uint64_t expiry() const;
+  };
+
+  /**
+   * @brief   Number of levels.
+   */
+  static const unsigned int LEVELS = 4;
+
+  /**
+   * @brief   Number of bits of the tick that select the slot within a level.
+   */
+  static const unsigned int BITS = 8;
+
+  /**
+   * @brief   Number of buckets per level.
+   */
+  static const unsigned int SLOTS = 1u << BITS;
+
+private:
+  /**
+   * @brief   The buckets of all levels.
+   */
+  dldlist<T> m_buckets[LEVELS][SLOTS];
+
+  /**
+   * @brief   Timers that are due on the next advance.
+   */
+  dldlist<T> m_due;
+
+  /**
+   * @brief   Number of timers per level.
+   */
+  size_t m_pending[LEVELS];
+
+  /**
+   * @brief   Number of armed timers.
+   */
+  size_t m_count;
+
+  /**
+   * @brief   The current tick.
+   */
+  uint64_t m_now;
+
+  /**
+   * @brief   The copy constructor is prohibited and must not be implemented.
+   */
+  timerwheel(const timerwheel&);
+
+  /**
+   * @brief   The copy operator is prohibited and must not be implemented.
+   */
+  timerwheel& operator=(const timerwheel&);
+
+  /**
+   * @brief   Links a timer into the bucket according to its expiry relative to the current tick.
+   *
+   * @param[in] t   The timer to link.
+   */
+  void _place(timer& t);
+
+  /**
+   * @brief   Relinks all timers of a bucket to the lower levels.
+   *
+   * @param[in] level   Level of the bucket.
+   * @param[in] slot    Slot of the bucket.
+   */
+  void _cascade(const unsigned int level, const unsigned int slot);
+
+  /**
+   * @brief   Disarms all timers of a list and appends them to the output list.
+   *
+   * @param[in] l     The list of expired timers.
+   * @param[in] out   The list to append the timers to.
+   *
+   * @return  The number of expired timers.
+   */
+  size_t _expire(dldlist<T>& l, dldlist<T>& out);
+
+public:
+  /**
+   * @brief   Standard constructor.
+   *
+   * @param[in] now   The initial tick.
+   */
+  timerwheel(const uint64_t now = 0);
+
+  /**
+   * @brief   Retrieves the current tick.
+   *
+   * @return  The tick passed to the last advance.
+   */
+  uint64_t now() const;
+
+  /**
+   * @brief   Checks whether any timer is armed.
+   *
+   * @return  true, if no timer is armed.
+   */
+  bool empty() const;
+
+  /**
+   * @brief   Retrieves the number of armed timers in constant time.
+   *
+   * @return  Number of armed timers.
+   */
+  size_t size() const;
+
+  /**
+   * @brief   Arms a timer in constant time.
+   *
+   * @details A timer that expires at or before the current tick expires on the next advance.
+   *
+   * @param[in] t       The timer to arm, which must not be attached.
+   * @param[in] expiry  The tick at which the timer expires.
+   */
+  void arm(timer& t, const uint64_t expiry);
+
+  /**
+   * @brief   Cancels a timer in constant time.
+   *
+   * @param[in] t   The timer to cancel, which must either be armed in the timerwheel or not be attached.
+   *
+   * @return  true, if the timer was armed and has been cancelled.
+   */
+  bool cancel(timer& t);
+
+  /**
+   * @brief   Advances the current tick and appends all expired timers to a list.
+   *
+   * @details The buckets of expired timers are spliced to the output list in the order of their expiry.
+   *
+   * @param[in] now   The new tick, which must not be before the current tick.
+   * @param[in] out   The list to append the expired timers to.
+   *
+   * @return  The number of expired timers.
+   */
+  size_t advance(const uint64_t now, dldlist<T>& out);
+};
+
+} /* namespace dlist */
+
+#include "timerwheel.tpp"
+
+#endif /* _TIMERWHEEL_HPP_ */
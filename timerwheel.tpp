@@ -0,0 +1,202 @@
+/*
+The distributed list (dlist) library provides very light-weight real-time
+capable list classes with can optionally be ordered or circular.
+Copyright (C) 2017..2017  Thomas Schöpping
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef _TIMERWHEEL_TPP_
+#define _TIMERWHEEL_TPP_
+
+#include <timerwheel.hpp>
+
+#include <cassert>
+
+namespace dlist
+{
+
+////////////////////////////////////////////////////////////////////////////////
+// TIMER WHEEL                                                                //
+////////////////////////////////////////////////////////////////////////////////
+
+// TIMER ///////////////////////////////////////////////////////////////////////
+
+template<typename T>
+timerwheel<T>::timer::timer(T& d) :
+  item(d), m_expiry(0), m_level(0), m_slot(0)
+{}
+
+template<typename T>
+inline uint64_t timerwheel<T>::timer::expiry() const
+{
+  return this->m_expiry;
+}
+
+// TIMERWHEEL //////////////////////////////////////////////////////////////////
+
+template<typename T>
+timerwheel<T>::timerwheel(const uint64_t now) :
+  m_buckets(), m_due(), m_pending(), m_count(0), m_now(now)
+{}
+
+template<typename T>
+void timerwheel<T>::_place(timer& t)
+{
+  // if the timer is due already, it expires on the next advance
+  if (t.m_expiry <= this->m_now) {
+    t.m_level = LEVELS;
+    this->m_due.push_back(t);
+    return;
+  }
+
+  // select the lowest level whose range covers the expiry, or park the timer at the end of the highest level
+  const uint64_t delta(t.m_expiry - this->m_now);
+  unsigned int level(0);
+  while (level < LEVELS - 1 && delta >= (uint64_t(1) << (BITS * (level + 1)))) {
+    ++level;
+  }
+  uint64_t expiry(t.m_expiry);
+  if (level == LEVELS - 1 && delta >= (uint64_t(1) << (BITS * LEVELS))) {
+    expiry = this->m_now + (uint64_t(1) << (BITS * LEVELS)) - 1;
+  }
+
+  t.m_level = static_cast<uint8_t>(level);
+  t.m_slot = static_cast<uint8_t>((expiry >> (BITS * level)) & (SLOTS - 1));
+  this->m_buckets[level][t.m_slot].push_back(t);
+  ++this->m_pending[level];
+  return;
+}
+
+template<typename T>
+void timerwheel<T>::_cascade(const unsigned int level, const unsigned int slot)
+{
+  // take the whole bucket first, since parked timers might be linked into it again
+  dldlist<T> batch;
+  batch.splice_back(this->m_buckets[level][slot]);
+  while (item* i = batch.pop_front()) {
+    --this->m_pending[level];
+    this->_place(*static_cast<timer*>(i));
+  }
+  return;
+}
+
+template<typename T>
+size_t timerwheel<T>::_expire(dldlist<T>& l, dldlist<T>& out)
+{
+  const size_t cnt(l.size());
+  out.splice_back(l);
+  this->m_count -= cnt;
+  return cnt;
+}
+
+template<typename T>
+inline uint64_t timerwheel<T>::now() const
+{
+  return this->m_now;
+}
+
+template<typename T>
+inline bool timerwheel<T>::empty() const
+{
+  return (this->m_count == 0);
+}
+
+template<typename T>
+inline size_t timerwheel<T>::size() const
+{
+  return this->m_count;
+}
+
+template<typename T>
+void timerwheel<T>::arm(timer& t, const uint64_t expiry)
+{
+  assert(!t.attached());
+
+  t.m_expiry = expiry;
+  ++this->m_count;
+  this->_place(t);
+  return;
+}
+
+template<typename T>
+bool timerwheel<T>::cancel(timer& t)
+{
+  // if the timer is not armed, there is nothing to do
+  if (!t.attached()) {
+    return false;
+  }
+  // unlink the timer from its bucket
+  else {
+    if (t.m_level == LEVELS) {
+      this->m_due.unlink(t);
+    } else {
+      this->m_buckets[t.m_level][t.m_slot].unlink(t);
+      --this->m_pending[t.m_level];
+    }
+    --this->m_count;
+    return true;
+  }
+}
+
+template<typename T>
+size_t timerwheel<T>::advance(const uint64_t now, dldlist<T>& out)
+{
+  assert(now >= this->m_now);
+
+  // timers armed for the current tick or before are due immediately
+  size_t cnt(this->_expire(this->m_due, out));
+
+  while (this->m_now < now) {
+    // find the lowest level that holds any timers
+    unsigned int level(0);
+    while (level < LEVELS && this->m_pending[level] == 0) {
+      ++level;
+    }
+
+    // if the wheel is empty, jump to the new tick
+    if (level == LEVELS) {
+      this->m_now = now;
+      break;
+    }
+    // if the lower levels are empty, skip all ticks until the next bucket of that level is cascaded
+    else if (level > 0) {
+      const uint64_t boundary(((this->m_now >> (BITS * level)) + 1) << (BITS * level));
+      if (boundary > now) {
+        this->m_now = now;
+        break;
+      }
+      this->m_now = boundary - 1;
+    }
+
+    // advance by a single tick and cascade the higher levels first, whenever their range is reached
+    const uint64_t tick(++this->m_now);
+    for (unsigned int l = LEVELS - 1; l > 0; --l) {
+      if ((tick & ((uint64_t(1) << (BITS * l)) - 1)) == 0) {
+        this->_cascade(l, (tick >> (BITS * l)) & (SLOTS - 1));
+      }
+    }
+
+    // expire the timers that have been cascaded right to this tick and the bucket of this tick
+    cnt += this->_expire(this->m_due, out);
+    const size_t expired(this->_expire(this->m_buckets[0][tick & (SLOTS - 1)], out));
+    this->m_pending[0] -= expired;
+    cnt += expired;
+  }
+  return cnt;
+}
+
+} /* namespace dlist */
+
+#endif /* _TIMERWHEEL_TPP_ */
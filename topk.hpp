@@ -0,0 +1,234 @@
+/*
+The distributed list (dlist) library provides very light-weight real-time
+capable list classes with can optionally be ordered or circular.
+Copyright (C) 2017..2017  Thomas Schöpping
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef _TOPK_HPP_
+#define _TOPK_HPP_
+
+#include <dlist.hpp>
+
+namespace dlist {
+
+////////////////////////////////////////////////////////////////////////////////
+// TOP-K BASE CLASS                                                           //
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief   Tracker of the K greatest items of a stream, which wraps a capacity bounded ordered dlist.
+ *
+ * @details Once the capacity is reached, a candidate that is not greater than the current minimum is rejected in constant time without walking the list.
+ *          An accepted candidate replaces the minimum, which is handed back for reuse.
+ *
+ * @tparam LIST   Type of the underlying counted ordered dlist.
+ * @tparam T      Type of the data stored in the list.
+ */
+template<typename LIST, typename T>
+class _topk
+{
+public:
+  /**
+   * @brief   Alias for item type of the underlying ordered dlist.
+   */
+  typedef typename LIST::item item;
+
+  /**
+   * @brief   Alias for iterator type of the underlying ordered dlist.
+   */
+  typedef typename LIST::iterator iterator;
+
+  /**
+   * @brief   Alias for compare function of the underlying ordered dlist.
+   */
+  typedef typename LIST::cmp_f cmp_f;
+
+protected:
+  /**
+   * @brief   The underlying ordered dlist.
+   */
+  LIST m_list;
+
+  /**
+   * @brief   Maximum number of items.
+   */
+  const size_t m_capacity;
+
+  /**
+   * @brief   Reference to the compare function shared with the underlying ordered dlist.
+   */
+  const cmp_f& m_cmp;
+
+  /**
+   * @brief   Standard constructor.
+   *
+   * @param[in] capacity  Number K of items to keep.
+   * @param[in] cmp       Reference to a compare function.
+   */
+  _topk(const size_t capacity, cmp_f& cmp);
+
+private:
+  /**
+   * @brief   The copy constructor is prohibited and must not be implemented.
+   */
+  _topk(const _topk&);
+
+  /**
+   * @brief   The copy operator is prohibited and must not be implemented.
+   */
+  _topk& operator=(const _topk&);
+
+public:
+  /**
+   * @brief   Checks whether the list is empty.
+   *
+   * @return  true, if the list contains no items.
+   */
+  bool empty() const;
+
+  /**
+   * @brief   Checks whether the list is full.
+   *
+   * @return  true, if candidates are compared to the minimum.
+   */
+  bool full() const;
+
+  /**
+   * @brief   Retrieves the size of the list in constant time.
+   *
+   * @return  Number of items in the list.
+   */
+  size_t size() const;
+
+  /**
+   * @brief   Retrieves the maximum number of items.
+   *
+   * @return  The number K of items to keep.
+   */
+  size_t capacity() const;
+
+  /**
+   * @brief   Checks whether the list contains the specified item.
+   *
+   * @return  true, if the specified item is part of the list.
+   */
+  bool contains(const T& d) const;
+
+  /**
+   * @brief   Removes all items from the list.
+   *
+   * @return  The number of removed items.
+   */
+  size_t clear();
+
+  /**
+   * @brief   Removes a specific object from the list.
+   *
+   * @param[in] rm  The payload object to remove.
+   *
+   * @return  Pointer to the removed item or a nullpointer if the list does not contain the specified object.
+   */
+  item* remove(const T& rm);
+
+  /**
+   * @brief   Retrieves the smallest of the tracked items in constant time.
+   *
+   * @return  Iterator to the minimum item.
+   */
+  iterator min() const;
+
+  /**
+   * @brief   Retrieves the greatest of the tracked items in constant time.
+   *
+   * @return  Iterator to the maximum item.
+   */
+  iterator max() const;
+
+  /**
+   * @brief   Offers a candidate item.
+   *
+   * @details If the list is not full, the candidate is inserted.
+   *          Otherwise, a candidate that is not greater than the minimum is rejected in constant time, and an accepted candidate replaces the minimum.
+   *
+   * @param[in] i   The candidate item, which must not be part of any list.
+   *
+   * @return  Pointer to the rejected candidate or to the replaced minimum, or a nullpointer if the list was not full.
+   */
+  item* offer(item& i);
+
+  /**
+   * @brief   Removes the smallest of the tracked items.
+   *
+   * @return  Pointer to the removed item, or a nullpointer if the list was empty.
+   */
+  item* removeMin();
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// TOP-K CLASSES                                                              //
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief   Top-K tracker on a singly linked ordered dlist.
+ *
+ * @tparam T  Type of the data stored in the sltopk.
+ */
+template<typename T>
+class sltopk : public _topk<basic_dlist<SINGLY_LINKED, ORDERED, LINEAR, T, counted>, T>
+{
+public:
+  /**
+   * @brief   Alias for compare function.
+   */
+  typedef typename _topk<basic_dlist<SINGLY_LINKED, ORDERED, LINEAR, T, counted>, T>::cmp_f cmp_f;
+
+  /**
+   * @brief   Standard constructor.
+   *
+   * @param[in] capacity  Number K of items to keep.
+   * @param[in] cmp       Reference to a compare function.
+   */
+  sltopk(const size_t capacity, cmp_f& cmp = _defaultCmp);
+};
+
+/**
+ * @brief   Top-K tracker on a doubly linked ordered dlist.
+ *
+ * @tparam T  Type of the data stored in the dltopk.
+ */
+template<typename T>
+class dltopk : public _topk<basic_dlist<DOUBLY_LINKED, ORDERED, LINEAR, T, counted>, T>
+{
+public:
+  /**
+   * @brief   Alias for compare function.
+   */
+  typedef typename _topk<basic_dlist<DOUBLY_LINKED, ORDERED, LINEAR, T, counted>, T>::cmp_f cmp_f;
+
+  /**
+   * @brief   Standard constructor.
+   *
+   * @param[in] capacity  Number K of items to keep.
+   * @param[in] cmp       Reference to a compare function.
+   */
+  dltopk(const size_t capacity, cmp_f& cmp = _defaultCmp);
+};
+
+} /* namespace dlist */
+
+#include "topk.tpp"
+
+#endif /* _TOPK_HPP_ */
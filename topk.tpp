@@ -0,0 +1,141 @@
+/*
+The distributed list (dlist) library provides very light-weight real-time
+capable list classes with can optionally be ordered or circular.
+Copyright (C) 2017..2017  Thomas Schöpping
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef _TOPK_TPP_
+#define _TOPK_TPP_
+
+#include <topk.hpp>
+
+#include <cassert>
+
+namespace dlist
+{
+
+////////////////////////////////////////////////////////////////////////////////
+// TOP-K BASE CLASS                                                           //
+////////////////////////////////////////////////////////////////////////////////
+
+template<typename LIST, typename T>
+_topk<LIST, T>::_topk(const size_t capacity, cmp_f& cmp) :
+  m_list(cmp), m_capacity(capacity), m_cmp(cmp)
+{
+  assert(capacity > 0);
+}
+
+template<typename LIST, typename T>
+inline bool _topk<LIST, T>::empty() const
+{
+  return this->m_list.empty();
+}
+
+template<typename LIST, typename T>
+inline bool _topk<LIST, T>::full() const
+{
+  return (this->m_list.size() >= this->m_capacity);
+}
+
+template<typename LIST, typename T>
+inline size_t _topk<LIST, T>::size() const
+{
+  return this->m_list.size();
+}
+
+template<typename LIST, typename T>
+inline size_t _topk<LIST, T>::capacity() const
+{
+  return this->m_capacity;
+}
+
+template<typename LIST, typename T>
+inline bool _topk<LIST, T>::contains(const T& d) const
+{
+  return this->m_list.contains(d);
+}
+
+template<typename LIST, typename T>
+size_t _topk<LIST, T>::clear()
+{
+  return this->m_list.clear();
+}
+
+template<typename LIST, typename T>
+typename _topk<LIST, T>::item* _topk<LIST, T>::remove(const T& rm)
+{
+  return this->m_list.remove(rm);
+}
+
+template<typename LIST, typename T>
+inline typename _topk<LIST, T>::iterator _topk<LIST, T>::min() const
+{
+  return this->m_list.min();
+}
+
+template<typename LIST, typename T>
+inline typename _topk<LIST, T>::iterator _topk<LIST, T>::max() const
+{
+  return this->m_list.max();
+}
+
+template<typename LIST, typename T>
+typename _topk<LIST, T>::item* _topk<LIST, T>::offer(item& i)
+{
+  // if the list is not full, insert the candidate
+  if (!this->full()) {
+    this->m_list.insert(i);
+    return nullptr;
+  }
+  // reject the candidate if it is not greater than the minimum
+  else if (!this->m_cmp(*this->m_list.min(), *i)) {
+    return &i;
+  }
+  // replace the minimum by the candidate
+  else {
+    item* min(this->m_list.removeMin());
+    this->m_list.insert(i);
+    return min;
+  }
+}
+
+template<typename LIST, typename T>
+typename _topk<LIST, T>::item* _topk<LIST, T>::removeMin()
+{
+  return this->m_list.removeMin();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// TOP-K CLASSES                                                              //
+////////////////////////////////////////////////////////////////////////////////
+
+// SINGLY LINKED TOP-K /////////////////////////////////////////////////////////
+
+template<typename T>
+sltopk<T>::sltopk(const size_t capacity, cmp_f& cmp) :
+  _topk<basic_dlist<SINGLY_LINKED, ORDERED, LINEAR, T, counted>, T>(capacity, cmp)
+{}
+
+// DOUBLY LINKED TOP-K /////////////////////////////////////////////////////////
+
+template<typename T>
+dltopk<T>::dltopk(const size_t capacity, cmp_f& cmp) :
+  _topk<basic_dlist<DOUBLY_LINKED, ORDERED, LINEAR, T, counted>, T>(capacity, cmp)
+{}
+
+} /* namespace dlist */
+
+#endif /* _TOPK_TPP_ */
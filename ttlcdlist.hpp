@@ -0,0 +1,204 @@
+/*
+The distributed list (dlist) library provides very light-weight real-time
+capable list classes with can optionally be ordered or circular.
+Copyright (C) 2017..2017  Thomas Schöpping
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef _TTLCDLIST_HPP_
+#define _TTLCDLIST_HPP_
+
+#include <dlist.hpp>
+
+#include <cstdint>
+
+namespace dlist {
+
+////////////////////////////////////////////////////////////////////////////////
+// TIME TO LIVE CIRCULAR DLIST                                                //
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief   Doubly linked circular dlist of timestamped entries, which expire after a fixed time to live.
+ *
+ * @details The entries are kept in a counted doubly linked circular dlist in the order of their timestamps, so the eldest entry is always the stalest one.
+ *          Inserting and touching an entry move it to the latest position in constant time.
+ *          Expiring searches the first live entry from the eldest one on and detaches all stale entries before it as one range.
+ *          Hence purging takes time proportional to the number of expired entries rather than to the total number of entries.
+ *
+ * @note    The ttlcdlist is not thread-safe.
+ *
+ * @tparam T  Type of the data stored in the ttlcdlist.
+ */
+template<typename T>
+class ttlcdlist
+{
+public:
+  /**
+   * @brief   Alias for doubly linked dlist item type with according payload type.
+   */
+  typedef typename dlcdlist<T>::item item;
+
+  /**
+   * @brief   Alias for doubly linked dlist iterator type with according payload type.
+   */
+  typedef typename dlcdlist<T>::iterator iterator;
+
+  /**
+   * @brief   Doubly linked item with a timestamp.
+   *
+   * @details Expired entries are handed back as items of a dldlist and can be casted back to entries.
+   */
+  class entry : public item
+  {
+  friend class ttlcdlist;
+
+  private:
+    /**
+     * @brief   Time of the last insertion or touch.
+     */
+    uint64_t m_stamp;
+
+  public:
+    /**
+     * @brief   The only constructor with payload as argument.
+     *
+     * @param[in] d   The payload to set for the entry.
+     */
+    entry(T& d);
+
+    /**
+     * @brief   Retrieves the time of the last insertion or touch.
+     *
+     * @return  Timestamp of the entry.
+     */
+    uint64_t stamp() const;
+  };
+
+private:
+  /**
+   * @brief   Entries from the eldest to the latest timestamp.
+   */
+  basic_dlist<DOUBLY_LINKED, UNORDERED, CIRCULAR, T, counted> m_list;
+
+  /**
+   * @brief   Time after which an entry expires.
+   */
+  const uint64_t m_ttl;
+
+  /**
+   * @brief   The copy constructor is prohibited and must not be implemented.
+   */
+  ttlcdlist(const ttlcdlist&);
+
+  /**
+   * @brief   The copy operator is prohibited and must not be implemented.
+   */
+  ttlcdlist& operator=(const ttlcdlist&);
+
+public:
+  /**
+   * @brief   Standard constructor.
+   *
+   * @param[in] ttl   Time after which an entry expires.
+   */
+  ttlcdlist(const uint64_t ttl);
+
+  /**
+   * @brief   Retrieves the time to live.
+   *
+   * @return  Time after which an entry expires.
+   */
+  uint64_t ttl() const;
+
+  /**
+   * @brief   Checks whether the ttlcdlist is empty.
+   *
+   * @return  true, if no entry is tracked.
+   */
+  bool empty() const;
+
+  /**
+   * @brief   Retrieves the number of tracked entries in constant time.
+   *
+   * @return  Number of tracked entries.
+   */
+  size_t size() const;
+
+  /**
+   * @brief   Retrieves an iterator to the latest entry.
+   *
+   * @return  Iterator pointing to the most recently inserted or touched entry.
+   */
+  iterator latest() const;
+
+  /**
+   * @brief   Retrieves an iterator to the eldest entry.
+   *
+   * @return  Iterator pointing to the entry that expires next.
+   */
+  iterator eldest() const;
+
+  /**
+   * @brief   Retrieves the time at which the eldest entry expires.
+   *
+   * @return  Expiry time of the eldest entry, or UINT64_MAX if the ttlcdlist is empty.
+   */
+  uint64_t next_expiry() const;
+
+  /**
+   * @brief   Inserts an entry as latest in constant time.
+   *
+   * @param[in] e     The entry to insert, which must not be attached.
+   * @param[in] now   The current time, which must not be before the timestamp of the latest entry.
+   */
+  void insert(entry& e, const uint64_t now);
+
+  /**
+   * @brief   Renews the timestamp of an entry and moves it to latest in constant time.
+   *
+   * @param[in] e     The entry to touch, which must be part of the ttlcdlist.
+   * @param[in] now   The current time, which must not be before the timestamp of the latest entry.
+   */
+  void touch(entry& e, const uint64_t now);
+
+  /**
+   * @brief   Removes an entry in constant time.
+   *
+   * @param[in] e   The entry to remove, which must either be part of the ttlcdlist or not be attached.
+   *
+   * @return  true, if the entry was part of the ttlcdlist and has been removed.
+   */
+  bool remove(entry& e);
+
+  /**
+   * @brief   Removes all expired entries and appends them to a list.
+   *
+   * @details An entry has expired if its timestamp plus the time to live is not after now.
+   *          The entries are appended as one range in the order of their timestamps.
+   *
+   * @param[in] now   The current time.
+   * @param[in] out   The list to append the expired entries to.
+   *
+   * @return  The number of expired entries.
+   */
+  size_t expire(const uint64_t now, dldlist<T>& out);
+};
+
+} /* namespace dlist */
+
+#include "ttlcdlist.tpp"
+
+#endif /* _TTLCDLIST_HPP_ */
@@ -0,0 +1,160 @@
+/*
+The distributed list (dlist) library provides very light-weight real-time
+capable list classes with can optionally be ordered or circular.
+Copyright (C) 2017..2017  Thomas Schöpping
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef _TTLCDLIST_TPP_
+#define _TTLCDLIST_TPP_
+
+#include <ttlcdlist.hpp>
+
+#include <cassert>
+
+namespace dlist
+{
+
+////////////////////////////////////////////////////////////////////////////////
+// TIME TO LIVE CIRCULAR DLIST                                                //
+////////////////////////////////////////////////////////////////////////////////
+
+// ENTRY ///////////////////////////////////////////////////////////////////////
+
+template<typename T>
+ttlcdlist<T>::entry::entry(T& d) :
+  item(d), m_stamp(0)
+{}
+
+template<typename T>
+inline uint64_t ttlcdlist<T>::entry::stamp() const
+{
+  return this->m_stamp;
+}
+
+// TTLCDLIST ///////////////////////////////////////////////////////////////////
+
+template<typename T>
+ttlcdlist<T>::ttlcdlist(const uint64_t ttl) :
+  m_list(), m_ttl(ttl)
+{}
+
+template<typename T>
+inline uint64_t ttlcdlist<T>::ttl() const
+{
+  return this->m_ttl;
+}
+
+template<typename T>
+inline bool ttlcdlist<T>::empty() const
+{
+  return this->m_list.empty();
+}
+
+template<typename T>
+inline size_t ttlcdlist<T>::size() const
+{
+  return this->m_list.size();
+}
+
+template<typename T>
+inline typename ttlcdlist<T>::iterator ttlcdlist<T>::latest() const
+{
+  return this->m_list.latest();
+}
+
+template<typename T>
+inline typename ttlcdlist<T>::iterator ttlcdlist<T>::eldest() const
+{
+  return this->m_list.eldest();
+}
+
+template<typename T>
+uint64_t ttlcdlist<T>::next_expiry() const
+{
+  // if the ttlcdlist is empty, nothing expires
+  if (this->empty()) {
+    return UINT64_MAX;
+  }
+  // the eldest entry expires first
+  else {
+    return static_cast<entry*>(this->m_list.eldest().get())->m_stamp + this->m_ttl;
+  }
+}
+
+template<typename T>
+void ttlcdlist<T>::insert(entry& e, const uint64_t now)
+{
+  assert(!e.attached());
+  assert(this->empty() || static_cast<entry*>(this->m_list.latest().get())->m_stamp <= now);
+
+  e.m_stamp = now;
+  this->m_list.insert(e);
+  return;
+}
+
+template<typename T>
+void ttlcdlist<T>::touch(entry& e, const uint64_t now)
+{
+  assert(e.attached());
+  assert(static_cast<entry*>(this->m_list.latest().get())->m_stamp <= now);
+
+  e.m_stamp = now;
+  // the latest entry stays in place
+  if (this->m_list.latest().get() != &e) {
+    this->m_list.unlink(e);
+    this->m_list.insert(e);
+  }
+  return;
+}
+
+template<typename T>
+bool ttlcdlist<T>::remove(entry& e)
+{
+  // if the entry is not attached, there is nothing to do
+  if (!e.attached()) {
+    return false;
+  }
+  // unlink the entry
+  else {
+    this->m_list.unlink(e);
+    return true;
+  }
+}
+
+template<typename T>
+size_t ttlcdlist<T>::expire(const uint64_t now, dldlist<T>& out)
+{
+  const size_t n(this->m_list.size());
+  iterator first(this->m_list.eldest());
+  iterator live(first);
+  size_t cnt(0);
+  // search the first live entry from the eldest on, where the iterator wraps around after the latest entry
+  while (cnt < n && static_cast<entry*>(live.get())->m_stamp + this->m_ttl <= now) {
+    ++live;
+    ++cnt;
+  }
+  // if all entries expired, the range extends to the latest one
+  if (cnt == n) {
+    live = iterator();
+  }
+  // detach the stale prefix in one step
+  this->m_list.erase(first, live, out);
+  return cnt;
+}
+
+} /* namespace dlist */
+
+#endif /* _TTLCDLIST_TPP_ */
@@ -0,0 +1,219 @@
+/*
+The distributed list (dlist) library provides very light-weight real-time
+capable list classes with can optionally be ordered or circular.
+Copyright (C) 2017..2017  Thomas Schöpping
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef _WSDEQUE_HPP_
+#define _WSDEQUE_HPP_
+
+#include <dlist.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <type_traits>
+
+namespace dlist {
+
+////////////////////////////////////////////////////////////////////////////////
+// WORK-STEALING DEQUE                                                        //
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief   Chase-Lev work-stealing deque of dlist items.
+ *
+ * @details The deque holds pointers to items in a circular array, which grows when it runs full.
+ *          The owner thread pushes and pops at the back without any read-modify-write operation, unless only a single item is left.
+ *          Any other thread may steal from the front concurrently, which is arbitrated by a CAS on the front index.
+ *          Arrays that have been replaced by a larger one are kept until destruction, since thieves might still read from them.
+ *
+ * @note    Only push_back() and pop_back() are restricted to the owner thread.
+ *          Items are not linked while they are held by the deque, so they remain detached.
+ *
+ * @tparam T        Type of the data stored in the wsdeque.
+ * @tparam LINKED   Identifier whether the deque holds singly or doubly linked items.
+ */
+template<typename T, linked_t LINKED = DOUBLY_LINKED>
+class wsdeque
+{
+public:
+  /**
+   * @brief   Alias for the dlist item type with according payload type.
+   */
+  typedef typename std::conditional<LINKED == SINGLY_LINKED, slitem<T>, dlitem<T>>::type item;
+
+private:
+  /**
+   * @brief   Circular array of item pointers.
+   */
+  struct buffer
+  {
+    /**
+     * @brief   Capacity of the array minus one, the capacity being a power of two.
+     */
+    const int64_t m_mask;
+
+    /**
+     * @brief   The item pointers.
+     */
+    std::atomic<item*>* m_slots;
+
+    /**
+     * @brief   The previously used, smaller array or a nullpointer.
+     */
+    buffer* m_retired;
+
+    /**
+     * @brief   Constructor.
+     *
+     * @param[in] capacity  Capacity of the array, must be a power of two.
+     * @param[in] retired   The previously used array or a nullpointer.
+     */
+    buffer(const int64_t capacity, buffer* retired);
+
+    /**
+     * @brief   Destructor, also destroys all retired arrays.
+     */
+    ~buffer();
+
+    /**
+     * @brief   Reads the slot of the specified index.
+     *
+     * @param[in] index   Index of the slot.
+     *
+     * @return  The item pointer stored in the slot.
+     */
+    item* get(const int64_t index) const;
+
+    /**
+     * @brief   Writes the slot of the specified index.
+     *
+     * @param[in] index   Index of the slot.
+     * @param[in] i       The item pointer to store.
+     */
+    void put(const int64_t index, item* i);
+  };
+
+  /**
+   * @brief   Index of the front, which is modified by thieves.
+   */
+  alignas(64) std::atomic<int64_t> m_top;
+
+  /**
+   * @brief   Index behind the back, which is only modified by the owner.
+   */
+  alignas(64) std::atomic<int64_t> m_bottom;
+
+  /**
+   * @brief   The current array.
+   */
+  std::atomic<buffer*> m_buffer;
+
+  /**
+   * @brief   The copy constructor is prohibited and must not be implemented.
+   */
+  wsdeque(const wsdeque&);
+
+  /**
+   * @brief   The copy operator is prohibited and must not be implemented.
+   */
+  wsdeque& operator=(const wsdeque&);
+
+  /**
+   * @brief   Replaces the current array by one of twice the capacity.
+   *
+   * @param[in] buf     The current array.
+   * @param[in] top     The current front index.
+   * @param[in] bottom  The current back index.
+   *
+   * @return  The new array.
+   */
+  buffer* _grow(buffer* buf, const int64_t top, const int64_t bottom);
+
+public:
+  /**
+   * @brief   Standard constructor.
+   *
+   * @param[in] capacity  Initial capacity, which is rounded up to a power of two.
+   */
+  wsdeque(const size_t capacity = 64);
+
+  /**
+   * @brief   Destructor.
+   *
+   * @note    Items still held by the deque are not affected.
+   */
+  ~wsdeque();
+
+  /**
+   * @brief   Checks whether the wsdeque is empty.
+   *
+   * @note    The result is only a snapshot if other threads steal concurrently.
+   *
+   * @return  true, if the wsdeque holds no items.
+   */
+  bool empty() const;
+
+  /**
+   * @brief   Retrieves the size of the wsdeque.
+   *
+   * @note    The result is only a snapshot if other threads steal concurrently.
+   *
+   * @return  Number of items in the wsdeque.
+   */
+  size_t size() const;
+
+  /**
+   * @brief   Retrieves the capacity of the current array.
+   *
+   * @return  Number of items the wsdeque can hold without growing.
+   */
+  size_t capacity() const;
+
+  /**
+   * @brief   Appends an item at the back of the wsdeque.
+   *
+   * @note    Must only be called by the owner thread.
+   *
+   * @param[in] i   The item to append.
+   */
+  void push_back(item& i);
+
+  /**
+   * @brief   Removes the last item from the wsdeque.
+   *
+   * @note    Must only be called by the owner thread.
+   *
+   * @return  Pointer to the removed item, or a nullpointer if the wsdeque was empty or the last item was stolen.
+   */
+  item* pop_back();
+
+  /**
+   * @brief   Steals the first item from the wsdeque.
+   *
+   * @details Can be called by any thread.
+   *          If another thief wins the race for the first item, the next one is tried.
+   *
+   * @return  Pointer to the removed item, or a nullpointer if the wsdeque was empty.
+   */
+  item* pop_front();
+};
+
+} /* namespace dlist */
+
+#include "wsdeque.tpp"
+
+#endif /* _WSDEQUE_HPP_ */
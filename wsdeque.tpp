@@ -0,0 +1,184 @@
+/*
+The distributed list (dlist) library provides very light-weight real-time
+capable list classes with can optionally be ordered or circular.
+Copyright (C) 2017..2017  Thomas Schöpping
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef _WSDEQUE_TPP_
+#define _WSDEQUE_TPP_
+
+#include <wsdeque.hpp>
+
+#include <cassert>
+
+namespace dlist
+{
+
+////////////////////////////////////////////////////////////////////////////////
+// WORK-STEALING DEQUE                                                        //
+////////////////////////////////////////////////////////////////////////////////
+
+// BUFFER //////////////////////////////////////////////////////////////////////
+
+template<typename T, linked_t LINKED>
+wsdeque<T, LINKED>::buffer::buffer(const int64_t capacity, buffer* retired) :
+  m_mask(capacity - 1), m_slots(new std::atomic<item*>[capacity]), m_retired(retired)
+{}
+
+template<typename T, linked_t LINKED>
+wsdeque<T, LINKED>::buffer::~buffer()
+{
+  delete[] this->m_slots;
+  delete this->m_retired;
+}
+
+template<typename T, linked_t LINKED>
+inline typename wsdeque<T, LINKED>::item* wsdeque<T, LINKED>::buffer::get(const int64_t index) const
+{
+  return this->m_slots[index & this->m_mask].load(std::memory_order_relaxed);
+}
+
+template<typename T, linked_t LINKED>
+inline void wsdeque<T, LINKED>::buffer::put(const int64_t index, item* i)
+{
+  this->m_slots[index & this->m_mask].store(i, std::memory_order_relaxed);
+  return;
+}
+
+// WSDEQUE /////////////////////////////////////////////////////////////////////
+
+template<typename T, linked_t LINKED>
+wsdeque<T, LINKED>::wsdeque(const size_t capacity) :
+  m_top(0), m_bottom(0), m_buffer(nullptr)
+{
+  // round the capacity up to a power of two
+  int64_t cap(1);
+  while (cap < static_cast<int64_t>(capacity)) {
+    cap <<= 1;
+  }
+  this->m_buffer.store(new buffer(cap, nullptr), std::memory_order_relaxed);
+}
+
+template<typename T, linked_t LINKED>
+wsdeque<T, LINKED>::~wsdeque()
+{
+  delete this->m_buffer.load(std::memory_order_relaxed);
+}
+
+template<typename T, linked_t LINKED>
+typename wsdeque<T, LINKED>::buffer* wsdeque<T, LINKED>::_grow(buffer* buf, const int64_t top, const int64_t bottom)
+{
+  // copy all items to an array of twice the capacity and keep the old array for concurrent thieves
+  buffer* grown(new buffer(2 * (buf->m_mask + 1), buf));
+  for (int64_t index = top; index < bottom; ++index) {
+    grown->put(index, buf->get(index));
+  }
+  this->m_buffer.store(grown, std::memory_order_release);
+  return grown;
+}
+
+template<typename T, linked_t LINKED>
+inline bool wsdeque<T, LINKED>::empty() const
+{
+  return (this->size() == 0);
+}
+
+template<typename T, linked_t LINKED>
+inline size_t wsdeque<T, LINKED>::size() const
+{
+  const int64_t bottom(this->m_bottom.load(std::memory_order_relaxed));
+  const int64_t top(this->m_top.load(std::memory_order_relaxed));
+  return (bottom > top) ? static_cast<size_t>(bottom - top) : 0;
+}
+
+template<typename T, linked_t LINKED>
+inline size_t wsdeque<T, LINKED>::capacity() const
+{
+  return static_cast<size_t>(this->m_buffer.load(std::memory_order_relaxed)->m_mask + 1);
+}
+
+template<typename T, linked_t LINKED>
+void wsdeque<T, LINKED>::push_back(item& i)
+{
+  assert(!i.attached());
+
+  const int64_t bottom(this->m_bottom.load(std::memory_order_relaxed));
+  const int64_t top(this->m_top.load(std::memory_order_acquire));
+  buffer* buf(this->m_buffer.load(std::memory_order_relaxed));
+
+  // grow the array if it is full
+  if (bottom - top > buf->m_mask) {
+    buf = this->_grow(buf, top, bottom);
+  }
+
+  // store the item and publish it to thieves
+  buf->put(bottom, &i);
+  std::atomic_thread_fence(std::memory_order_release);
+  this->m_bottom.store(bottom + 1, std::memory_order_relaxed);
+  return;
+}
+
+template<typename T, linked_t LINKED>
+typename wsdeque<T, LINKED>::item* wsdeque<T, LINKED>::pop_back()
+{
+  // reserve the last item before looking at the front
+  const int64_t bottom(this->m_bottom.load(std::memory_order_relaxed) - 1);
+  buffer* buf(this->m_buffer.load(std::memory_order_relaxed));
+  this->m_bottom.store(bottom, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  int64_t top(this->m_top.load(std::memory_order_relaxed));
+
+  // if the deque was empty, restore the back index
+  if (top > bottom) {
+    this->m_bottom.store(bottom + 1, std::memory_order_relaxed);
+    return nullptr;
+  }
+
+  item* i(buf->get(bottom));
+  // if this is the last item, race against thieves for it
+  if (top == bottom) {
+    if (!this->m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+      i = nullptr;
+    }
+    this->m_bottom.store(bottom + 1, std::memory_order_relaxed);
+  }
+  return i;
+}
+
+template<typename T, linked_t LINKED>
+typename wsdeque<T, LINKED>::item* wsdeque<T, LINKED>::pop_front()
+{
+  int64_t top(this->m_top.load(std::memory_order_acquire));
+  while (true) {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    const int64_t bottom(this->m_bottom.load(std::memory_order_acquire));
+
+    // if the deque is empty, return immediately
+    if (top >= bottom) {
+      return nullptr;
+    }
+
+    // read the first item and claim it, retry with the updated front index if another thread was faster
+    item* i(this->m_buffer.load(std::memory_order_acquire)->get(top));
+    if (this->m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_acquire)) {
+      return i;
+    }
+  }
+}
+
+} /* namespace dlist */
+
+#endif /* _WSDEQUE_TPP_ */